@@ -1,17 +1,572 @@
 #ifndef LIBC_REDACTED_H
 #define LIBC_REDACTED_H
 
+#include <stdarg.h>
 #include <stddef.h>
 #include <stdint.h>
 
+/* restrict is C99 only; C++ compilers spell it __restrict */
+#ifdef __cplusplus
+#define LR__RESTRICT __restrict
+#else
+#define LR__RESTRICT restrict
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/* SIMD helpers (x86-64 only, SSE2 is part of the base ISA) */
+#if defined(__x86_64__) && defined(__GNUC__)
+#define LR_SIMD 1
+
+typedef char lr__v16 __attribute__((vector_size(16)));
+
+static inline lr__v16 lr__v16_load(const void* p) {
+    lr__v16 v;
+    #ifdef __AVX__
+    __asm__ ("vmovdqu %1, %0" : "=x" (v) : "m" (*(const char (*)[16])p));
+    #else
+    __asm__ ("movdqu %1, %0" : "=x" (v) : "m" (*(const char (*)[16])p));
+    #endif
+    return v;
+}
+
+static inline lr__v16 lr__v16_set1(char c) {
+    lr__v16 v = { c, c, c, c, c, c, c, c, c, c, c, c, c, c, c, c };
+    return v;
+}
+
+static inline lr__v16 lr__v16_cmpgt(lr__v16 a, lr__v16 b) {
+    #ifdef __AVX__
+    __asm__ ("vpcmpgtb %2, %1, %0" : "=x" (a) : "x" (a), "x" (b));
+    #else
+    __asm__ ("pcmpgtb %1, %0" : "+x" (a) : "x" (b));
+    #endif
+    return a;
+}
+
+static inline unsigned lr__v16_movemask(lr__v16 v) {
+    unsigned m;
+    #ifdef __AVX__
+    __asm__ ("vpmovmskb %1, %0" : "=r" (m) : "x" (v));
+    #else
+    __asm__ ("pmovmskb %1, %0" : "=r" (m) : "x" (v));
+    #endif
+    return m;
+}
+
+static inline void lr__v16_store(void* p, lr__v16 v) {
+    #ifdef __AVX__
+    __asm__ ("vmovdqu %1, %0" : "=m" (*(char (*)[16])p) : "x" (v));
+    #else
+    __asm__ ("movdqu %1, %0" : "=m" (*(char (*)[16])p) : "x" (v));
+    #endif
+}
+
+/* Non-temporal store to a 16-byte aligned p; order with lr__sfence */
+static inline void lr__v16_stream(void* p, lr__v16 v) {
+    #ifdef __AVX__
+    __asm__ ("vmovntdq %1, %0" : "=m" (*(char (*)[16])p) : "x" (v));
+    #else
+    __asm__ ("movntdq %1, %0" : "=m" (*(char (*)[16])p) : "x" (v));
+    #endif
+}
+
+static inline void lr__sfence(void) {
+    __asm__ volatile ("sfence" ::: "memory");
+}
+
+/* Logical right shift of each 16-bit lane */
+static inline lr__v16 lr__v16_srl16(lr__v16 v, int n) {
+    lr__v16 count = { (char)n };
+    #ifdef __AVX__
+    __asm__ ("vpsrlw %2, %1, %0" : "=x" (v) : "x" (v), "x" (count));
+    #else
+    __asm__ ("psrlw %1, %0" : "+x" (v) : "x" (count));
+    #endif
+    return v;
+}
+
+/* Interleave the low (high) eight bytes of a and b: a0 b0 a1 b1 ... */
+static inline lr__v16 lr__v16_unpacklo(lr__v16 a, lr__v16 b) {
+    #ifdef __AVX__
+    __asm__ ("vpunpcklbw %2, %1, %0" : "=x" (a) : "x" (a), "x" (b));
+    #else
+    __asm__ ("punpcklbw %1, %0" : "+x" (a) : "x" (b));
+    #endif
+    return a;
+}
+
+static inline lr__v16 lr__v16_unpackhi(lr__v16 a, lr__v16 b) {
+    #ifdef __AVX__
+    __asm__ ("vpunpckhbw %2, %1, %0" : "=x" (a) : "x" (a), "x" (b));
+    #else
+    __asm__ ("punpckhbw %1, %0" : "+x" (a) : "x" (b));
+    #endif
+    return a;
+}
+
+/* Same for 16-bit (32-bit) lanes */
+static inline lr__v16 lr__v16_unpacklo16(lr__v16 a, lr__v16 b) {
+    #ifdef __AVX__
+    __asm__ ("vpunpcklwd %2, %1, %0" : "=x" (a) : "x" (a), "x" (b));
+    #else
+    __asm__ ("punpcklwd %1, %0" : "+x" (a) : "x" (b));
+    #endif
+    return a;
+}
+
+static inline lr__v16 lr__v16_unpackhi16(lr__v16 a, lr__v16 b) {
+    #ifdef __AVX__
+    __asm__ ("vpunpckhwd %2, %1, %0" : "=x" (a) : "x" (a), "x" (b));
+    #else
+    __asm__ ("punpckhwd %1, %0" : "+x" (a) : "x" (b));
+    #endif
+    return a;
+}
+
+static inline lr__v16 lr__v16_unpacklo32(lr__v16 a, lr__v16 b) {
+    #ifdef __AVX__
+    __asm__ ("vpunpckldq %2, %1, %0" : "=x" (a) : "x" (a), "x" (b));
+    #else
+    __asm__ ("punpckldq %1, %0" : "+x" (a) : "x" (b));
+    #endif
+    return a;
+}
+
+static inline lr__v16 lr__v16_unpackhi32(lr__v16 a, lr__v16 b) {
+    #ifdef __AVX__
+    __asm__ ("vpunpckhdq %2, %1, %0" : "=x" (a) : "x" (a), "x" (b));
+    #else
+    __asm__ ("punpckhdq %1, %0" : "+x" (a) : "x" (b));
+    #endif
+    return a;
+}
+
+static inline lr__v16 lr__v16_cmpeq(lr__v16 a, lr__v16 b) {
+    #ifdef __AVX__
+    __asm__ ("vpcmpeqb %2, %1, %0" : "=x" (a) : "x" (a), "x" (b));
+    #else
+    __asm__ ("pcmpeqb %1, %0" : "+x" (a) : "x" (b));
+    #endif
+    return a;
+}
+
+static inline lr__v16 lr__v16_cmpeq32(lr__v16 a, lr__v16 b) {
+    #ifdef __AVX__
+    __asm__ ("vpcmpeqd %2, %1, %0" : "=x" (a) : "x" (a), "x" (b));
+    #else
+    __asm__ ("pcmpeqd %1, %0" : "+x" (a) : "x" (b));
+    #endif
+    return a;
+}
+
+static inline lr__v16 lr__v16_cmpeq16(lr__v16 a, lr__v16 b) {
+    #ifdef __AVX__
+    __asm__ ("vpcmpeqw %2, %1, %0" : "=x" (a) : "x" (a), "x" (b));
+    #else
+    __asm__ ("pcmpeqw %1, %0" : "+x" (a) : "x" (b));
+    #endif
+    return a;
+}
+
+/* Before SSE4.1, both 32-bit halves of a lane have to match */
+static inline lr__v16 lr__v16_cmpeq64(lr__v16 a, lr__v16 b) {
+    #if defined(__AVX__)
+    __asm__ ("vpcmpeqq %2, %1, %0" : "=x" (a) : "x" (a), "x" (b));
+    #elif defined(__SSE4_1__)
+    __asm__ ("pcmpeqq %1, %0" : "+x" (a) : "x" (b));
+    #else
+    lr__v16 t;
+    __asm__ ("pcmpeqd %1, %0" : "+x" (a) : "x" (b));
+    __asm__ ("pshufd $0xb1, %1, %0" : "=x" (t) : "x" (a));
+    a &= t;
+    #endif
+    return a;
+}
+
+/* 32-bit lanes moved down one, the lowest to the top */
+static inline lr__v16 lr__v16_rotate32(lr__v16 v) {
+    #ifdef __AVX__
+    __asm__ ("vpshufd $0x39, %1, %0" : "=x" (v) : "x" (v));
+    #else
+    __asm__ ("pshufd $0x39, %1, %0" : "=x" (v) : "x" (v));
+    #endif
+    return v;
+}
+
+/* Top bit of each 32-bit lane */
+static inline unsigned lr__v16_movemask32(lr__v16 v) {
+    unsigned m;
+    #ifdef __AVX__
+    __asm__ ("vmovmskps %1, %0" : "=r" (m) : "x" (v));
+    #else
+    __asm__ ("movmskps %1, %0" : "=r" (m) : "x" (v));
+    #endif
+    return m;
+}
+
+/* Same 32-bit value in every lane */
+static inline lr__v16 lr__v16_set1_32(uint32_t x) {
+    typedef uint32_t lr__u32x4 __attribute__((vector_size(16)));
+    lr__u32x4 v = { x, x, x, x };
+    return (lr__v16)v;
+}
+
+static inline lr__v16 lr__v16_set1_64(uint64_t x) {
+    typedef uint64_t lr__u64x2 __attribute__((vector_size(16)));
+    lr__u64x2 v = { x, x };
+    return (lr__v16)v;
+}
+
+/* Unsigned byte subtraction clamped at zero */
+static inline lr__v16 lr__v16_subs_u8(lr__v16 a, lr__v16 b) {
+    #ifdef __AVX__
+    __asm__ ("vpsubusb %2, %1, %0" : "=x" (a) : "x" (a), "x" (b));
+    #else
+    __asm__ ("psubusb %1, %0" : "+x" (a) : "x" (b));
+    #endif
+    return a;
+}
+
+/* High and low halves of 16-bit lane products */
+static inline lr__v16 lr__v16_mulhi_u16(lr__v16 a, lr__v16 b) {
+    #ifdef __AVX__
+    __asm__ ("vpmulhuw %2, %1, %0" : "=x" (a) : "x" (a), "x" (b));
+    #else
+    __asm__ ("pmulhuw %1, %0" : "+x" (a) : "x" (b));
+    #endif
+    return a;
+}
+
+static inline lr__v16 lr__v16_mullo_16(lr__v16 a, lr__v16 b) {
+    #ifdef __AVX__
+    __asm__ ("vpmullw %2, %1, %0" : "=x" (a) : "x" (a), "x" (b));
+    #else
+    __asm__ ("pmullw %1, %0" : "+x" (a) : "x" (b));
+    #endif
+    return a;
+}
+
+/* Unsigned byte minimum */
+static inline lr__v16 lr__v16_min_u8(lr__v16 a, lr__v16 b) {
+    #ifdef __AVX__
+    __asm__ ("vpminub %2, %1, %0" : "=x" (a) : "x" (a), "x" (b));
+    #else
+    __asm__ ("pminub %1, %0" : "+x" (a) : "x" (b));
+    #endif
+    return a;
+}
+
+/* 32-bit lane addition */
+static inline lr__v16 lr__v16_add32(lr__v16 a, lr__v16 b) {
+    #ifdef __AVX__
+    __asm__ ("vpaddd %2, %1, %0" : "=x" (a) : "x" (a), "x" (b));
+    #else
+    __asm__ ("paddd %1, %0" : "+x" (a) : "x" (b));
+    #endif
+    return a;
+}
+
+/* 64-bit lane addition */
+static inline lr__v16 lr__v16_add64(lr__v16 a, lr__v16 b) {
+    #ifdef __AVX__
+    __asm__ ("vpaddq %2, %1, %0" : "=x" (a) : "x" (a), "x" (b));
+    #else
+    __asm__ ("paddq %1, %0" : "+x" (a) : "x" (b));
+    #endif
+    return a;
+}
+
+/* Sums of absolute byte differences, one per 8-byte half, in the low
+ * 16 bits of each 64-bit lane */
+static inline lr__v16 lr__v16_sad_u8(lr__v16 a, lr__v16 b) {
+    #ifdef __AVX__
+    __asm__ ("vpsadbw %2, %1, %0" : "=x" (a) : "x" (a), "x" (b));
+    #else
+    __asm__ ("psadbw %1, %0" : "+x" (a) : "x" (b));
+    #endif
+    return a;
+}
+
+/* 16-bit lane products, adjacent pairs summed to 32 bits */
+static inline lr__v16 lr__v16_madd16(lr__v16 a, lr__v16 b) {
+    #ifdef __AVX__
+    __asm__ ("vpmaddwd %2, %1, %0" : "=x" (a) : "x" (a), "x" (b));
+    #else
+    __asm__ ("pmaddwd %1, %0" : "+x" (a) : "x" (b));
+    #endif
+    return a;
+}
+
+/* Narrow the 16-bit lanes of a then b to bytes with unsigned saturation */
+static inline lr__v16 lr__v16_packus16(lr__v16 a, lr__v16 b) {
+    #ifdef __AVX__
+    __asm__ ("vpackuswb %2, %1, %0" : "=x" (a) : "x" (a), "x" (b));
+    #else
+    __asm__ ("packuswb %1, %0" : "+x" (a) : "x" (b));
+    #endif
+    return a;
+}
+
+#ifdef __SSSE3__
+/* table[idx & 15] per byte, 0 where idx has its top bit set */
+static inline lr__v16 lr__v16_shuffle(lr__v16 table, lr__v16 idx) {
+    #ifdef __AVX__
+    __asm__ ("vpshufb %2, %1, %0" : "=x" (table) : "x" (table), "x" (idx));
+    #else
+    __asm__ ("pshufb %1, %0" : "+x" (table) : "x" (idx));
+    #endif
+    return table;
+}
+
+/* Unsigned bytes of a times signed bytes of b, adjacent pairs summed to 16 bits */
+static inline lr__v16 lr__v16_maddubs(lr__v16 a, lr__v16 b) {
+    #ifdef __AVX__
+    __asm__ ("vpmaddubsw %2, %1, %0" : "=x" (a) : "x" (a), "x" (b));
+    #else
+    __asm__ ("pmaddubsw %1, %0" : "+x" (a) : "x" (b));
+    #endif
+    return a;
+}
+#endif
+
+#ifdef __PCLMUL__
+/* Carry-less product of the low (or high) 64-bit halves of a and b */
+static inline lr__v16 lr__v16_clmul_lo(lr__v16 a, lr__v16 b) {
+    #ifdef __AVX__
+    __asm__ ("vpclmulqdq $0x00, %2, %1, %0" : "=x" (a) : "x" (a), "x" (b));
+    #else
+    __asm__ ("pclmulqdq $0x00, %1, %0" : "+x" (a) : "x" (b));
+    #endif
+    return a;
+}
+
+static inline lr__v16 lr__v16_clmul_hi(lr__v16 a, lr__v16 b) {
+    #ifdef __AVX__
+    __asm__ ("vpclmulqdq $0x11, %2, %1, %0" : "=x" (a) : "x" (a), "x" (b));
+    #else
+    __asm__ ("pclmulqdq $0x11, %1, %0" : "+x" (a) : "x" (b));
+    #endif
+    return a;
+}
+#endif
+
+#ifdef __AES__
+/* One AES encryption round: MixColumns(ShiftRows(SubBytes(a))) ^ key */
+static inline lr__v16 lr__v16_aesenc(lr__v16 a, lr__v16 key) {
+    #ifdef __AVX__
+    __asm__ ("vaesenc %2, %1, %0" : "=x" (a) : "x" (a), "x" (key));
+    #else
+    __asm__ ("aesenc %1, %0" : "+x" (a) : "x" (key));
+    #endif
+    return a;
+}
+#endif
+
+#ifdef __AVX2__
+/* 256-bit versions; lane-crossing steps are called out where they matter */
+typedef char lr__v32 __attribute__((vector_size(32)));
+
+static inline lr__v32 lr__v32_load(const void* p) {
+    lr__v32 v;
+    __asm__ ("vmovdqu %1, %0" : "=x" (v) : "m" (*(const char (*)[32])p));
+    return v;
+}
+
+static inline void lr__v32_store(void* p, lr__v32 v) {
+    __asm__ ("vmovdqu %1, %0" : "=m" (*(char (*)[32])p) : "x" (v));
+}
+
+/* The same 16 bytes in both lanes */
+static inline lr__v32 lr__v32_broadcast16(const void* p) {
+    lr__v32 v;
+    __asm__ ("vbroadcasti128 %1, %0" : "=x" (v) : "m" (*(const char (*)[16])p));
+    return v;
+}
+
+static inline lr__v32 lr__v32_set1(char c) {
+    lr__v32 v = { c, c, c, c, c, c, c, c, c, c, c, c, c, c, c, c,
+                  c, c, c, c, c, c, c, c, c, c, c, c, c, c, c, c };
+    return v;
+}
+
+static inline lr__v32 lr__v32_cmpgt(lr__v32 a, lr__v32 b) {
+    __asm__ ("vpcmpgtb %2, %1, %0" : "=x" (a) : "x" (a), "x" (b));
+    return a;
+}
+
+static inline unsigned lr__v32_movemask(lr__v32 v) {
+    unsigned m;
+    __asm__ ("vpmovmskb %1, %0" : "=r" (m) : "x" (v));
+    return m;
+}
+
+static inline lr__v32 lr__v32_srl16(lr__v32 v, int n) {
+    lr__v16 count = { (char)n };
+    __asm__ ("vpsrlw %2, %1, %0" : "=x" (v) : "x" (v), "x" (count));
+    return v;
+}
+
+static inline lr__v32 lr__v32_set1_32(uint32_t x) {
+    typedef uint32_t lr__u32x8 __attribute__((vector_size(32)));
+    lr__u32x8 v = { x, x, x, x, x, x, x, x };
+    return (lr__v32)v;
+}
+
+static inline lr__v32 lr__v32_cmpeq(lr__v32 a, lr__v32 b) {
+    __asm__ ("vpcmpeqb %2, %1, %0" : "=x" (a) : "x" (a), "x" (b));
+    return a;
+}
+
+static inline lr__v32 lr__v32_cmpeq16(lr__v32 a, lr__v32 b) {
+    __asm__ ("vpcmpeqw %2, %1, %0" : "=x" (a) : "x" (a), "x" (b));
+    return a;
+}
+
+static inline lr__v32 lr__v32_cmpeq32(lr__v32 a, lr__v32 b) {
+    __asm__ ("vpcmpeqd %2, %1, %0" : "=x" (a) : "x" (a), "x" (b));
+    return a;
+}
+
+static inline lr__v32 lr__v32_cmpeq64(lr__v32 a, lr__v32 b) {
+    __asm__ ("vpcmpeqq %2, %1, %0" : "=x" (a) : "x" (a), "x" (b));
+    return a;
+}
+
+static inline lr__v32 lr__v32_set1_64(uint64_t x) {
+    typedef uint64_t lr__u64x4 __attribute__((vector_size(32)));
+    lr__u64x4 v = { x, x, x, x };
+    return (lr__v32)v;
+}
+
+static inline lr__v32 lr__v32_subs_u8(lr__v32 a, lr__v32 b) {
+    __asm__ ("vpsubusb %2, %1, %0" : "=x" (a) : "x" (a), "x" (b));
+    return a;
+}
+
+static inline lr__v32 lr__v32_min_u8(lr__v32 a, lr__v32 b) {
+    __asm__ ("vpminub %2, %1, %0" : "=x" (a) : "x" (a), "x" (b));
+    return a;
+}
+
+static inline lr__v32 lr__v32_add32(lr__v32 a, lr__v32 b) {
+    __asm__ ("vpaddd %2, %1, %0" : "=x" (a) : "x" (a), "x" (b));
+    return a;
+}
+
+static inline lr__v32 lr__v32_sad_u8(lr__v32 a, lr__v32 b) {
+    __asm__ ("vpsadbw %2, %1, %0" : "=x" (a) : "x" (a), "x" (b));
+    return a;
+}
+
+static inline lr__v32 lr__v32_mulhi_u16(lr__v32 a, lr__v32 b) {
+    __asm__ ("vpmulhuw %2, %1, %0" : "=x" (a) : "x" (a), "x" (b));
+    return a;
+}
+
+static inline lr__v32 lr__v32_mullo_16(lr__v32 a, lr__v32 b) {
+    __asm__ ("vpmullw %2, %1, %0" : "=x" (a) : "x" (a), "x" (b));
+    return a;
+}
+
+static inline lr__v32 lr__v32_madd16(lr__v32 a, lr__v32 b) {
+    __asm__ ("vpmaddwd %2, %1, %0" : "=x" (a) : "x" (a), "x" (b));
+    return a;
+}
+
+/* Gather 32-bit elements across lanes: v[idx[k]] */
+static inline lr__v32 lr__v32_permute32(lr__v32 v, lr__v32 idx) {
+    __asm__ ("vpermd %1, %2, %0" : "=x" (v) : "x" (v), "x" (idx));
+    return v;
+}
+
+/* Per 128-bit lane, like the lr__v16 versions */
+static inline lr__v32 lr__v32_shuffle(lr__v32 table, lr__v32 idx) {
+    __asm__ ("vpshufb %2, %1, %0" : "=x" (table) : "x" (table), "x" (idx));
+    return table;
+}
+
+static inline lr__v32 lr__v32_unpacklo(lr__v32 a, lr__v32 b) {
+    __asm__ ("vpunpcklbw %2, %1, %0" : "=x" (a) : "x" (a), "x" (b));
+    return a;
+}
+
+static inline lr__v32 lr__v32_unpackhi(lr__v32 a, lr__v32 b) {
+    __asm__ ("vpunpckhbw %2, %1, %0" : "=x" (a) : "x" (a), "x" (b));
+    return a;
+}
+
+static inline lr__v32 lr__v32_packus16(lr__v32 a, lr__v32 b) {
+    __asm__ ("vpackuswb %2, %1, %0" : "=x" (a) : "x" (a), "x" (b));
+    return a;
+}
+
+static inline lr__v32 lr__v32_maddubs(lr__v32 a, lr__v32 b) {
+    __asm__ ("vpmaddubsw %2, %1, %0" : "=x" (a) : "x" (a), "x" (b));
+    return a;
+}
+
+/* 64-bit quarters reordered 0, 2, 1, 3: undoes (or prepares for) the
+ * per-lane behaviour of unpack and pack */
+static inline lr__v32 lr__v32_interleave_lanes(lr__v32 v) {
+    __asm__ ("vpermq $0xD8, %1, %0" : "=x" (v) : "x" (v));
+    return v;
+}
+#endif
+
+/* True if a 16-byte load at p cannot fault on the following page */
+static inline int lr__v16_page_safe(const void* p) {
+    return ((uintptr_t)p & 4095) <= 4096 - 16;
+}
+#endif
+
+/* Unaligned little-endian 64-bit load */
+static inline uint64_t lr__load64(const void* p) {
+    #ifdef __GNUC__
+    uint64_t v;
+    __builtin_memcpy(&v, p, 8);
+    return v;
+    #else
+    const unsigned char* b = (const unsigned char*)p;
+    return (uint64_t)b[0] | (uint64_t)b[1] << 8 | (uint64_t)b[2] << 16 |
+           (uint64_t)b[3] << 24 | (uint64_t)b[4] << 32 | (uint64_t)b[5] << 40 |
+           (uint64_t)b[6] << 48 | (uint64_t)b[7] << 56;
+    #endif
+}
+
+/* Unaligned little-endian 32-bit load */
+static inline uint32_t lr__load32(const void* p) {
+    #ifdef __GNUC__
+    uint32_t v;
+    __builtin_memcpy(&v, p, 4);
+    return v;
+    #else
+    const unsigned char* b = (const unsigned char*)p;
+    return (uint32_t)b[0] | (uint32_t)b[1] << 8 | (uint32_t)b[2] << 16 | (uint32_t)b[3] << 24;
+    #endif
+}
+
+/* Copy of a constant n bytes, which GCC expands into plain moves even at
+ * -O0; other compilers get memcpy() below */
+#ifdef __GNUC__
+#define LR__COPY_FIXED(d, s, n) __builtin_memcpy((d), (s), (n))
+#else
+#define LR__COPY_FIXED(d, s, n) memcpy((d), (s), (n))
+#endif
+
+/* Alignment of a variable, where the compiler has a way to ask for it */
+#ifdef __GNUC__
+#define LR__ALIGNED(n) __attribute__((aligned(n)))
+#else
+#define LR__ALIGNED(n)
+#endif
+
 /* Memory functions */
-static inline void* memcpy(void* restrict dest, const void* restrict src, size_t n) {
-    char* restrict d = (char* restrict)dest;
-    const char* restrict s = (const char* restrict)src;
+static inline void* memcpy(void* LR__RESTRICT dest, const void* LR__RESTRICT src, size_t n) {
+    char* LR__RESTRICT d = (char* LR__RESTRICT)dest;
+    const char* LR__RESTRICT s = (const char* LR__RESTRICT)src;
     
     #ifdef __x86_64__
     /* Use optimized word/dword copy for aligned data, then handle remainder */
@@ -386,6 +941,61 @@ static inline int ffsll(long long i) {
     #endif
 }
 
+/* Find last set: 1-based index of the most significant set bit, 0 for 0 */
+static inline int fls(int i) {
+    unsigned x = (unsigned)i;
+    
+    if (x == 0) {
+        return 0;
+    }
+    
+    #ifdef __GNUC__
+    return 32 - __builtin_clz(x);
+    #else
+    int pos = 32;
+    
+    if ((x & 0xFFFF0000u) == 0) {
+        pos -= 16;
+        x <<= 16;
+    }
+    if ((x & 0xFF000000u) == 0) {
+        pos -= 8;
+        x <<= 8;
+    }
+    if ((x & 0xF0000000u) == 0) {
+        pos -= 4;
+        x <<= 4;
+    }
+    if ((x & 0xC0000000u) == 0) {
+        pos -= 2;
+        x <<= 2;
+    }
+    if ((x & 0x80000000u) == 0) {
+        pos -= 1;
+    }
+    
+    return pos;
+    #endif
+}
+
+static inline int flsll(long long i) {
+    unsigned long long x = (unsigned long long)i;
+    
+    if (x == 0) {
+        return 0;
+    }
+    
+    #ifdef __GNUC__
+    return 64 - __builtin_clzll(x);
+    #else
+    return (x >> 32) ? 32 + fls((int)(x >> 32)) : fls((int)x);
+    #endif
+}
+
+static inline int flsl(long i) {
+    return sizeof(long) == sizeof(long long) ? flsll(i) : fls((int)i);
+}
+
 /* Math functions */
 static inline int abs(int x) {
     return x < 0 ? -x : x;
@@ -655,8 +1265,9147 @@ static inline float fmodf(float x, float y) {
     return (float)fmod(x, y);
 }
 
-#ifdef __cplusplus
+/* Numeric conversion */
+
+/* Status codes reported by the *_status parsers (there is no errno) */
+#define LR_PARSE_OK       0   /* Parsed and in range */
+#define LR_PARSE_NODIGITS 1   /* No digits; *endptr is set to the input */
+#define LR_PARSE_RANGE    2   /* Out of range; the result is saturated */
+
+/* Value of c as a base-36 digit, or 36 if it is not one */
+static inline unsigned lr__digit_value(int c) {
+    if (isdigit(c)) return (unsigned)(c - '0');
+    if (isalpha(c)) return (unsigned)(tolower(c) - 'a' + 10);
+    return 36;
 }
+
+/* Number of leading decimal digits at s */
+static inline size_t lr__digit_span(const char* s) {
+    const char* p = s;
+    
+    #ifdef LR_SIMD
+    /* 16 bytes per compare; near a page end fall back to single bytes */
+    const lr__v16 lo = lr__v16_set1('0' - 1);
+    const lr__v16 hi = lr__v16_set1('9' + 1);
+    for (;;) {
+        if (lr__v16_page_safe(p)) {
+            lr__v16 v = lr__v16_load(p);
+            unsigned m = lr__v16_movemask(lr__v16_cmpgt(v, lo) & lr__v16_cmpgt(hi, v));
+            if (m != 0xFFFF) {
+                return (size_t)(p - s) + (size_t)__builtin_ctz(~m);
+            }
+            p += 16;
+        } else {
+            if (!isdigit((unsigned char)*p)) {
+                return (size_t)(p - s);
+            }
+            p++;
+        }
+    }
+    #else
+    while (isdigit((unsigned char)*p)) {
+        p++;
+    }
+    return (size_t)(p - s);
+    #endif
+}
+
+/* Convert eight ASCII digits (first digit in the low byte) with three multiplies */
+static inline uint32_t lr__swar_parse8(uint64_t v) {
+    const uint64_t mask = 0x000000FF000000FFULL;
+    const uint64_t mul1 = 100 + (1000000ULL << 32);
+    const uint64_t mul2 = 1 + (10000ULL << 32);
+    v -= 0x3030303030303030ULL;
+    v = (v * 10) + (v >> 8);
+    v = (((v & mask) * mul1) + (((v >> 16) & mask) * mul2)) >> 32;
+    return (uint32_t)v;
+}
+
+/* Decimal digits [p, p+len) -> value; len <= 20, leading zeros removed */
+static inline unsigned long long lr__parse_dec(const char* p, size_t len, int* overflow) {
+    unsigned long long v = 0;
+    size_t head = len & 7;
+    
+    if (len == 20) {
+        /* Only the 20th digit can overflow: parse 19, then check the last */
+        unsigned d;
+        v = lr__parse_dec(p, 19, overflow);
+        d = (unsigned)(p[19] - '0');
+        if (v > (~0ULL - d) / 10) {
+            *overflow = 1;
+            return ~0ULL;
+        }
+        return v * 10 + d;
+    }
+    
+    while (head--) {
+        v = v * 10 + (unsigned)(*p++ - '0');
+    }
+    for (len >>= 3; len; len--, p += 8) {
+        v = v * 100000000ULL + lr__swar_parse8(lr__load64(p));
+    }
+    return v;
+}
+
+/* Shared parser: magnitude of the number, sign reported separately */
+static inline unsigned long long lr__strtou_core(const char* nptr, char** endptr, int base,
+                                                int* negative, int* status) {
+    const char* s = nptr;
+    unsigned long long v = 0;
+    int overflow = 0;
+    
+    while (isspace((unsigned char)*s)) {
+        s++;
+    }
+    
+    *negative = 0;
+    if (*s == '-' || *s == '+') {
+        *negative = (*s == '-');
+        s++;
+    }
+    
+    /* A "0x" prefix counts only when a hex digit follows it */
+    if ((base == 0 || base == 16) && s[0] == '0' && (s[1] | 0x20) == 'x' &&
+        lr__digit_value((unsigned char)s[2]) < 16) {
+        s += 2;
+        base = 16;
+    } else if (base == 0) {
+        base = (s[0] == '0') ? 8 : 10;
+    }
+    
+    if (base == 10) {
+        size_t len = lr__digit_span(s);
+        const char* end = s + len;
+        
+        if (len == 0) {
+            goto nodigits;
+        }
+        while (len && *s == '0') {
+            s++;
+            len--;
+        }
+        if (len > 20) {
+            overflow = 1;
+            v = ~0ULL;
+        } else {
+            v = lr__parse_dec(s, len, &overflow);
+        }
+        s = end;
+    } else if (base >= 2 && base <= 36) {
+        const unsigned long long cutoff = ~0ULL / (unsigned)base;
+        const unsigned cutlim = (unsigned)(~0ULL % (unsigned)base);
+        const char* start = s;
+        unsigned d;
+        
+        while ((d = lr__digit_value((unsigned char)*s)) < (unsigned)base) {
+            if (v > cutoff || (v == cutoff && d > cutlim)) {
+                overflow = 1;
+            } else {
+                v = v * (unsigned)base + d;
+            }
+            s++;
+        }
+        if (s == start) {
+            goto nodigits;
+        }
+        if (overflow) {
+            v = ~0ULL;
+        }
+    } else {
+        goto nodigits;
+    }
+    
+    if (endptr) *endptr = (char*)s;
+    if (status) *status = overflow ? LR_PARSE_RANGE : LR_PARSE_OK;
+    return v;
+    
+nodigits:
+    if (endptr) *endptr = (char*)nptr;
+    if (status) *status = LR_PARSE_NODIGITS;
+    *negative = 0;
+    return 0;
+}
+
+/* Signed result clamped to [-max-1, max] */
+static inline long long lr__strtos(const char* nptr, char** endptr, int base,
+                                   unsigned long long max, int* status) {
+    int negative, st;
+    unsigned long long v = lr__strtou_core(nptr, endptr, base, &negative, &st);
+    
+    if (v > max + negative) {
+        st = LR_PARSE_RANGE;
+        v = max + negative;
+    }
+    if (status) *status = st;
+    
+    return negative && v ? -(long long)(v - 1) - 1 : (long long)v;
+}
+
+/* Unsigned result clamped to max; a leading '-' negates in the unsigned type */
+static inline unsigned long long lr__strtou(const char* nptr, char** endptr, int base,
+                                            unsigned long long max, int* status) {
+    int negative, st;
+    unsigned long long v = lr__strtou_core(nptr, endptr, base, &negative, &st);
+    
+    if (st == LR_PARSE_RANGE || v > max) {
+        if (status) *status = LR_PARSE_RANGE;
+        return max;
+    }
+    if (status) *status = st;
+    
+    return negative ? (0 - v) & max : v;
+}
+
+static inline long strtol(const char* nptr, char** endptr, int base) {
+    return (long)lr__strtos(nptr, endptr, base, ~0UL >> 1, NULL);
+}
+
+static inline unsigned long strtoul(const char* nptr, char** endptr, int base) {
+    return (unsigned long)lr__strtou(nptr, endptr, base, ~0UL, NULL);
+}
+
+static inline long long strtoll(const char* nptr, char** endptr, int base) {
+    return lr__strtos(nptr, endptr, base, ~0ULL >> 1, NULL);
+}
+
+static inline unsigned long long strtoull(const char* nptr, char** endptr, int base) {
+    return lr__strtou(nptr, endptr, base, ~0ULL, NULL);
+}
+
+/* strtoll/strtoull that also store an LR_PARSE_* code in *status */
+static inline long long strtoll_status(const char* nptr, char** endptr, int base, int* status) {
+    return lr__strtos(nptr, endptr, base, ~0ULL >> 1, status);
+}
+
+static inline unsigned long long strtoull_status(const char* nptr, char** endptr, int base, int* status) {
+    return lr__strtou(nptr, endptr, base, ~0ULL, status);
+}
+
+static inline int atoi(const char* nptr) {
+    return (int)strtol(nptr, NULL, 10);
+}
+
+static inline long atol(const char* nptr) {
+    return strtol(nptr, NULL, 10);
+}
+
+static inline long long atoll(const char* nptr) {
+    return strtoll(nptr, NULL, 10);
+}
+
+/* Floating-point conversion */
+
+/* Full 64x64 -> 128-bit product; returns the low half */
+static inline uint64_t lr__mul128(uint64_t a, uint64_t b, uint64_t* hi) {
+    #ifdef __x86_64__
+    uint64_t lo;
+    __asm__ ("mulq %3" : "=a" (lo), "=d" (*hi) : "a" (a), "rm" (b) : "cc");
+    return lo;
+    #else
+    uint64_t al = (uint32_t)a, ah = a >> 32;
+    uint64_t bl = (uint32_t)b, bh = b >> 32;
+    uint64_t ll = al * bl, lh = al * bh, hl = ah * bl, hh = ah * bh;
+    uint64_t mid = (ll >> 32) + (uint32_t)lh + (uint32_t)hl;
+    *hi = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+    return (mid << 32) | (uint32_t)ll;
+    #endif
+}
+
+static inline int lr__clz64(uint64_t x) {
+    #ifdef __GNUC__
+    return __builtin_clzll(x);
+    #else
+    int n = 0;
+    while (!(x & 0x8000000000000000ULL)) {
+        x <<= 1;
+        n++;
+    }
+    return n;
+    #endif
+}
+
+/* Truncated 128-bit mantissas of 5^q for q in [-342, 308], high word first */
+static inline const uint64_t* lr__pow5_128(int q) {
+    static const uint64_t table[] = {
+        0xeef453d6923bd65aULL, 0x113faa2906a13b3fULL,
+        0x9558b4661b6565f8ULL, 0x4ac7ca59a424c507ULL,
+        0xbaaee17fa23ebf76ULL, 0x5d79bcf00d2df649ULL,
+        0xe95a99df8ace6f53ULL, 0xf4d82c2c107973dcULL,
+        0x91d8a02bb6c10594ULL, 0x79071b9b8a4be869ULL,
+        0xb64ec836a47146f9ULL, 0x9748e2826cdee284ULL,
+        0xe3e27a444d8d98b7ULL, 0xfd1b1b2308169b25ULL,
+        0x8e6d8c6ab0787f72ULL, 0xfe30f0f5e50e20f7ULL,
+        0xb208ef855c969f4fULL, 0xbdbd2d335e51a935ULL,
+        0xde8b2b66b3bc4723ULL, 0xad2c788035e61382ULL,
+        0x8b16fb203055ac76ULL, 0x4c3bcb5021afcc31ULL,
+        0xaddcb9e83c6b1793ULL, 0xdf4abe242a1bbf3dULL,
+        0xd953e8624b85dd78ULL, 0xd71d6dad34a2af0dULL,
+        0x87d4713d6f33aa6bULL, 0x8672648c40e5ad68ULL,
+        0xa9c98d8ccb009506ULL, 0x680efdaf511f18c2ULL,
+        0xd43bf0effdc0ba48ULL, 0x0212bd1b2566def2ULL,
+        0x84a57695fe98746dULL, 0x014bb630f7604b57ULL,
+        0xa5ced43b7e3e9188ULL, 0x419ea3bd35385e2dULL,
+        0xcf42894a5dce35eaULL, 0x52064cac828675b9ULL,
+        0x818995ce7aa0e1b2ULL, 0x7343efebd1940993ULL,
+        0xa1ebfb4219491a1fULL, 0x1014ebe6c5f90bf8ULL,
+        0xca66fa129f9b60a6ULL, 0xd41a26e077774ef6ULL,
+        0xfd00b897478238d0ULL, 0x8920b098955522b4ULL,
+        0x9e20735e8cb16382ULL, 0x55b46e5f5d5535b0ULL,
+        0xc5a890362fddbc62ULL, 0xeb2189f734aa831dULL,
+        0xf712b443bbd52b7bULL, 0xa5e9ec7501d523e4ULL,
+        0x9a6bb0aa55653b2dULL, 0x47b233c92125366eULL,
+        0xc1069cd4eabe89f8ULL, 0x999ec0bb696e840aULL,
+        0xf148440a256e2c76ULL, 0xc00670ea43ca250dULL,
+        0x96cd2a865764dbcaULL, 0x380406926a5e5728ULL,
+        0xbc807527ed3e12bcULL, 0xc605083704f5ecf2ULL,
+        0xeba09271e88d976bULL, 0xf7864a44c633682eULL,
+        0x93445b8731587ea3ULL, 0x7ab3ee6afbe0211dULL,
+        0xb8157268fdae9e4cULL, 0x5960ea05bad82964ULL,
+        0xe61acf033d1a45dfULL, 0x6fb92487298e33bdULL,
+        0x8fd0c16206306babULL, 0xa5d3b6d479f8e056ULL,
+        0xb3c4f1ba87bc8696ULL, 0x8f48a4899877186cULL,
+        0xe0b62e2929aba83cULL, 0x331acdabfe94de87ULL,
+        0x8c71dcd9ba0b4925ULL, 0x9ff0c08b7f1d0b14ULL,
+        0xaf8e5410288e1b6fULL, 0x07ecf0ae5ee44dd9ULL,
+        0xdb71e91432b1a24aULL, 0xc9e82cd9f69d6150ULL,
+        0x892731ac9faf056eULL, 0xbe311c083a225cd2ULL,
+        0xab70fe17c79ac6caULL, 0x6dbd630a48aaf406ULL,
+        0xd64d3d9db981787dULL, 0x092cbbccdad5b108ULL,
+        0x85f0468293f0eb4eULL, 0x25bbf56008c58ea5ULL,
+        0xa76c582338ed2621ULL, 0xaf2af2b80af6f24eULL,
+        0xd1476e2c07286faaULL, 0x1af5af660db4aee1ULL,
+        0x82cca4db847945caULL, 0x50d98d9fc890ed4dULL,
+        0xa37fce126597973cULL, 0xe50ff107bab528a0ULL,
+        0xcc5fc196fefd7d0cULL, 0x1e53ed49a96272c8ULL,
+        0xff77b1fcbebcdc4fULL, 0x25e8e89c13bb0f7aULL,
+        0x9faacf3df73609b1ULL, 0x77b191618c54e9acULL,
+        0xc795830d75038c1dULL, 0xd59df5b9ef6a2417ULL,
+        0xf97ae3d0d2446f25ULL, 0x4b0573286b44ad1dULL,
+        0x9becce62836ac577ULL, 0x4ee367f9430aec32ULL,
+        0xc2e801fb244576d5ULL, 0x229c41f793cda73fULL,
+        0xf3a20279ed56d48aULL, 0x6b43527578c1110fULL,
+        0x9845418c345644d6ULL, 0x830a13896b78aaa9ULL,
+        0xbe5691ef416bd60cULL, 0x23cc986bc656d553ULL,
+        0xedec366b11c6cb8fULL, 0x2cbfbe86b7ec8aa8ULL,
+        0x94b3a202eb1c3f39ULL, 0x7bf7d71432f3d6a9ULL,
+        0xb9e08a83a5e34f07ULL, 0xdaf5ccd93fb0cc53ULL,
+        0xe858ad248f5c22c9ULL, 0xd1b3400f8f9cff68ULL,
+        0x91376c36d99995beULL, 0x23100809b9c21fa1ULL,
+        0xb58547448ffffb2dULL, 0xabd40a0c2832a78aULL,
+        0xe2e69915b3fff9f9ULL, 0x16c90c8f323f516cULL,
+        0x8dd01fad907ffc3bULL, 0xae3da7d97f6792e3ULL,
+        0xb1442798f49ffb4aULL, 0x99cd11cfdf41779cULL,
+        0xdd95317f31c7fa1dULL, 0x40405643d711d583ULL,
+        0x8a7d3eef7f1cfc52ULL, 0x482835ea666b2572ULL,
+        0xad1c8eab5ee43b66ULL, 0xda3243650005eecfULL,
+        0xd863b256369d4a40ULL, 0x90bed43e40076a82ULL,
+        0x873e4f75e2224e68ULL, 0x5a7744a6e804a291ULL,
+        0xa90de3535aaae202ULL, 0x711515d0a205cb36ULL,
+        0xd3515c2831559a83ULL, 0x0d5a5b44ca873e03ULL,
+        0x8412d9991ed58091ULL, 0xe858790afe9486c2ULL,
+        0xa5178fff668ae0b6ULL, 0x626e974dbe39a872ULL,
+        0xce5d73ff402d98e3ULL, 0xfb0a3d212dc8128fULL,
+        0x80fa687f881c7f8eULL, 0x7ce66634bc9d0b99ULL,
+        0xa139029f6a239f72ULL, 0x1c1fffc1ebc44e80ULL,
+        0xc987434744ac874eULL, 0xa327ffb266b56220ULL,
+        0xfbe9141915d7a922ULL, 0x4bf1ff9f0062baa8ULL,
+        0x9d71ac8fada6c9b5ULL, 0x6f773fc3603db4a9ULL,
+        0xc4ce17b399107c22ULL, 0xcb550fb4384d21d3ULL,
+        0xf6019da07f549b2bULL, 0x7e2a53a146606a48ULL,
+        0x99c102844f94e0fbULL, 0x2eda7444cbfc426dULL,
+        0xc0314325637a1939ULL, 0xfa911155fefb5308ULL,
+        0xf03d93eebc589f88ULL, 0x793555ab7eba27caULL,
+        0x96267c7535b763b5ULL, 0x4bc1558b2f3458deULL,
+        0xbbb01b9283253ca2ULL, 0x9eb1aaedfb016f16ULL,
+        0xea9c227723ee8bcbULL, 0x465e15a979c1cadcULL,
+        0x92a1958a7675175fULL, 0x0bfacd89ec191ec9ULL,
+        0xb749faed14125d36ULL, 0xcef980ec671f667bULL,
+        0xe51c79a85916f484ULL, 0x82b7e12780e7401aULL,
+        0x8f31cc0937ae58d2ULL, 0xd1b2ecb8b0908810ULL,
+        0xb2fe3f0b8599ef07ULL, 0x861fa7e6dcb4aa15ULL,
+        0xdfbdcece67006ac9ULL, 0x67a791e093e1d49aULL,
+        0x8bd6a141006042bdULL, 0xe0c8bb2c5c6d24e0ULL,
+        0xaecc49914078536dULL, 0x58fae9f773886e18ULL,
+        0xda7f5bf590966848ULL, 0xaf39a475506a899eULL,
+        0x888f99797a5e012dULL, 0x6d8406c952429603ULL,
+        0xaab37fd7d8f58178ULL, 0xc8e5087ba6d33b83ULL,
+        0xd5605fcdcf32e1d6ULL, 0xfb1e4a9a90880a64ULL,
+        0x855c3be0a17fcd26ULL, 0x5cf2eea09a55067fULL,
+        0xa6b34ad8c9dfc06fULL, 0xf42faa48c0ea481eULL,
+        0xd0601d8efc57b08bULL, 0xf13b94daf124da26ULL,
+        0x823c12795db6ce57ULL, 0x76c53d08d6b70858ULL,
+        0xa2cb1717b52481edULL, 0x54768c4b0c64ca6eULL,
+        0xcb7ddcdda26da268ULL, 0xa9942f5dcf7dfd09ULL,
+        0xfe5d54150b090b02ULL, 0xd3f93b35435d7c4cULL,
+        0x9efa548d26e5a6e1ULL, 0xc47bc5014a1a6dafULL,
+        0xc6b8e9b0709f109aULL, 0x359ab6419ca1091bULL,
+        0xf867241c8cc6d4c0ULL, 0xc30163d203c94b62ULL,
+        0x9b407691d7fc44f8ULL, 0x79e0de63425dcf1dULL,
+        0xc21094364dfb5636ULL, 0x985915fc12f542e4ULL,
+        0xf294b943e17a2bc4ULL, 0x3e6f5b7b17b2939dULL,
+        0x979cf3ca6cec5b5aULL, 0xa705992ceecf9c42ULL,
+        0xbd8430bd08277231ULL, 0x50c6ff782a838353ULL,
+        0xece53cec4a314ebdULL, 0xa4f8bf5635246428ULL,
+        0x940f4613ae5ed136ULL, 0x871b7795e136be99ULL,
+        0xb913179899f68584ULL, 0x28e2557b59846e3fULL,
+        0xe757dd7ec07426e5ULL, 0x331aeada2fe589cfULL,
+        0x9096ea6f3848984fULL, 0x3ff0d2c85def7621ULL,
+        0xb4bca50b065abe63ULL, 0x0fed077a756b53a9ULL,
+        0xe1ebce4dc7f16dfbULL, 0xd3e8495912c62894ULL,
+        0x8d3360f09cf6e4bdULL, 0x64712dd7abbbd95cULL,
+        0xb080392cc4349decULL, 0xbd8d794d96aacfb3ULL,
+        0xdca04777f541c567ULL, 0xecf0d7a0fc5583a0ULL,
+        0x89e42caaf9491b60ULL, 0xf41686c49db57244ULL,
+        0xac5d37d5b79b6239ULL, 0x311c2875c522ced5ULL,
+        0xd77485cb25823ac7ULL, 0x7d633293366b828bULL,
+        0x86a8d39ef77164bcULL, 0xae5dff9c02033197ULL,
+        0xa8530886b54dbdebULL, 0xd9f57f830283fdfcULL,
+        0xd267caa862a12d66ULL, 0xd072df63c324fd7bULL,
+        0x8380dea93da4bc60ULL, 0x4247cb9e59f71e6dULL,
+        0xa46116538d0deb78ULL, 0x52d9be85f074e608ULL,
+        0xcd795be870516656ULL, 0x67902e276c921f8bULL,
+        0x806bd9714632dff6ULL, 0x00ba1cd8a3db53b6ULL,
+        0xa086cfcd97bf97f3ULL, 0x80e8a40eccd228a4ULL,
+        0xc8a883c0fdaf7df0ULL, 0x6122cd128006b2cdULL,
+        0xfad2a4b13d1b5d6cULL, 0x796b805720085f81ULL,
+        0x9cc3a6eec6311a63ULL, 0xcbe3303674053bb0ULL,
+        0xc3f490aa77bd60fcULL, 0xbedbfc4411068a9cULL,
+        0xf4f1b4d515acb93bULL, 0xee92fb5515482d44ULL,
+        0x991711052d8bf3c5ULL, 0x751bdd152d4d1c4aULL,
+        0xbf5cd54678eef0b6ULL, 0xd262d45a78a0635dULL,
+        0xef340a98172aace4ULL, 0x86fb897116c87c34ULL,
+        0x9580869f0e7aac0eULL, 0xd45d35e6ae3d4da0ULL,
+        0xbae0a846d2195712ULL, 0x8974836059cca109ULL,
+        0xe998d258869facd7ULL, 0x2bd1a438703fc94bULL,
+        0x91ff83775423cc06ULL, 0x7b6306a34627ddcfULL,
+        0xb67f6455292cbf08ULL, 0x1a3bc84c17b1d542ULL,
+        0xe41f3d6a7377eecaULL, 0x20caba5f1d9e4a93ULL,
+        0x8e938662882af53eULL, 0x547eb47b7282ee9cULL,
+        0xb23867fb2a35b28dULL, 0xe99e619a4f23aa43ULL,
+        0xdec681f9f4c31f31ULL, 0x6405fa00e2ec94d4ULL,
+        0x8b3c113c38f9f37eULL, 0xde83bc408dd3dd04ULL,
+        0xae0b158b4738705eULL, 0x9624ab50b148d445ULL,
+        0xd98ddaee19068c76ULL, 0x3badd624dd9b0957ULL,
+        0x87f8a8d4cfa417c9ULL, 0xe54ca5d70a80e5d6ULL,
+        0xa9f6d30a038d1dbcULL, 0x5e9fcf4ccd211f4cULL,
+        0xd47487cc8470652bULL, 0x7647c3200069671fULL,
+        0x84c8d4dfd2c63f3bULL, 0x29ecd9f40041e073ULL,
+        0xa5fb0a17c777cf09ULL, 0xf468107100525890ULL,
+        0xcf79cc9db955c2ccULL, 0x7182148d4066eeb4ULL,
+        0x81ac1fe293d599bfULL, 0xc6f14cd848405530ULL,
+        0xa21727db38cb002fULL, 0xb8ada00e5a506a7cULL,
+        0xca9cf1d206fdc03bULL, 0xa6d90811f0e4851cULL,
+        0xfd442e4688bd304aULL, 0x908f4a166d1da663ULL,
+        0x9e4a9cec15763e2eULL, 0x9a598e4e043287feULL,
+        0xc5dd44271ad3cdbaULL, 0x40eff1e1853f29fdULL,
+        0xf7549530e188c128ULL, 0xd12bee59e68ef47cULL,
+        0x9a94dd3e8cf578b9ULL, 0x82bb74f8301958ceULL,
+        0xc13a148e3032d6e7ULL, 0xe36a52363c1faf01ULL,
+        0xf18899b1bc3f8ca1ULL, 0xdc44e6c3cb279ac1ULL,
+        0x96f5600f15a7b7e5ULL, 0x29ab103a5ef8c0b9ULL,
+        0xbcb2b812db11a5deULL, 0x7415d448f6b6f0e7ULL,
+        0xebdf661791d60f56ULL, 0x111b495b3464ad21ULL,
+        0x936b9fcebb25c995ULL, 0xcab10dd900beec34ULL,
+        0xb84687c269ef3bfbULL, 0x3d5d514f40eea742ULL,
+        0xe65829b3046b0afaULL, 0x0cb4a5a3112a5112ULL,
+        0x8ff71a0fe2c2e6dcULL, 0x47f0e785eaba72abULL,
+        0xb3f4e093db73a093ULL, 0x59ed216765690f56ULL,
+        0xe0f218b8d25088b8ULL, 0x306869c13ec3532cULL,
+        0x8c974f7383725573ULL, 0x1e414218c73a13fbULL,
+        0xafbd2350644eeacfULL, 0xe5d1929ef90898faULL,
+        0xdbac6c247d62a583ULL, 0xdf45f746b74abf39ULL,
+        0x894bc396ce5da772ULL, 0x6b8bba8c328eb783ULL,
+        0xab9eb47c81f5114fULL, 0x066ea92f3f326564ULL,
+        0xd686619ba27255a2ULL, 0xc80a537b0efefebdULL,
+        0x8613fd0145877585ULL, 0xbd06742ce95f5f36ULL,
+        0xa798fc4196e952e7ULL, 0x2c48113823b73704ULL,
+        0xd17f3b51fca3a7a0ULL, 0xf75a15862ca504c5ULL,
+        0x82ef85133de648c4ULL, 0x9a984d73dbe722fbULL,
+        0xa3ab66580d5fdaf5ULL, 0xc13e60d0d2e0ebbaULL,
+        0xcc963fee10b7d1b3ULL, 0x318df905079926a8ULL,
+        0xffbbcfe994e5c61fULL, 0xfdf17746497f7052ULL,
+        0x9fd561f1fd0f9bd3ULL, 0xfeb6ea8bedefa633ULL,
+        0xc7caba6e7c5382c8ULL, 0xfe64a52ee96b8fc0ULL,
+        0xf9bd690a1b68637bULL, 0x3dfdce7aa3c673b0ULL,
+        0x9c1661a651213e2dULL, 0x06bea10ca65c084eULL,
+        0xc31bfa0fe5698db8ULL, 0x486e494fcff30a62ULL,
+        0xf3e2f893dec3f126ULL, 0x5a89dba3c3efccfaULL,
+        0x986ddb5c6b3a76b7ULL, 0xf89629465a75e01cULL,
+        0xbe89523386091465ULL, 0xf6bbb397f1135823ULL,
+        0xee2ba6c0678b597fULL, 0x746aa07ded582e2cULL,
+        0x94db483840b717efULL, 0xa8c2a44eb4571cdcULL,
+        0xba121a4650e4ddebULL, 0x92f34d62616ce413ULL,
+        0xe896a0d7e51e1566ULL, 0x77b020baf9c81d17ULL,
+        0x915e2486ef32cd60ULL, 0x0ace1474dc1d122eULL,
+        0xb5b5ada8aaff80b8ULL, 0x0d819992132456baULL,
+        0xe3231912d5bf60e6ULL, 0x10e1fff697ed6c69ULL,
+        0x8df5efabc5979c8fULL, 0xca8d3ffa1ef463c1ULL,
+        0xb1736b96b6fd83b3ULL, 0xbd308ff8a6b17cb2ULL,
+        0xddd0467c64bce4a0ULL, 0xac7cb3f6d05ddbdeULL,
+        0x8aa22c0dbef60ee4ULL, 0x6bcdf07a423aa96bULL,
+        0xad4ab7112eb3929dULL, 0x86c16c98d2c953c6ULL,
+        0xd89d64d57a607744ULL, 0xe871c7bf077ba8b7ULL,
+        0x87625f056c7c4a8bULL, 0x11471cd764ad4972ULL,
+        0xa93af6c6c79b5d2dULL, 0xd598e40d3dd89bcfULL,
+        0xd389b47879823479ULL, 0x4aff1d108d4ec2c3ULL,
+        0x843610cb4bf160cbULL, 0xcedf722a585139baULL,
+        0xa54394fe1eedb8feULL, 0xc2974eb4ee658828ULL,
+        0xce947a3da6a9273eULL, 0x733d226229feea32ULL,
+        0x811ccc668829b887ULL, 0x0806357d5a3f525fULL,
+        0xa163ff802a3426a8ULL, 0xca07c2dcb0cf26f7ULL,
+        0xc9bcff6034c13052ULL, 0xfc89b393dd02f0b5ULL,
+        0xfc2c3f3841f17c67ULL, 0xbbac2078d443ace2ULL,
+        0x9d9ba7832936edc0ULL, 0xd54b944b84aa4c0dULL,
+        0xc5029163f384a931ULL, 0x0a9e795e65d4df11ULL,
+        0xf64335bcf065d37dULL, 0x4d4617b5ff4a16d5ULL,
+        0x99ea0196163fa42eULL, 0x504bced1bf8e4e45ULL,
+        0xc06481fb9bcf8d39ULL, 0xe45ec2862f71e1d6ULL,
+        0xf07da27a82c37088ULL, 0x5d767327bb4e5a4cULL,
+        0x964e858c91ba2655ULL, 0x3a6a07f8d510f86fULL,
+        0xbbe226efb628afeaULL, 0x890489f70a55368bULL,
+        0xeadab0aba3b2dbe5ULL, 0x2b45ac74ccea842eULL,
+        0x92c8ae6b464fc96fULL, 0x3b0b8bc90012929dULL,
+        0xb77ada0617e3bbcbULL, 0x09ce6ebb40173744ULL,
+        0xe55990879ddcaabdULL, 0xcc420a6a101d0515ULL,
+        0x8f57fa54c2a9eab6ULL, 0x9fa946824a12232dULL,
+        0xb32df8e9f3546564ULL, 0x47939822dc96abf9ULL,
+        0xdff9772470297ebdULL, 0x59787e2b93bc56f7ULL,
+        0x8bfbea76c619ef36ULL, 0x57eb4edb3c55b65aULL,
+        0xaefae51477a06b03ULL, 0xede622920b6b23f1ULL,
+        0xdab99e59958885c4ULL, 0xe95fab368e45ecedULL,
+        0x88b402f7fd75539bULL, 0x11dbcb0218ebb414ULL,
+        0xaae103b5fcd2a881ULL, 0xd652bdc29f26a119ULL,
+        0xd59944a37c0752a2ULL, 0x4be76d3346f0495fULL,
+        0x857fcae62d8493a5ULL, 0x6f70a4400c562ddbULL,
+        0xa6dfbd9fb8e5b88eULL, 0xcb4ccd500f6bb952ULL,
+        0xd097ad07a71f26b2ULL, 0x7e2000a41346a7a7ULL,
+        0x825ecc24c873782fULL, 0x8ed400668c0c28c8ULL,
+        0xa2f67f2dfa90563bULL, 0x728900802f0f32faULL,
+        0xcbb41ef979346bcaULL, 0x4f2b40a03ad2ffb9ULL,
+        0xfea126b7d78186bcULL, 0xe2f610c84987bfa8ULL,
+        0x9f24b832e6b0f436ULL, 0x0dd9ca7d2df4d7c9ULL,
+        0xc6ede63fa05d3143ULL, 0x91503d1c79720dbbULL,
+        0xf8a95fcf88747d94ULL, 0x75a44c6397ce912aULL,
+        0x9b69dbe1b548ce7cULL, 0xc986afbe3ee11abaULL,
+        0xc24452da229b021bULL, 0xfbe85badce996168ULL,
+        0xf2d56790ab41c2a2ULL, 0xfae27299423fb9c3ULL,
+        0x97c560ba6b0919a5ULL, 0xdccd879fc967d41aULL,
+        0xbdb6b8e905cb600fULL, 0x5400e987bbc1c920ULL,
+        0xed246723473e3813ULL, 0x290123e9aab23b68ULL,
+        0x9436c0760c86e30bULL, 0xf9a0b6720aaf6521ULL,
+        0xb94470938fa89bceULL, 0xf808e40e8d5b3e69ULL,
+        0xe7958cb87392c2c2ULL, 0xb60b1d1230b20e04ULL,
+        0x90bd77f3483bb9b9ULL, 0xb1c6f22b5e6f48c2ULL,
+        0xb4ecd5f01a4aa828ULL, 0x1e38aeb6360b1af3ULL,
+        0xe2280b6c20dd5232ULL, 0x25c6da63c38de1b0ULL,
+        0x8d590723948a535fULL, 0x579c487e5a38ad0eULL,
+        0xb0af48ec79ace837ULL, 0x2d835a9df0c6d851ULL,
+        0xdcdb1b2798182244ULL, 0xf8e431456cf88e65ULL,
+        0x8a08f0f8bf0f156bULL, 0x1b8e9ecb641b58ffULL,
+        0xac8b2d36eed2dac5ULL, 0xe272467e3d222f3fULL,
+        0xd7adf884aa879177ULL, 0x5b0ed81dcc6abb0fULL,
+        0x86ccbb52ea94baeaULL, 0x98e947129fc2b4e9ULL,
+        0xa87fea27a539e9a5ULL, 0x3f2398d747b36224ULL,
+        0xd29fe4b18e88640eULL, 0x8eec7f0d19a03aadULL,
+        0x83a3eeeef9153e89ULL, 0x1953cf68300424acULL,
+        0xa48ceaaab75a8e2bULL, 0x5fa8c3423c052dd7ULL,
+        0xcdb02555653131b6ULL, 0x3792f412cb06794dULL,
+        0x808e17555f3ebf11ULL, 0xe2bbd88bbee40bd0ULL,
+        0xa0b19d2ab70e6ed6ULL, 0x5b6aceaeae9d0ec4ULL,
+        0xc8de047564d20a8bULL, 0xf245825a5a445275ULL,
+        0xfb158592be068d2eULL, 0xeed6e2f0f0d56712ULL,
+        0x9ced737bb6c4183dULL, 0x55464dd69685606bULL,
+        0xc428d05aa4751e4cULL, 0xaa97e14c3c26b886ULL,
+        0xf53304714d9265dfULL, 0xd53dd99f4b3066a8ULL,
+        0x993fe2c6d07b7fabULL, 0xe546a8038efe4029ULL,
+        0xbf8fdb78849a5f96ULL, 0xde98520472bdd033ULL,
+        0xef73d256a5c0f77cULL, 0x963e66858f6d4440ULL,
+        0x95a8637627989aadULL, 0xdde7001379a44aa8ULL,
+        0xbb127c53b17ec159ULL, 0x5560c018580d5d52ULL,
+        0xe9d71b689dde71afULL, 0xaab8f01e6e10b4a6ULL,
+        0x9226712162ab070dULL, 0xcab3961304ca70e8ULL,
+        0xb6b00d69bb55c8d1ULL, 0x3d607b97c5fd0d22ULL,
+        0xe45c10c42a2b3b05ULL, 0x8cb89a7db77c506aULL,
+        0x8eb98a7a9a5b04e3ULL, 0x77f3608e92adb242ULL,
+        0xb267ed1940f1c61cULL, 0x55f038b237591ed3ULL,
+        0xdf01e85f912e37a3ULL, 0x6b6c46dec52f6688ULL,
+        0x8b61313bbabce2c6ULL, 0x2323ac4b3b3da015ULL,
+        0xae397d8aa96c1b77ULL, 0xabec975e0a0d081aULL,
+        0xd9c7dced53c72255ULL, 0x96e7bd358c904a21ULL,
+        0x881cea14545c7575ULL, 0x7e50d64177da2e54ULL,
+        0xaa242499697392d2ULL, 0xdde50bd1d5d0b9e9ULL,
+        0xd4ad2dbfc3d07787ULL, 0x955e4ec64b44e864ULL,
+        0x84ec3c97da624ab4ULL, 0xbd5af13bef0b113eULL,
+        0xa6274bbdd0fadd61ULL, 0xecb1ad8aeacdd58eULL,
+        0xcfb11ead453994baULL, 0x67de18eda5814af2ULL,
+        0x81ceb32c4b43fcf4ULL, 0x80eacf948770ced7ULL,
+        0xa2425ff75e14fc31ULL, 0xa1258379a94d028dULL,
+        0xcad2f7f5359a3b3eULL, 0x096ee45813a04330ULL,
+        0xfd87b5f28300ca0dULL, 0x8bca9d6e188853fcULL,
+        0x9e74d1b791e07e48ULL, 0x775ea264cf55347eULL,
+        0xc612062576589ddaULL, 0x95364afe032a819eULL,
+        0xf79687aed3eec551ULL, 0x3a83ddbd83f52205ULL,
+        0x9abe14cd44753b52ULL, 0xc4926a9672793543ULL,
+        0xc16d9a0095928a27ULL, 0x75b7053c0f178294ULL,
+        0xf1c90080baf72cb1ULL, 0x5324c68b12dd6339ULL,
+        0x971da05074da7beeULL, 0xd3f6fc16ebca5e04ULL,
+        0xbce5086492111aeaULL, 0x88f4bb1ca6bcf585ULL,
+        0xec1e4a7db69561a5ULL, 0x2b31e9e3d06c32e6ULL,
+        0x9392ee8e921d5d07ULL, 0x3aff322e62439fd0ULL,
+        0xb877aa3236a4b449ULL, 0x09befeb9fad487c3ULL,
+        0xe69594bec44de15bULL, 0x4c2ebe687989a9b4ULL,
+        0x901d7cf73ab0acd9ULL, 0x0f9d37014bf60a11ULL,
+        0xb424dc35095cd80fULL, 0x538484c19ef38c95ULL,
+        0xe12e13424bb40e13ULL, 0x2865a5f206b06fbaULL,
+        0x8cbccc096f5088cbULL, 0xf93f87b7442e45d4ULL,
+        0xafebff0bcb24aafeULL, 0xf78f69a51539d749ULL,
+        0xdbe6fecebdedd5beULL, 0xb573440e5a884d1cULL,
+        0x89705f4136b4a597ULL, 0x31680a88f8953031ULL,
+        0xabcc77118461cefcULL, 0xfdc20d2b36ba7c3eULL,
+        0xd6bf94d5e57a42bcULL, 0x3d32907604691b4dULL,
+        0x8637bd05af6c69b5ULL, 0xa63f9a49c2c1b110ULL,
+        0xa7c5ac471b478423ULL, 0x0fcf80dc33721d54ULL,
+        0xd1b71758e219652bULL, 0xd3c36113404ea4a9ULL,
+        0x83126e978d4fdf3bULL, 0x645a1cac083126eaULL,
+        0xa3d70a3d70a3d70aULL, 0x3d70a3d70a3d70a4ULL,
+        0xccccccccccccccccULL, 0xcccccccccccccccdULL,
+        0x8000000000000000ULL, 0x0000000000000000ULL,
+        0xa000000000000000ULL, 0x0000000000000000ULL,
+        0xc800000000000000ULL, 0x0000000000000000ULL,
+        0xfa00000000000000ULL, 0x0000000000000000ULL,
+        0x9c40000000000000ULL, 0x0000000000000000ULL,
+        0xc350000000000000ULL, 0x0000000000000000ULL,
+        0xf424000000000000ULL, 0x0000000000000000ULL,
+        0x9896800000000000ULL, 0x0000000000000000ULL,
+        0xbebc200000000000ULL, 0x0000000000000000ULL,
+        0xee6b280000000000ULL, 0x0000000000000000ULL,
+        0x9502f90000000000ULL, 0x0000000000000000ULL,
+        0xba43b74000000000ULL, 0x0000000000000000ULL,
+        0xe8d4a51000000000ULL, 0x0000000000000000ULL,
+        0x9184e72a00000000ULL, 0x0000000000000000ULL,
+        0xb5e620f480000000ULL, 0x0000000000000000ULL,
+        0xe35fa931a0000000ULL, 0x0000000000000000ULL,
+        0x8e1bc9bf04000000ULL, 0x0000000000000000ULL,
+        0xb1a2bc2ec5000000ULL, 0x0000000000000000ULL,
+        0xde0b6b3a76400000ULL, 0x0000000000000000ULL,
+        0x8ac7230489e80000ULL, 0x0000000000000000ULL,
+        0xad78ebc5ac620000ULL, 0x0000000000000000ULL,
+        0xd8d726b7177a8000ULL, 0x0000000000000000ULL,
+        0x878678326eac9000ULL, 0x0000000000000000ULL,
+        0xa968163f0a57b400ULL, 0x0000000000000000ULL,
+        0xd3c21bcecceda100ULL, 0x0000000000000000ULL,
+        0x84595161401484a0ULL, 0x0000000000000000ULL,
+        0xa56fa5b99019a5c8ULL, 0x0000000000000000ULL,
+        0xcecb8f27f4200f3aULL, 0x0000000000000000ULL,
+        0x813f3978f8940984ULL, 0x4000000000000000ULL,
+        0xa18f07d736b90be5ULL, 0x5000000000000000ULL,
+        0xc9f2c9cd04674edeULL, 0xa400000000000000ULL,
+        0xfc6f7c4045812296ULL, 0x4d00000000000000ULL,
+        0x9dc5ada82b70b59dULL, 0xf020000000000000ULL,
+        0xc5371912364ce305ULL, 0x6c28000000000000ULL,
+        0xf684df56c3e01bc6ULL, 0xc732000000000000ULL,
+        0x9a130b963a6c115cULL, 0x3c7f400000000000ULL,
+        0xc097ce7bc90715b3ULL, 0x4b9f100000000000ULL,
+        0xf0bdc21abb48db20ULL, 0x1e86d40000000000ULL,
+        0x96769950b50d88f4ULL, 0x1314448000000000ULL,
+        0xbc143fa4e250eb31ULL, 0x17d955a000000000ULL,
+        0xeb194f8e1ae525fdULL, 0x5dcfab0800000000ULL,
+        0x92efd1b8d0cf37beULL, 0x5aa1cae500000000ULL,
+        0xb7abc627050305adULL, 0xf14a3d9e40000000ULL,
+        0xe596b7b0c643c719ULL, 0x6d9ccd05d0000000ULL,
+        0x8f7e32ce7bea5c6fULL, 0xe4820023a2000000ULL,
+        0xb35dbf821ae4f38bULL, 0xdda2802c8a800000ULL,
+        0xe0352f62a19e306eULL, 0xd50b2037ad200000ULL,
+        0x8c213d9da502de45ULL, 0x4526f422cc340000ULL,
+        0xaf298d050e4395d6ULL, 0x9670b12b7f410000ULL,
+        0xdaf3f04651d47b4cULL, 0x3c0cdd765f114000ULL,
+        0x88d8762bf324cd0fULL, 0xa5880a69fb6ac800ULL,
+        0xab0e93b6efee0053ULL, 0x8eea0d047a457a00ULL,
+        0xd5d238a4abe98068ULL, 0x72a4904598d6d880ULL,
+        0x85a36366eb71f041ULL, 0x47a6da2b7f864750ULL,
+        0xa70c3c40a64e6c51ULL, 0x999090b65f67d924ULL,
+        0xd0cf4b50cfe20765ULL, 0xfff4b4e3f741cf6dULL,
+        0x82818f1281ed449fULL, 0xbff8f10e7a8921a4ULL,
+        0xa321f2d7226895c7ULL, 0xaff72d52192b6a0dULL,
+        0xcbea6f8ceb02bb39ULL, 0x9bf4f8a69f764490ULL,
+        0xfee50b7025c36a08ULL, 0x02f236d04753d5b4ULL,
+        0x9f4f2726179a2245ULL, 0x01d762422c946590ULL,
+        0xc722f0ef9d80aad6ULL, 0x424d3ad2b7b97ef5ULL,
+        0xf8ebad2b84e0d58bULL, 0xd2e0898765a7deb2ULL,
+        0x9b934c3b330c8577ULL, 0x63cc55f49f88eb2fULL,
+        0xc2781f49ffcfa6d5ULL, 0x3cbf6b71c76b25fbULL,
+        0xf316271c7fc3908aULL, 0x8bef464e3945ef7aULL,
+        0x97edd871cfda3a56ULL, 0x97758bf0e3cbb5acULL,
+        0xbde94e8e43d0c8ecULL, 0x3d52eeed1cbea317ULL,
+        0xed63a231d4c4fb27ULL, 0x4ca7aaa863ee4bddULL,
+        0x945e455f24fb1cf8ULL, 0x8fe8caa93e74ef6aULL,
+        0xb975d6b6ee39e436ULL, 0xb3e2fd538e122b44ULL,
+        0xe7d34c64a9c85d44ULL, 0x60dbbca87196b616ULL,
+        0x90e40fbeea1d3a4aULL, 0xbc8955e946fe31cdULL,
+        0xb51d13aea4a488ddULL, 0x6babab6398bdbe41ULL,
+        0xe264589a4dcdab14ULL, 0xc696963c7eed2dd1ULL,
+        0x8d7eb76070a08aecULL, 0xfc1e1de5cf543ca2ULL,
+        0xb0de65388cc8ada8ULL, 0x3b25a55f43294bcbULL,
+        0xdd15fe86affad912ULL, 0x49ef0eb713f39ebeULL,
+        0x8a2dbf142dfcc7abULL, 0x6e3569326c784337ULL,
+        0xacb92ed9397bf996ULL, 0x49c2c37f07965404ULL,
+        0xd7e77a8f87daf7fbULL, 0xdc33745ec97be906ULL,
+        0x86f0ac99b4e8dafdULL, 0x69a028bb3ded71a3ULL,
+        0xa8acd7c0222311bcULL, 0xc40832ea0d68ce0cULL,
+        0xd2d80db02aabd62bULL, 0xf50a3fa490c30190ULL,
+        0x83c7088e1aab65dbULL, 0x792667c6da79e0faULL,
+        0xa4b8cab1a1563f52ULL, 0x577001b891185938ULL,
+        0xcde6fd5e09abcf26ULL, 0xed4c0226b55e6f86ULL,
+        0x80b05e5ac60b6178ULL, 0x544f8158315b05b4ULL,
+        0xa0dc75f1778e39d6ULL, 0x696361ae3db1c721ULL,
+        0xc913936dd571c84cULL, 0x03bc3a19cd1e38e9ULL,
+        0xfb5878494ace3a5fULL, 0x04ab48a04065c723ULL,
+        0x9d174b2dcec0e47bULL, 0x62eb0d64283f9c76ULL,
+        0xc45d1df942711d9aULL, 0x3ba5d0bd324f8394ULL,
+        0xf5746577930d6500ULL, 0xca8f44ec7ee36479ULL,
+        0x9968bf6abbe85f20ULL, 0x7e998b13cf4e1ecbULL,
+        0xbfc2ef456ae276e8ULL, 0x9e3fedd8c321a67eULL,
+        0xefb3ab16c59b14a2ULL, 0xc5cfe94ef3ea101eULL,
+        0x95d04aee3b80ece5ULL, 0xbba1f1d158724a12ULL,
+        0xbb445da9ca61281fULL, 0x2a8a6e45ae8edc97ULL,
+        0xea1575143cf97226ULL, 0xf52d09d71a3293bdULL,
+        0x924d692ca61be758ULL, 0x593c2626705f9c56ULL,
+        0xb6e0c377cfa2e12eULL, 0x6f8b2fb00c77836cULL,
+        0xe498f455c38b997aULL, 0x0b6dfb9c0f956447ULL,
+        0x8edf98b59a373fecULL, 0x4724bd4189bd5eacULL,
+        0xb2977ee300c50fe7ULL, 0x58edec91ec2cb657ULL,
+        0xdf3d5e9bc0f653e1ULL, 0x2f2967b66737e3edULL,
+        0x8b865b215899f46cULL, 0xbd79e0d20082ee74ULL,
+        0xae67f1e9aec07187ULL, 0xecd8590680a3aa11ULL,
+        0xda01ee641a708de9ULL, 0xe80e6f4820cc9495ULL,
+        0x884134fe908658b2ULL, 0x3109058d147fdcddULL,
+        0xaa51823e34a7eedeULL, 0xbd4b46f0599fd415ULL,
+        0xd4e5e2cdc1d1ea96ULL, 0x6c9e18ac7007c91aULL,
+        0x850fadc09923329eULL, 0x03e2cf6bc604ddb0ULL,
+        0xa6539930bf6bff45ULL, 0x84db8346b786151cULL,
+        0xcfe87f7cef46ff16ULL, 0xe612641865679a63ULL,
+        0x81f14fae158c5f6eULL, 0x4fcb7e8f3f60c07eULL,
+        0xa26da3999aef7749ULL, 0xe3be5e330f38f09dULL,
+        0xcb090c8001ab551cULL, 0x5cadf5bfd3072cc5ULL,
+        0xfdcb4fa002162a63ULL, 0x73d9732fc7c8f7f6ULL,
+        0x9e9f11c4014dda7eULL, 0x2867e7fddcdd9afaULL,
+        0xc646d63501a1511dULL, 0xb281e1fd541501b8ULL,
+        0xf7d88bc24209a565ULL, 0x1f225a7ca91a4226ULL,
+        0x9ae757596946075fULL, 0x3375788de9b06958ULL,
+        0xc1a12d2fc3978937ULL, 0x0052d6b1641c83aeULL,
+        0xf209787bb47d6b84ULL, 0xc0678c5dbd23a49aULL,
+        0x9745eb4d50ce6332ULL, 0xf840b7ba963646e0ULL,
+        0xbd176620a501fbffULL, 0xb650e5a93bc3d898ULL,
+        0xec5d3fa8ce427affULL, 0xa3e51f138ab4cebeULL,
+        0x93ba47c980e98cdfULL, 0xc66f336c36b10137ULL,
+        0xb8a8d9bbe123f017ULL, 0xb80b0047445d4184ULL,
+        0xe6d3102ad96cec1dULL, 0xa60dc059157491e5ULL,
+        0x9043ea1ac7e41392ULL, 0x87c89837ad68db2fULL,
+        0xb454e4a179dd1877ULL, 0x29babe4598c311fbULL,
+        0xe16a1dc9d8545e94ULL, 0xf4296dd6fef3d67aULL,
+        0x8ce2529e2734bb1dULL, 0x1899e4a65f58660cULL,
+        0xb01ae745b101e9e4ULL, 0x5ec05dcff72e7f8fULL,
+        0xdc21a1171d42645dULL, 0x76707543f4fa1f73ULL,
+        0x899504ae72497ebaULL, 0x6a06494a791c53a8ULL,
+        0xabfa45da0edbde69ULL, 0x0487db9d17636892ULL,
+        0xd6f8d7509292d603ULL, 0x45a9d2845d3c42b6ULL,
+        0x865b86925b9bc5c2ULL, 0x0b8a2392ba45a9b2ULL,
+        0xa7f26836f282b732ULL, 0x8e6cac7768d7141eULL,
+        0xd1ef0244af2364ffULL, 0x3207d795430cd926ULL,
+        0x8335616aed761f1fULL, 0x7f44e6bd49e807b8ULL,
+        0xa402b9c5a8d3a6e7ULL, 0x5f16206c9c6209a6ULL,
+        0xcd036837130890a1ULL, 0x36dba887c37a8c0fULL,
+        0x802221226be55a64ULL, 0xc2494954da2c9789ULL,
+        0xa02aa96b06deb0fdULL, 0xf2db9baa10b7bd6cULL,
+        0xc83553c5c8965d3dULL, 0x6f92829494e5acc7ULL,
+        0xfa42a8b73abbf48cULL, 0xcb772339ba1f17f9ULL,
+        0x9c69a97284b578d7ULL, 0xff2a760414536efbULL,
+        0xc38413cf25e2d70dULL, 0xfef5138519684abaULL,
+        0xf46518c2ef5b8cd1ULL, 0x7eb258665fc25d69ULL,
+        0x98bf2f79d5993802ULL, 0xef2f773ffbd97a61ULL,
+        0xbeeefb584aff8603ULL, 0xaafb550ffacfd8faULL,
+        0xeeaaba2e5dbf6784ULL, 0x95ba2a53f983cf38ULL,
+        0x952ab45cfa97a0b2ULL, 0xdd945a747bf26183ULL,
+        0xba756174393d88dfULL, 0x94f971119aeef9e4ULL,
+        0xe912b9d1478ceb17ULL, 0x7a37cd5601aab85dULL,
+        0x91abb422ccb812eeULL, 0xac62e055c10ab33aULL,
+        0xb616a12b7fe617aaULL, 0x577b986b314d6009ULL,
+        0xe39c49765fdf9d94ULL, 0xed5a7e85fda0b80bULL,
+        0x8e41ade9fbebc27dULL, 0x14588f13be847307ULL,
+        0xb1d219647ae6b31cULL, 0x596eb2d8ae258fc8ULL,
+        0xde469fbd99a05fe3ULL, 0x6fca5f8ed9aef3bbULL,
+        0x8aec23d680043beeULL, 0x25de7bb9480d5854ULL,
+        0xada72ccc20054ae9ULL, 0xaf561aa79a10ae6aULL,
+        0xd910f7ff28069da4ULL, 0x1b2ba1518094da04ULL,
+        0x87aa9aff79042286ULL, 0x90fb44d2f05d0842ULL,
+        0xa99541bf57452b28ULL, 0x353a1607ac744a53ULL,
+        0xd3fa922f2d1675f2ULL, 0x42889b8997915ce8ULL,
+        0x847c9b5d7c2e09b7ULL, 0x69956135febada11ULL,
+        0xa59bc234db398c25ULL, 0x43fab9837e699095ULL,
+        0xcf02b2c21207ef2eULL, 0x94f967e45e03f4bbULL,
+        0x8161afb94b44f57dULL, 0x1d1be0eebac278f5ULL,
+        0xa1ba1ba79e1632dcULL, 0x6462d92a69731732ULL,
+        0xca28a291859bbf93ULL, 0x7d7b8f7503cfdcfeULL,
+        0xfcb2cb35e702af78ULL, 0x5cda735244c3d43eULL,
+        0x9defbf01b061adabULL, 0x3a0888136afa64a7ULL,
+        0xc56baec21c7a1916ULL, 0x088aaa1845b8fdd0ULL,
+        0xf6c69a72a3989f5bULL, 0x8aad549e57273d45ULL,
+        0x9a3c2087a63f6399ULL, 0x36ac54e2f678864bULL,
+        0xc0cb28a98fcf3c7fULL, 0x84576a1bb416a7ddULL,
+        0xf0fdf2d3f3c30b9fULL, 0x656d44a2a11c51d5ULL,
+        0x969eb7c47859e743ULL, 0x9f644ae5a4b1b325ULL,
+        0xbc4665b596706114ULL, 0x873d5d9f0dde1feeULL,
+        0xeb57ff22fc0c7959ULL, 0xa90cb506d155a7eaULL,
+        0x9316ff75dd87cbd8ULL, 0x09a7f12442d588f2ULL,
+        0xb7dcbf5354e9beceULL, 0x0c11ed6d538aeb2fULL,
+        0xe5d3ef282a242e81ULL, 0x8f1668c8a86da5faULL,
+        0x8fa475791a569d10ULL, 0xf96e017d694487bcULL,
+        0xb38d92d760ec4455ULL, 0x37c981dcc395a9acULL,
+        0xe070f78d3927556aULL, 0x85bbe253f47b1417ULL,
+        0x8c469ab843b89562ULL, 0x93956d7478ccec8eULL,
+        0xaf58416654a6babbULL, 0x387ac8d1970027b2ULL,
+        0xdb2e51bfe9d0696aULL, 0x06997b05fcc0319eULL,
+        0x88fcf317f22241e2ULL, 0x441fece3bdf81f03ULL,
+        0xab3c2fddeeaad25aULL, 0xd527e81cad7626c3ULL,
+        0xd60b3bd56a5586f1ULL, 0x8a71e223d8d3b074ULL,
+        0x85c7056562757456ULL, 0xf6872d5667844e49ULL,
+        0xa738c6bebb12d16cULL, 0xb428f8ac016561dbULL,
+        0xd106f86e69d785c7ULL, 0xe13336d701beba52ULL,
+        0x82a45b450226b39cULL, 0xecc0024661173473ULL,
+        0xa34d721642b06084ULL, 0x27f002d7f95d0190ULL,
+        0xcc20ce9bd35c78a5ULL, 0x31ec038df7b441f4ULL,
+        0xff290242c83396ceULL, 0x7e67047175a15271ULL,
+        0x9f79a169bd203e41ULL, 0x0f0062c6e984d386ULL,
+        0xc75809c42c684dd1ULL, 0x52c07b78a3e60868ULL,
+        0xf92e0c3537826145ULL, 0xa7709a56ccdf8a82ULL,
+        0x9bbcc7a142b17ccbULL, 0x88a66076400bb691ULL,
+        0xc2abf989935ddbfeULL, 0x6acff893d00ea435ULL,
+        0xf356f7ebf83552feULL, 0x0583f6b8c4124d43ULL,
+        0x98165af37b2153deULL, 0xc3727a337a8b704aULL,
+        0xbe1bf1b059e9a8d6ULL, 0x744f18c0592e4c5cULL,
+        0xeda2ee1c7064130cULL, 0x1162def06f79df73ULL,
+        0x9485d4d1c63e8be7ULL, 0x8addcb5645ac2ba8ULL,
+        0xb9a74a0637ce2ee1ULL, 0x6d953e2bd7173692ULL,
+        0xe8111c87c5c1ba99ULL, 0xc8fa8db6ccdd0437ULL,
+        0x910ab1d4db9914a0ULL, 0x1d9c9892400a22a2ULL,
+        0xb54d5e4a127f59c8ULL, 0x2503beb6d00cab4bULL,
+        0xe2a0b5dc971f303aULL, 0x2e44ae64840fd61dULL,
+        0x8da471a9de737e24ULL, 0x5ceaecfed289e5d2ULL,
+        0xb10d8e1456105dadULL, 0x7425a83e872c5f47ULL,
+        0xdd50f1996b947518ULL, 0xd12f124e28f77719ULL,
+        0x8a5296ffe33cc92fULL, 0x82bd6b70d99aaa6fULL,
+        0xace73cbfdc0bfb7bULL, 0x636cc64d1001550bULL,
+        0xd8210befd30efa5aULL, 0x3c47f7e05401aa4eULL,
+        0x8714a775e3e95c78ULL, 0x65acfaec34810a71ULL,
+        0xa8d9d1535ce3b396ULL, 0x7f1839a741a14d0dULL,
+        0xd31045a8341ca07cULL, 0x1ede48111209a050ULL,
+        0x83ea2b892091e44dULL, 0x934aed0aab460432ULL,
+        0xa4e4b66b68b65d60ULL, 0xf81da84d5617853fULL,
+        0xce1de40642e3f4b9ULL, 0x36251260ab9d668eULL,
+        0x80d2ae83e9ce78f3ULL, 0xc1d72b7c6b426019ULL,
+        0xa1075a24e4421730ULL, 0xb24cf65b8612f81fULL,
+        0xc94930ae1d529cfcULL, 0xdee033f26797b627ULL,
+        0xfb9b7cd9a4a7443cULL, 0x169840ef017da3b1ULL,
+        0x9d412e0806e88aa5ULL, 0x8e1f289560ee864eULL,
+        0xc491798a08a2ad4eULL, 0xf1a6f2bab92a27e2ULL,
+        0xf5b5d7ec8acb58a2ULL, 0xae10af696774b1dbULL,
+        0x9991a6f3d6bf1765ULL, 0xacca6da1e0a8ef29ULL,
+        0xbff610b0cc6edd3fULL, 0x17fd090a58d32af3ULL,
+        0xeff394dcff8a948eULL, 0xddfc4b4cef07f5b0ULL,
+        0x95f83d0a1fb69cd9ULL, 0x4abdaf101564f98eULL,
+        0xbb764c4ca7a4440fULL, 0x9d6d1ad41abe37f1ULL,
+        0xea53df5fd18d5513ULL, 0x84c86189216dc5edULL,
+        0x92746b9be2f8552cULL, 0x32fd3cf5b4e49bb4ULL,
+        0xb7118682dbb66a77ULL, 0x3fbc8c33221dc2a1ULL,
+        0xe4d5e82392a40515ULL, 0x0fabaf3feaa5334aULL,
+        0x8f05b1163ba6832dULL, 0x29cb4d87f2a7400eULL,
+        0xb2c71d5bca9023f8ULL, 0x743e20e9ef511012ULL,
+        0xdf78e4b2bd342cf6ULL, 0x914da9246b255416ULL,
+        0x8bab8eefb6409c1aULL, 0x1ad089b6c2f7548eULL,
+        0xae9672aba3d0c320ULL, 0xa184ac2473b529b1ULL,
+        0xda3c0f568cc4f3e8ULL, 0xc9e5d72d90a2741eULL,
+        0x8865899617fb1871ULL, 0x7e2fa67c7a658892ULL,
+        0xaa7eebfb9df9de8dULL, 0xddbb901b98feeab7ULL,
+        0xd51ea6fa85785631ULL, 0x552a74227f3ea565ULL,
+        0x8533285c936b35deULL, 0xd53a88958f87275fULL,
+        0xa67ff273b8460356ULL, 0x8a892abaf368f137ULL,
+        0xd01fef10a657842cULL, 0x2d2b7569b0432d85ULL,
+        0x8213f56a67f6b29bULL, 0x9c3b29620e29fc73ULL,
+        0xa298f2c501f45f42ULL, 0x8349f3ba91b47b8fULL,
+        0xcb3f2f7642717713ULL, 0x241c70a936219a73ULL,
+        0xfe0efb53d30dd4d7ULL, 0xed238cd383aa0110ULL,
+        0x9ec95d1463e8a506ULL, 0xf4363804324a40aaULL,
+        0xc67bb4597ce2ce48ULL, 0xb143c6053edcd0d5ULL,
+        0xf81aa16fdc1b81daULL, 0xdd94b7868e94050aULL,
+        0x9b10a4e5e9913128ULL, 0xca7cf2b4191c8326ULL,
+        0xc1d4ce1f63f57d72ULL, 0xfd1c2f611f63a3f0ULL,
+        0xf24a01a73cf2dccfULL, 0xbc633b39673c8cecULL,
+        0x976e41088617ca01ULL, 0xd5be0503e085d813ULL,
+        0xbd49d14aa79dbc82ULL, 0x4b2d8644d8a74e18ULL,
+        0xec9c459d51852ba2ULL, 0xddf8e7d60ed1219eULL,
+        0x93e1ab8252f33b45ULL, 0xcabb90e5c942b503ULL,
+        0xb8da1662e7b00a17ULL, 0x3d6a751f3b936243ULL,
+        0xe7109bfba19c0c9dULL, 0x0cc512670a783ad4ULL,
+        0x906a617d450187e2ULL, 0x27fb2b80668b24c5ULL,
+        0xb484f9dc9641e9daULL, 0xb1f9f660802dedf6ULL,
+        0xe1a63853bbd26451ULL, 0x5e7873f8a0396973ULL,
+        0x8d07e33455637eb2ULL, 0xdb0b487b6423e1e8ULL,
+        0xb049dc016abc5e5fULL, 0x91ce1a9a3d2cda62ULL,
+        0xdc5c5301c56b75f7ULL, 0x7641a140cc7810fbULL,
+        0x89b9b3e11b6329baULL, 0xa9e904c87fcb0a9dULL,
+        0xac2820d9623bf429ULL, 0x546345fa9fbdcd44ULL,
+        0xd732290fbacaf133ULL, 0xa97c177947ad4095ULL,
+        0x867f59a9d4bed6c0ULL, 0x49ed8eabcccc485dULL,
+        0xa81f301449ee8c70ULL, 0x5c68f256bfff5a74ULL,
+        0xd226fc195c6a2f8cULL, 0x73832eec6fff3111ULL,
+        0x83585d8fd9c25db7ULL, 0xc831fd53c5ff7eabULL,
+        0xa42e74f3d032f525ULL, 0xba3e7ca8b77f5e55ULL,
+        0xcd3a1230c43fb26fULL, 0x28ce1bd2e55f35ebULL,
+        0x80444b5e7aa7cf85ULL, 0x7980d163cf5b81b3ULL,
+        0xa0555e361951c366ULL, 0xd7e105bcc332621fULL,
+        0xc86ab5c39fa63440ULL, 0x8dd9472bf3fefaa7ULL,
+        0xfa856334878fc150ULL, 0xb14f98f6f0feb951ULL,
+        0x9c935e00d4b9d8d2ULL, 0x6ed1bf9a569f33d3ULL,
+        0xc3b8358109e84f07ULL, 0x0a862f80ec4700c8ULL,
+        0xf4a642e14c6262c8ULL, 0xcd27bb612758c0faULL,
+        0x98e7e9cccfbd7dbdULL, 0x8038d51cb897789cULL,
+        0xbf21e44003acdd2cULL, 0xe0470a63e6bd56c3ULL,
+        0xeeea5d5004981478ULL, 0x1858ccfce06cac74ULL,
+        0x95527a5202df0ccbULL, 0x0f37801e0c43ebc8ULL,
+        0xbaa718e68396cffdULL, 0xd30560258f54e6baULL,
+        0xe950df20247c83fdULL, 0x47c6b82ef32a2069ULL,
+        0x91d28b7416cdd27eULL, 0x4cdc331d57fa5441ULL,
+        0xb6472e511c81471dULL, 0xe0133fe4adf8e952ULL,
+        0xe3d8f9e563a198e5ULL, 0x58180fddd97723a6ULL,
+        0x8e679c2f5e44ff8fULL, 0x570f09eaa7ea7648ULL
+    };
+    return &table[2 * (q + 342)];
+}
+
+/* IEEE binary format parameters */
+typedef struct {
+    int explicit_bits;      /* Stored mantissa bits */
+    int min_exponent;       /* Negated exponent bias */
+    int inf_power;          /* Biased exponent of infinity */
+    int sign_shift;         /* Position of the sign bit */
+    int min_pow10;          /* w * 10^q with q below this is zero */
+    int max_pow10;          /* ... and above this is infinite */
+    int even_min;           /* Range of q where exact halfway ties can occur */
+    int even_max;
+} lr__fpfmt;
+
+/* Biased exponent and mantissa (implicit bit removed) of a result */
+typedef struct {
+    uint64_t mantissa;
+    int32_t power2;
+} lr__fpbits;
+
+/* Eisel-Lemire: correctly rounds w * 10^q for any w with at most 19 digits */
+static inline lr__fpbits lr__eisel_lemire(int64_t q, uint64_t w, const lr__fpfmt* f) {
+    lr__fpbits r;
+    const uint64_t* p5;
+    uint64_t lo, hi, lo2, hi2, precision_mask;
+    int lz, upperbit, shift;
+    
+    if (w == 0 || q < f->min_pow10) {
+        r.mantissa = 0;
+        r.power2 = 0;
+        return r;
+    }
+    if (q > f->max_pow10) {
+        r.mantissa = 0;
+        r.power2 = f->inf_power;
+        return r;
+    }
+    
+    lz = lr__clz64(w);
+    w <<= lz;
+    
+    /* The second word of 5^q is needed only if the first product is ambiguous */
+    p5 = lr__pow5_128((int)q);
+    lo = lr__mul128(w, p5[0], &hi);
+    precision_mask = ~0ULL >> (f->explicit_bits + 3);
+    if ((hi & precision_mask) == precision_mask) {
+        lr__mul128(w, p5[1], &hi2);
+        lo2 = lo + hi2;
+        hi += (lo2 < lo);
+        lo = lo2;
+    }
+    
+    upperbit = (int)(hi >> 63);
+    shift = upperbit + 64 - f->explicit_bits - 3;
+    r.mantissa = hi >> shift;
+    r.power2 = (int32_t)(((217706 * (int32_t)q) >> 16) + 63 + upperbit - lz - f->min_exponent);
+    
+    if (r.power2 <= 0) {
+        /* Subnormal, or rounds up into the smallest normal */
+        if (-r.power2 + 1 >= 64) {
+            r.mantissa = 0;
+            r.power2 = 0;
+            return r;
+        }
+        r.mantissa >>= -r.power2 + 1;
+        r.mantissa += (r.mantissa & 1);
+        r.mantissa >>= 1;
+        r.power2 = (r.mantissa < (1ULL << f->explicit_bits)) ? 0 : 1;
+        return r;
+    }
+    
+    /* Exactly halfway between two floats: round to even instead of up */
+    if (lo <= 1 && q >= f->even_min && q <= f->even_max && (r.mantissa & 3) == 1 &&
+        (r.mantissa << shift) == hi) {
+        r.mantissa &= ~1ULL;
+    }
+    
+    r.mantissa += (r.mantissa & 1);
+    r.mantissa >>= 1;
+    if (r.mantissa >= (2ULL << f->explicit_bits)) {
+        r.mantissa = 1ULL << f->explicit_bits;
+        r.power2++;
+    }
+    r.mantissa &= ~(1ULL << f->explicit_bits);
+    
+    if (r.power2 >= f->inf_power) {
+        r.mantissa = 0;
+        r.power2 = f->inf_power;
+    }
+    return r;
+}
+
+/* Arbitrary-precision decimal for inputs Eisel-Lemire cannot decide
+ * (more than 19 significant digits near a halfway point) */
+#define LR__DECIMAL_DIGITS 768
+#define LR__DECIMAL_RANGE  2047
+
+typedef struct {
+    uint32_t num_digits;
+    int32_t decimal_point;      /* Value is 0.d0d1d2... * 10^decimal_point */
+    int truncated;              /* Nonzero digits were dropped past the end */
+    uint8_t digits[LR__DECIMAL_DIGITS + 20];
+} lr__decimal;
+
+static inline void lr__decimal_trim(lr__decimal* d) {
+    while (d->num_digits > 0 && d->digits[d->num_digits - 1] == 0) {
+        d->num_digits--;
+    }
+}
+
+/* d >>= shift, shift <= 60 */
+static inline void lr__decimal_rshift(lr__decimal* d, unsigned shift) {
+    uint32_t ri = 0, wi = 0;
+    uint64_t n = 0, mask = (1ULL << shift) - 1;
+    
+    while ((n >> shift) == 0) {
+        if (ri < d->num_digits) {
+            n = 10 * n + d->digits[ri++];
+        } else if (n == 0) {
+            return;
+        } else {
+            while ((n >> shift) == 0) {
+                n *= 10;
+                ri++;
+            }
+            break;
+        }
+    }
+    
+    d->decimal_point -= (int32_t)ri - 1;
+    if (d->decimal_point < -LR__DECIMAL_RANGE) {
+        d->num_digits = 0;
+        d->decimal_point = 0;
+        d->truncated = 0;
+        return;
+    }
+    
+    while (ri < d->num_digits) {
+        uint8_t digit = (uint8_t)(n >> shift);
+        n = 10 * (n & mask) + d->digits[ri++];
+        d->digits[wi++] = digit;
+    }
+    while (n > 0) {
+        uint8_t digit = (uint8_t)(n >> shift);
+        n = 10 * (n & mask);
+        if (wi < LR__DECIMAL_DIGITS) {
+            d->digits[wi++] = digit;
+        } else if (digit > 0) {
+            d->truncated = 1;
+        }
+    }
+    d->num_digits = wi;
+    lr__decimal_trim(d);
+}
+
+/* d <<= shift, shift <= 60 */
+static inline void lr__decimal_lshift(lr__decimal* d, unsigned shift) {
+    /* 2^shift adds at most 'extra' digits; the spare tail of digits[]
+     * absorbs the overhang until the real count is known */
+    uint32_t extra = ((shift * 1233) >> 12) + 1;
+    int32_t ri = (int32_t)d->num_digits - 1;
+    int32_t wi = ri + (int32_t)extra;
+    uint32_t lead, added, i;
+    uint64_t n = 0;
+    
+    if (d->num_digits == 0) {
+        return;
+    }
+    
+    while (ri >= 0) {
+        uint64_t q;
+        n += (uint64_t)d->digits[ri--] << shift;
+        q = n / 10;
+        d->digits[wi--] = (uint8_t)(n - 10 * q);
+        n = q;
+    }
+    while (n > 0) {
+        d->digits[wi--] = (uint8_t)(n % 10);
+        n /= 10;
+    }
+    
+    lead = (uint32_t)(wi + 1);
+    added = extra - lead;
+    if (lead) {
+        memmove(d->digits, d->digits + lead, d->num_digits + added);
+    }
+    d->num_digits += added;
+    d->decimal_point += (int32_t)added;
+    
+    if (d->num_digits > LR__DECIMAL_DIGITS) {
+        for (i = LR__DECIMAL_DIGITS; i < d->num_digits; i++) {
+            d->truncated |= d->digits[i] != 0;
+        }
+        d->num_digits = LR__DECIMAL_DIGITS;
+    }
+    lr__decimal_trim(d);
+}
+
+/* Integer part of d, rounded half to even */
+static inline uint64_t lr__decimal_round(const lr__decimal* d) {
+    uint32_t dp, i;
+    uint64_t n = 0;
+    int up = 0;
+    
+    if (d->num_digits == 0 || d->decimal_point < 0) {
+        return 0;
+    }
+    if (d->decimal_point > 18) {
+        return ~0ULL;
+    }
+    
+    dp = (uint32_t)d->decimal_point;
+    for (i = 0; i < dp; i++) {
+        n = 10 * n + (i < d->num_digits ? d->digits[i] : 0);
+    }
+    if (dp < d->num_digits) {
+        up = d->digits[dp] >= 5;
+        if (d->digits[dp] == 5 && dp + 1 == d->num_digits) {
+            up = d->truncated || (dp > 0 && (d->digits[dp - 1] & 1));
+        }
+    }
+    return n + (uint64_t)up;
+}
+
+static inline lr__fpbits lr__decimal_to_binary(lr__decimal* d, const lr__fpfmt* f) {
+    static const uint8_t powers[19] = {
+        0, 3, 6, 9, 13, 16, 19, 23, 26, 29, 33, 36, 39, 43, 46, 49, 53, 56, 59
+    };
+    const int mantissa_bits = f->explicit_bits + 1;
+    lr__fpbits r;
+    int32_t exp2 = 0;
+    uint64_t mantissa;
+    
+    r.mantissa = 0;
+    r.power2 = 0;
+    if (d->num_digits == 0 || d->decimal_point < -324) {
+        return r;
+    }
+    if (d->decimal_point >= 310) {
+        goto inf;
+    }
+    
+    /* Scale by powers of two into [1/2, 1), tracking the binary exponent */
+    while (d->decimal_point > 0) {
+        uint32_t n = (uint32_t)d->decimal_point;
+        uint32_t shift = n < 19 ? powers[n] : 60;
+        lr__decimal_rshift(d, shift);
+        if (d->decimal_point < -LR__DECIMAL_RANGE) {
+            return r;
+        }
+        exp2 += (int32_t)shift;
+    }
+    while (d->decimal_point <= 0) {
+        uint32_t shift;
+        if (d->decimal_point == 0) {
+            if (d->digits[0] >= 5) {
+                break;
+            }
+            shift = d->digits[0] < 2 ? 2 : 1;
+        } else {
+            uint32_t n = (uint32_t)-d->decimal_point;
+            shift = n < 19 ? powers[n] : 60;
+        }
+        lr__decimal_lshift(d, shift);
+        if (d->decimal_point > LR__DECIMAL_RANGE) {
+            goto inf;
+        }
+        exp2 -= (int32_t)shift;
+    }
+    exp2--;
+    
+    /* Denormalize below the minimum exponent */
+    while (f->min_exponent + 1 > exp2) {
+        uint32_t n = (uint32_t)(f->min_exponent + 1 - exp2);
+        if (n > 60) n = 60;
+        lr__decimal_rshift(d, n);
+        exp2 += (int32_t)n;
+    }
+    if (exp2 - f->min_exponent >= f->inf_power) {
+        goto inf;
+    }
+    
+    lr__decimal_lshift(d, (unsigned)mantissa_bits);
+    mantissa = lr__decimal_round(d);
+    if (mantissa >= (1ULL << mantissa_bits)) {
+        lr__decimal_rshift(d, 1);
+        exp2++;
+        mantissa = lr__decimal_round(d);
+        if (exp2 - f->min_exponent >= f->inf_power) {
+            goto inf;
+        }
+    }
+    
+    r.power2 = exp2 - f->min_exponent;
+    if (mantissa < (1ULL << f->explicit_bits)) {
+        r.power2--;
+    }
+    r.mantissa = mantissa & ((1ULL << f->explicit_bits) - 1);
+    return r;
+    
+inf:
+    r.mantissa = 0;
+    r.power2 = f->inf_power;
+    return r;
+}
+
+/* Round m * 2^e2 (plus a sticky fraction) to the format; used for hex input */
+static inline uint64_t lr__round_binary(uint64_t m, int64_t e2, int sticky, const lr__fpfmt* f) {
+    const int mantissa_bits = f->explicit_bits + 1;
+    int64_t biased;
+    int shift, lz;
+    uint64_t mant, rem, half;
+    
+    if (m == 0) {
+        return 0;
+    }
+    lz = lr__clz64(m);
+    m <<= lz;
+    e2 -= lz;
+    
+    biased = e2 + 63 - f->min_exponent;
+    if (biased >= f->inf_power) {
+        return (uint64_t)f->inf_power << f->explicit_bits;
+    }
+    
+    shift = 64 - mantissa_bits;
+    if (biased <= 0) {
+        if (1 - biased > 64) {
+            return 0;
+        }
+        shift += (int)(1 - biased);
+        biased = 0;
+    }
+    
+    if (shift > 64) {
+        return 0;
+    }
+    if (shift == 64) {
+        mant = 0;
+        rem = m;
+        half = 1ULL << 63;
+    } else {
+        mant = m >> shift;
+        rem = m & ((1ULL << shift) - 1);
+        half = 1ULL << (shift - 1);
+    }
+    if (rem > half || (rem == half && (sticky || (mant & 1)))) {
+        mant++;
+    }
+    
+    /* A carry out of the mantissa lands in the exponent field */
+    mant += (uint64_t)(biased ? biased - 1 : 0) << f->explicit_bits;
+    if (mant >= ((uint64_t)f->inf_power << f->explicit_bits)) {
+        return (uint64_t)f->inf_power << f->explicit_bits;
+    }
+    return mant;
+}
+
+/* Optional exponent: [eEpP][+-]digits, consumed only if a digit follows */
+static inline const char* lr__parse_exponent(const char* s, int marker, int64_t* exp) {
+    const char* start = s;
+    int negative = 0;
+    int64_t e = 0;
+    
+    *exp = 0;
+    if ((*s | 0x20) != marker) {
+        return s;
+    }
+    s++;
+    if (*s == '-' || *s == '+') {
+        negative = (*s == '-');
+        s++;
+    }
+    if (!isdigit((unsigned char)*s)) {
+        return start;
+    }
+    while (isdigit((unsigned char)*s)) {
+        if (e < 0x10000000) {
+            e = e * 10 + (*s - '0');
+        }
+        s++;
+    }
+    *exp = negative ? -e : e;
+    return s;
+}
+
+/* Case-insensitive match of a lowercase word */
+static inline int lr__match_word(const char* s, const char* word) {
+    while (*word) {
+        if (tolower((unsigned char)*s++) != *word++) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* Hexadecimal float after "0x": bits of the rounded value */
+static inline uint64_t lr__parse_hexfloat(const char** sp, const lr__fpfmt* f, int* nonzero) {
+    const char* s = *sp;
+    uint64_t m = 0;
+    int64_t e2 = 0, exp;
+    int sticky = 0, seen_dot = 0;
+    unsigned d;
+    
+    for (;; s++) {
+        if (*s == '.' && !seen_dot) {
+            seen_dot = 1;
+            continue;
+        }
+        if ((d = lr__digit_value((unsigned char)*s)) >= 16) {
+            break;
+        }
+        if ((m >> 60) == 0) {
+            m = m * 16 + d;
+            e2 -= seen_dot ? 4 : 0;
+        } else {
+            sticky |= d != 0;
+            e2 += seen_dot ? 0 : 4;
+        }
+    }
+    
+    s = lr__parse_exponent(s, 'p', &exp);
+    *sp = s;
+    *nonzero = m != 0;
+    return lr__round_binary(m, e2 + exp, sticky, f);
+}
+
+/* Shared parser: returns the bit pattern of the result in format f */
+static inline uint64_t lr__strtofp(const char* nptr, char** endptr, const lr__fpfmt* f, int* status) {
+    static const uint64_t pow10[20] = {
+        1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL,
+        100000000ULL, 1000000000ULL, 10000000000ULL, 100000000000ULL,
+        1000000000000ULL, 10000000000000ULL, 100000000000000ULL,
+        1000000000000000ULL, 10000000000000000ULL, 100000000000000000ULL,
+        1000000000000000000ULL, 10000000000000000000ULL
+    };
+    const char* s = nptr;
+    const char *ip, *fp, *frac;
+    size_t il, fl, frac_len;
+    uint64_t sign = 0, bits, w;
+    int64_t e, q;
+    int truncated = 0, overflow = 0, nonzero, st = LR_PARSE_OK;
+    lr__fpbits r;
+    
+    while (isspace((unsigned char)*s)) {
+        s++;
+    }
+    if (*s == '-' || *s == '+') {
+        sign = (uint64_t)(*s == '-') << f->sign_shift;
+        s++;
+    }
+    
+    /* inf, infinity, nan and nan(chars) */
+    if (lr__match_word(s, "inf")) {
+        s += lr__match_word(s, "infinity") ? 8 : 3;
+        bits = (uint64_t)f->inf_power << f->explicit_bits;
+        goto done;
+    }
+    if (lr__match_word(s, "nan")) {
+        const char* t = s + 3;
+        s = t;
+        if (*t == '(') {
+            for (t++; isalnum((unsigned char)*t) || *t == '_'; t++) {
+                ;
+            }
+            if (*t == ')') {
+                s = t + 1;
+            }
+        }
+        bits = ((uint64_t)f->inf_power << f->explicit_bits) | (1ULL << (f->explicit_bits - 1));
+        goto done;
+    }
+    
+    /* Hexadecimal, only if a hex digit follows the prefix */
+    if (s[0] == '0' && (s[1] | 0x20) == 'x' &&
+        (lr__digit_value((unsigned char)s[2]) < 16 ||
+         (s[2] == '.' && lr__digit_value((unsigned char)s[3]) < 16))) {
+        s += 2;
+        bits = lr__parse_hexfloat(&s, f, &nonzero);
+        goto checked;
+    }
+    
+    /* Decimal: integer digits, optional fraction, optional exponent */
+    ip = s;
+    il = lr__digit_span(s);
+    s += il;
+    frac = s;
+    frac_len = 0;
+    if (*s == '.') {
+        frac = ++s;
+        frac_len = lr__digit_span(s);
+        s += frac_len;
+    }
+    if (il + frac_len == 0) {
+        if (endptr) *endptr = (char*)nptr;
+        if (status) *status = LR_PARSE_NODIGITS;
+        return 0;
+    }
+    s = lr__parse_exponent(s, 'e', &e);
+    
+    /* Significant digits: leading zeros skipped, at most 19 kept in w */
+    while (il && *ip == '0') {
+        ip++;
+        il--;
+    }
+    fp = frac;
+    fl = frac_len;
+    if (il == 0) {
+        while (fl && *fp == '0') {
+            fp++;
+            fl--;
+        }
+    }
+    
+    if (il + fl <= 19) {
+        w = lr__parse_dec(ip, il, &overflow) * pow10[fl] + lr__parse_dec(fp, fl, &overflow);
+        q = e - (int64_t)frac_len;
+    } else {
+        const char* t;
+        size_t used;
+        if (il >= 19) {
+            w = lr__parse_dec(ip, 19, &overflow);
+            q = e + (int64_t)(il - 19);
+            for (t = ip + 19; t < ip + il; t++) {
+                truncated |= *t != '0';
+            }
+            used = 0;
+        } else {
+            used = 19 - il;
+            w = lr__parse_dec(ip, il, &overflow) * pow10[used] + lr__parse_dec(fp, used, &overflow);
+            q = e - (int64_t)frac_len + (int64_t)(fl - used);
+        }
+        for (t = fp + used; t < fp + fl; t++) {
+            truncated |= *t != '0';
+        }
+    }
+    
+    nonzero = w != 0;
+    
+    #if defined(__FLT_EVAL_METHOD__) && __FLT_EVAL_METHOD__ == 0
+    /* Clinger: w and 10^|q| are both exact, so one rounding suffices */
+    if (!truncated && f->explicit_bits == 52 && q >= -22 && q <= 22 && w <= (1ULL << 53)) {
+        static const double p10[23] = {
+            1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+            1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+        };
+        union { double d; uint64_t i; } u;
+        u.d = (double)w;
+        u.d = q < 0 ? u.d / p10[-q] : u.d * p10[q];
+        bits = u.i;
+        goto done;
+    }
+    if (!truncated && f->explicit_bits == 23 && q >= -10 && q <= 10 && w <= (1ULL << 24)) {
+        static const float p10f[11] = {
+            1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f
+        };
+        union { float f; uint32_t i; } u;
+        u.f = (float)w;
+        u.f = q < 0 ? u.f / p10f[-q] : u.f * p10f[q];
+        bits = u.i;
+        goto done;
+    }
+    #endif
+    
+    r = lr__eisel_lemire(q, w, f);
+    if (truncated) {
+        /* The true value lies in (w, w+1) * 10^q: agreement settles it */
+        lr__fpbits r1 = lr__eisel_lemire(q, w + 1, f);
+        if (r.mantissa != r1.mantissa || r.power2 != r1.power2) {
+            lr__decimal d;
+            const char* t;
+            int64_t dp;
+            
+            d.num_digits = 0;
+            d.truncated = 0;
+            dp = il ? (int64_t)il : -(int64_t)(fp - frac);
+            for (t = il ? ip : fp; t < s; t++) {
+                if (!isdigit((unsigned char)*t)) {
+                    if (*t == '.') continue;
+                    break;
+                }
+                if (d.num_digits < LR__DECIMAL_DIGITS) {
+                    d.digits[d.num_digits++] = (uint8_t)(*t - '0');
+                } else if (*t != '0') {
+                    d.truncated = 1;
+                }
+            }
+            dp += e;
+            if (dp > 100000) dp = 100000;
+            if (dp < -100000) dp = -100000;
+            d.decimal_point = (int32_t)dp;
+            lr__decimal_trim(&d);
+            r = lr__decimal_to_binary(&d, f);
+        }
+    }
+    bits = r.mantissa | ((uint64_t)r.power2 << f->explicit_bits);
+
+checked:
+    /* Overflow to infinity or underflow of a nonzero input to zero */
+    if (bits == ((uint64_t)f->inf_power << f->explicit_bits) || (bits == 0 && nonzero)) {
+        st = LR_PARSE_RANGE;
+    }
+done:
+    if (endptr) *endptr = (char*)s;
+    if (status) *status = st;
+    return bits | sign;
+}
+
+static inline double strtod(const char* nptr, char** endptr) {
+    static const lr__fpfmt fmt = { 52, -1023, 0x7FF, 63, -342, 308, -4, 23 };
+    union { uint64_t i; double d; } u;
+    u.i = lr__strtofp(nptr, endptr, &fmt, NULL);
+    return u.d;
+}
+
+static inline float strtof(const char* nptr, char** endptr) {
+    static const lr__fpfmt fmt = { 23, -127, 0xFF, 31, -64, 38, -17, 10 };
+    union { uint32_t i; float f; } u;
+    u.i = (uint32_t)lr__strtofp(nptr, endptr, &fmt, NULL);
+    return u.f;
+}
+
+/* strtod/strtof that also store an LR_PARSE_* code in *status */
+static inline double strtod_status(const char* nptr, char** endptr, int* status) {
+    static const lr__fpfmt fmt = { 52, -1023, 0x7FF, 63, -342, 308, -4, 23 };
+    union { uint64_t i; double d; } u;
+    u.i = lr__strtofp(nptr, endptr, &fmt, status);
+    return u.d;
+}
+
+static inline float strtof_status(const char* nptr, char** endptr, int* status) {
+    static const lr__fpfmt fmt = { 23, -127, 0xFF, 31, -64, 38, -17, 10 };
+    union { uint32_t i; float f; } u;
+    u.i = (uint32_t)lr__strtofp(nptr, endptr, &fmt, status);
+    return u.f;
+}
+
+static inline double atof(const char* nptr) {
+    return strtod(nptr, NULL);
+}
+
+/* Floating-point formatting */
+
+/* Buffer size that always fits dtoa_shortest/ftoa_shortest output */
+#define LR_DTOA_BUFSIZE 32
+
+/* Digits of v written to out (no terminator); returns the count */
+static inline int lr__u64toa(char* out, uint64_t v) {
+    static const char pairs[201] =
+        "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+        "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+        "8081828384858687888990919293949596979899";
+    static const uint64_t pow10[20] = {
+        1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL,
+        10000000ULL, 100000000ULL, 1000000000ULL, 10000000000ULL,
+        100000000000ULL, 1000000000000ULL, 10000000000000ULL,
+        100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL,
+        100000000000000000ULL, 1000000000000000000ULL, 10000000000000000000ULL
+    };
+    /* log10 from the bit length (1233 / 4096 ~ log10(2)), then one compare */
+    int t = ((64 - lr__clz64(v | 1)) * 1233) >> 12;
+    int len = t + 1 - ((v | 1) < pow10[t]), i;
+    
+    for (i = len; v >= 100; v /= 100) {
+        const char* p = pairs + 2 * (v % 100);
+        out[--i] = p[1];
+        out[--i] = p[0];
+    }
+    if (v >= 10) {
+        out[1] = pairs[2 * v + 1];
+        out[0] = pairs[2 * v];
+    } else {
+        out[0] = (char)('0' + v);
+    }
+    return len;
+}
+
+/* Ryu tables: 5^-i and 5^i normalized to 125 bits, low word first */
+static inline const uint64_t* lr__ryu_pow5_inv(int i) {
+    static const uint64_t table[] = {
+        0x0000000000000001ULL, 0x2000000000000000ULL,
+        0x999999999999999aULL, 0x1999999999999999ULL,
+        0x47ae147ae147ae15ULL, 0x147ae147ae147ae1ULL,
+        0x6c8b4395810624deULL, 0x10624dd2f1a9fbe7ULL,
+        0x7a786c226809d496ULL, 0x1a36e2eb1c432ca5ULL,
+        0x61f9f01b866e43abULL, 0x14f8b588e368f084ULL,
+        0xb4c7f34938583622ULL, 0x10c6f7a0b5ed8d36ULL,
+        0x87a6520ec08d236aULL, 0x1ad7f29abcaf4857ULL,
+        0x9fb841a566d74f88ULL, 0x15798ee2308c39dfULL,
+        0xe62d01511f12a607ULL, 0x112e0be826d694b2ULL,
+        0xd6ae6881cb5109a4ULL, 0x1b7cdfd9d7bdbab7ULL,
+        0xdef1ed34a2a73aeaULL, 0x15fd7fe17964955fULL,
+        0x7f27f0f6e885c8bbULL, 0x119799812dea1119ULL,
+        0x650cb4be40d60df8ULL, 0x1c25c268497681c2ULL,
+        0xea70909833de7193ULL, 0x16849b86a12b9b01ULL,
+        0x21f3a6e0297ec143ULL, 0x1203af9ee756159bULL,
+        0x6985d7cd0f313537ULL, 0x1cd2b297d889bc2bULL,
+        0x2137dfd73f5a90f9ULL, 0x170ef54646d49689ULL,
+        0xe75fe645cc4873faULL, 0x12725dd1d243aba0ULL,
+        0xa5663d3c7a0d865dULL, 0x1d83c94fb6d2ac34ULL,
+        0x511e976394d79eb1ULL, 0x179ca10c9242235dULL,
+        0xda7edf82dd794bc1ULL, 0x12e3b40a0e9b4f7dULL,
+        0x2a6498d1625bac68ULL, 0x1e392010175ee596ULL,
+        0xeeb6e0a781e2f053ULL, 0x182db34012b25144ULL,
+        0x58924d52ce4f26a9ULL, 0x1357c299a88ea76aULL,
+        0x27507bb7b07ea441ULL, 0x1ef2d0f5da7dd8aaULL,
+        0x52a6c95fc0655034ULL, 0x18c240c4aecb13bbULL,
+        0x0eebd44c99eaa690ULL, 0x13ce9a36f23c0fc9ULL,
+        0xb17953adc3110a80ULL, 0x1fb0f6be50601941ULL,
+        0xc12ddc8b02740867ULL, 0x195a5efea6b34767ULL,
+        0x3424b06f3529a052ULL, 0x14484bfeebc29f86ULL,
+        0x901d59f290ee19dbULL, 0x1039d66589687f9eULL,
+        0x4cfbc31db4b0295fULL, 0x19f623d5a8a73297ULL,
+        0x3d9635b15d59bab2ULL, 0x14c4e977ba1f5bacULL,
+        0x97ab5e277de16228ULL, 0x109d8792fb4c4956ULL,
+        0xf2abc9d8c9689d0dULL, 0x1a95a5b7f87a0ef0ULL,
+        0x5bbca17a3aba173eULL, 0x154484932d2e725aULL,
+        0xafca1ac82efb45cbULL, 0x11039d428a8b8eaeULL,
+        0xb2dcf7a6b1920945ULL, 0x1b38fb9daa78e44aULL,
+        0xf57d92ebc141a104ULL, 0x15c72fb1552d836eULL,
+        0xc46475896767b403ULL, 0x116c262777579c58ULL,
+        0x6d6d88dbd8a5ecd2ULL, 0x1be03d0bf225c6f4ULL,
+        0x8abe071646eb23dbULL, 0x164cfda3281e38c3ULL,
+        0x6efe6c11d255b649ULL, 0x11d7314f534b609cULL,
+        0xb197134fb6ef8a0eULL, 0x1c8b821885456760ULL,
+        0x27ac0f72f8bfa1a5ULL, 0x16d601ad376ab91aULL,
+        0xb95672c260994e1eULL, 0x1244ce242c5560e1ULL,
+        0xf5571e03cdc21695ULL, 0x1d3ae36d13bbce35ULL,
+        0x2aac18030b01ababULL, 0x17624f8a762fd82bULL,
+        0xbbbce0026f348956ULL, 0x12b50c6ec4f31355ULL,
+        0x92c7ccd0b1eda889ULL, 0x1dee7a4ad4b81eefULL,
+        0xdbd30a408e57ba07ULL, 0x17f1fb6f10934bf2ULL,
+        0x7ca8d50071dfc806ULL, 0x1327fc58da0f6ff5ULL,
+        0xfaa7bb33e9660cd6ULL, 0x1ea6608e29b24cbbULL,
+        0x9552fc298784d711ULL, 0x18851a0b548ea3c9ULL,
+        0xaaa8c9bad2d0ac0eULL, 0x139dae6f76d88307ULL,
+        0xdddadc5e1e1aace3ULL, 0x1f62b0b257c0d1a5ULL,
+        0x7e48b04b4b488a4fULL, 0x191bc08eac9a4151ULL,
+        0xcb6d59d5d5d3a1d9ULL, 0x141633a556e1cddaULL,
+        0x3c577b1177dc817bULL, 0x1011c2eaabe7d7e2ULL,
+        0xc6f25e825960cf2aULL, 0x19b604aaaca62636ULL,
+        0x6bf518684780a5bbULL, 0x14919d5556eb51c5ULL,
+        0x232a79ed06008496ULL, 0x10747ddddf22a7d1ULL,
+        0xd1dd8fe1a3340756ULL, 0x1a53fc9631d10c81ULL,
+        0xa7e4731ae8f66c45ULL, 0x150ffd44f4a73d34ULL,
+        0x531d28e253f8569eULL, 0x10d9976a5d52975dULL,
+        0xeb61db03b98d5762ULL, 0x1af5bf109550f22eULL,
+        0xbc4e48cfc7a445e8ULL, 0x159165a6ddda5b58ULL,
+        0x6371d3d96c836b20ULL, 0x11411e1f17e1e2adULL,
+        0x9f1c8628ad9f11cdULL, 0x1b9b6364f3030448ULL,
+        0xe5b06b53be18db0bULL, 0x1615e91d8f359d06ULL,
+        0xeaf3890fcb4715a2ULL, 0x11ab20e472914a6bULL,
+        0x44b8db4c7871bc37ULL, 0x1c45016d841baa46ULL,
+        0x03c715d6c6c1635fULL, 0x169d9abe03495505ULL,
+        0x3638de456bcde919ULL, 0x1217aefe69077737ULL,
+        0x56c163a2461641c1ULL, 0x1cf2b1970e725858ULL,
+        0xdf011c81d1ab67ceULL, 0x17288e1271f51379ULL,
+        0x7f3416ce4155eca5ULL, 0x1286d80ec190dc61ULL,
+        0x6520247d3556476eULL, 0x1da48ce468e7c702ULL,
+        0xea801d30f7783925ULL, 0x17b6d71d20b96c01ULL,
+        0xbb99b0f3f92cfa84ULL, 0x12f8ac174d612334ULL,
+        0x5f5c4e532847f739ULL, 0x1e5aacf215683854ULL,
+        0x7f7d0b75b9d32c2eULL, 0x18488a5b44536043ULL,
+        0x9930d5f7c7dc2358ULL, 0x136d3b7c36a919cfULL,
+        0x8eb4898c72f9d226ULL, 0x1f152bf9f10e8fb2ULL,
+        0x722a07a38f2e41b8ULL, 0x18ddbcc7f40ba628ULL,
+        0xc1bb394fa5be9afaULL, 0x13e497065cd61e86ULL,
+        0x9c5ec2190930f7f6ULL, 0x1fd424d6faf030d7ULL,
+        0x49e56814075a5ff8ULL, 0x197683df2f268d79ULL,
+        0x6e51201005e1e660ULL, 0x145ecfe5bf520ac7ULL,
+        0xf1da800cd181851aULL, 0x104bd984990e6f05ULL,
+        0x4fc400148268d4f5ULL, 0x1a12f5a0f4e3e4d6ULL,
+        0xd96999aa01ed772bULL, 0x14dbf7b3f71cb711ULL,
+        0xadee1488018ac5bcULL, 0x10aff95cc5b09274ULL,
+        0x497ceda668de092cULL, 0x1ab328946f80ea54ULL,
+        0x3aca57b853e4d424ULL, 0x155c2076bf9a5510ULL,
+        0x623b7960431d7683ULL, 0x1116805effaeaa73ULL,
+        0x9d2bf566d1c8bd9eULL, 0x1b5733cb32b110b8ULL,
+        0x7dbcc452416d647fULL, 0x15df5ca28ef40d60ULL,
+        0xcafd69db678ab6ccULL, 0x117f7d4ed8c33de6ULL,
+        0xab2f0fc572778adfULL, 0x1bff2ee48e052fd7ULL,
+        0x88f273045b92d580ULL, 0x1665bf1d3e6a8cacULL,
+        0xd3f528d049424466ULL, 0x11eaff4a98553d56ULL,
+        0xb988414d4203a0a3ULL, 0x1cab3210f3bb9557ULL,
+        0x6139cdd76802e6e9ULL, 0x16ef5b40c2fc7779ULL,
+        0xe761717920025254ULL, 0x125915cd68c9f92dULL,
+        0xa568b58e999d5086ULL, 0x1d5b561574765b7cULL,
+        0x5120913ee14aa6d2ULL, 0x177c44ddf6c515fdULL,
+        0xa74d40ff1aa21f0eULL, 0x12c9d0b1923744caULL,
+        0x0baece64f769cb4aULL, 0x1e0fb44f50586e11ULL,
+        0x3c8bd850c5ee3c3bULL, 0x180c903f7379f1a7ULL,
+        0xca0979da37f1c9c9ULL, 0x133d4032c2c7f485ULL,
+        0xa9a8c2f6bfe942dbULL, 0x1ec866b79e0cba6fULL,
+        0x2153cf2bccba9be3ULL, 0x18a0522c7e709526ULL,
+        0x1aa9728970954982ULL, 0x13b374f06526ddb8ULL,
+        0xf775840f1a88759dULL, 0x1f8587e7083e2f8cULL,
+        0x5f9136727ba05e17ULL, 0x19379fec0698260aULL,
+        0x1940f85b9619e4dfULL, 0x142c7ff0054684d5ULL,
+        0xe100c6afab47ea4cULL, 0x1023998cd1053710ULL,
+        0xce67a44c453fdd47ULL, 0x19d28f47b4d524e7ULL,
+        0xd852e9d69dccb106ULL, 0x14a8729fc3ddb71fULL,
+        0x79dbee454b0a2738ULL, 0x1086c219697e2c19ULL,
+        0x295fe3a211a9d859ULL, 0x1a71368f0f30468fULL,
+        0xbab31c81a7bb137aULL, 0x15275ed8d8f36ba5ULL,
+        0x6228e39aec95a92fULL, 0x10ec4be0ad8f8951ULL,
+        0x9d0e38f7e0ef7517ULL, 0x1b13ac9aaf4c0ee8ULL,
+        0xb0d82d931a592a79ULL, 0x15a956e225d67253ULL,
+        0x8d79be0f4847552eULL, 0x11544581b7dec1dcULL,
+        0x158f967eda0bbb7cULL, 0x1bba08cf8c979c94ULL,
+        0x77a611ff14d62f97ULL, 0x162e6d72d6dfb076ULL,
+        0xf951a7ff43de8c79ULL, 0x11bebdf578b2f391ULL,
+        0xc21c3ffed2fdad8eULL, 0x1c6463225ab7ec1cULL,
+        0x01b0333242648ad8ULL, 0x16b6b5b5155ff017ULL,
+        0x0159c28e9b83a246ULL, 0x122bc490dde659acULL,
+        0xcef604175f3903a3ULL, 0x1d12d41afca3c2acULL,
+        0x725e69ac4c2d9c83ULL, 0x17424348ca1c9bbdULL,
+        0xf5185489d68ae39cULL, 0x129b69070816e2fdULL,
+        0xee8d540fbdab05c6ULL, 0x1dc574d80cf16b2fULL,
+        0xbed77672fe226b05ULL, 0x17d12a4670c1228cULL,
+        0xff12c528cb4ebc04ULL, 0x130dbb6b8d674ed6ULL,
+        0xcb513b74787df9a0ULL, 0x1e7c5f127bd87e24ULL,
+        0x090dc929f9fe614dULL, 0x18637f41fcad31b7ULL,
+        0xa0d7d42194cb810aULL, 0x1382cc34ca2427c5ULL,
+        0x67bfb9cf5478ce77ULL, 0x1f37ad21436d0c6fULL,
+        0x1fcc94a5dd2d71f9ULL, 0x18f9574dcf8a7059ULL,
+        0x7fd6dd517dbdf4c7ULL, 0x13faac3e3fa1f37aULL,
+        0xffbe2ee8c92fee0bULL, 0x1ff779fd329cb8c3ULL,
+        0x6631bf20a0f324d6ULL, 0x1992c7fdc216fa36ULL,
+        0xb827cc1a1a5c1d78ULL, 0x14756ccb01abfb5eULL,
+        0x935309ae7b7ce460ULL, 0x105df0a267bcc918ULL,
+        0x1eeb42b0c594a099ULL, 0x1a2fe76a3f9474f4ULL,
+        0xe58902270476e6e1ULL, 0x14f31f8832dd2a5cULL,
+        0xb7a0ce859d2bebe7ULL, 0x10c27fa028b0eeb0ULL,
+        0x59014a6f61dfdfd8ULL, 0x1ad0cc33744e4ab4ULL,
+        0xe0cdd525e7e64cadULL, 0x1573d68f903ea229ULL,
+        0x4d7177518651d6f1ULL, 0x11297872d9cbb4eeULL,
+        0x7be8bee8d6e957e8ULL, 0x1b758d848fac54b0ULL,
+        0xfcba3253df211320ULL, 0x15f7a46a0c89dd59ULL,
+        0x63c8284318e74280ULL, 0x1192e9ee706e4aaeULL,
+        0x060d0d3827d86a66ULL, 0x1c1e43171a4a1117ULL,
+        0x6b3da42cecad21ebULL, 0x167e9c127b6e7412ULL,
+        0x88fe1cf0bd574e56ULL, 0x11fee341fc585cdbULL,
+        0x419694b462254a23ULL, 0x1ccb0536608d615fULL,
+        0x67abaa29e81dd4e9ULL, 0x1708d0f84d3de77fULL,
+        0xb95621bb2017dd87ULL, 0x126d73f9d764b932ULL,
+        0xc223692b668c95a5ULL, 0x1d7becc2f23ac1eaULL,
+        0xce82ba891ed6de1dULL, 0x179657025b6234bbULL,
+        0xa53562074bdf1818ULL, 0x12deac01e2b4f6fcULL,
+        0x3b889cd87964f359ULL, 0x1e3113363787f194ULL,
+        0xfc6d4a46c783f5e1ULL, 0x18274291c6065adcULL,
+        0x30576e9f06032b1aULL, 0x13529ba7d19eaf17ULL,
+        0x1a257dcb3cd1de90ULL, 0x1eea92a61c311825ULL,
+        0x481dfe3c30a7e540ULL, 0x18bba884e35a79b7ULL,
+        0xd34b31c9c0865100ULL, 0x13c9539d82aec7c5ULL,
+        0x5211e942cda3b4cdULL, 0x1fa885c8d117a609ULL,
+        0x74db21023e1c90a4ULL, 0x19539e3a40dfb807ULL,
+        0xf715b401cb4a0d50ULL, 0x1442e4fb67196005ULL,
+        0xf8de299b09080aa7ULL, 0x103583fc527ab337ULL,
+        0x8e304291a80cddd7ULL, 0x19ef3993b72ab859ULL,
+        0x3e8d020e200a4b13ULL, 0x14bf6142f8eef9e1ULL,
+        0x653d9b3e80083c0fULL, 0x10991a9bfa58c7e7ULL,
+        0x6ec8f864000d2ce4ULL, 0x1a8e90f9908e0ca5ULL,
+        0x8bd3f9e999a423eaULL, 0x153eda614071a3b7ULL,
+        0x3ca994bae1501cbbULL, 0x10ff151a99f482f9ULL,
+        0xc775bac49bb3612bULL, 0x1b31bb5dc320d18eULL,
+        0xd2c4956a16291a89ULL, 0x15c162b168e70e0bULL,
+        0xdbd0778811ba7ba1ULL, 0x11678227871f3e6fULL,
+        0x2c80bf401c5d929bULL, 0x1bd8d03f3e9863e6ULL,
+        0xbd33cc3349e47549ULL, 0x16470cff6546b651ULL,
+        0xca8fd68f6e505dd4ULL, 0x11d270cc51055ea7ULL,
+        0x4419574be3b3c953ULL, 0x1c83e7ad4e6efdd9ULL,
+        0x0347790982f63aa9ULL, 0x16cfec8aa52597e1ULL,
+        0xcf6c60d468c4fbbaULL, 0x123ff06eea847980ULL,
+        0xe57a34870e07f92aULL, 0x1d331a4b10d3f59aULL,
+        0x512e906c0b399422ULL, 0x175c1508da432ae2ULL,
+        0xda8ba6bcd5c7a9b5ULL, 0x12b010d3e1cf5581ULL,
+        0x90df712e22d90f87ULL, 0x1de6815302e5559cULL,
+        0xda4c5a8b4f140c6cULL, 0x17eb9aa8cf1dde16ULL,
+        0xaea37ba2a5a9a38aULL, 0x1322e220a5b17e78ULL,
+        0x7dd25f6aa2a905a9ULL, 0x1e9e369aa2b59727ULL,
+        0x97db7f888220d154ULL, 0x187e92154ef7ac1fULL,
+        0x797c6606ce80a777ULL, 0x139874ddd8c6234cULL,
+        0x8f2d700ae4010bf1ULL, 0x1f5a549627a36badULL,
+        0x0c2459a25000d65aULL, 0x191510781fb5efbeULL,
+        0x701d1481d99a4515ULL, 0x1410d9f9b2f7f2feULL,
+        0xc017439b147b6a77ULL, 0x100d7b2e28c65bfeULL,
+        0xccf205c4ed9243f2ULL, 0x19af2b7d0e0a2ccaULL,
+        0x0a5b37d0be0e9cc2ULL, 0x148c22ca71a1bd6fULL,
+        0x0848f973cb3ee3ceULL, 0x10701bd527b4978cULL,
+        0xda0e5bec78649fb0ULL, 0x1a4cf9550c5425acULL,
+        0x7b3eaff060507fc0ULL, 0x150a6110d6a9b7bdULL,
+        0x95cbbff380406633ULL, 0x10d51a73deee2c97ULL,
+        0xefac665266cd7052ULL, 0x1aee90b964b04758ULL,
+        0x2623850eb8a459dbULL, 0x158ba6fab6f36c47ULL,
+        0x1e82d0d893b6ae49ULL, 0x113c85955f29236cULL,
+        0xfd9e1af41f8ab075ULL, 0x1b9408eefea838acULL,
+        0x97b1af29b2d559f7ULL, 0x16100725988693bdULL,
+        0xac8e25baf5777b2cULL, 0x11a66c1e139edc97ULL,
+        0x7a7d092b2258c513ULL, 0x1c3d79c9b8fe2dbfULL,
+        0x61fda0ef4ead6a76ULL, 0x169794a160cb57ccULL,
+        0xe7fe1a590bbdeec5ULL, 0x1212dd4de7091309ULL,
+        0xa6635d5b45fcb13aULL, 0x1ceafbafd80e84dcULL,
+        0x851c4aaf6b308dc8ULL, 0x172262f3133ed0b0ULL,
+        0xd0e36ef2bc26d7d4ULL, 0x1281e8c275cbda26ULL,
+        0xb49f17eac6a48c86ULL, 0x1d9ca79d894629d7ULL,
+        0x2a18dfef0550706bULL, 0x17b08617a104ee46ULL,
+        0x54e0b3259dd9f389ULL, 0x12f39e794d9d8b6bULL,
+        0x87cdeb6f62f65274ULL, 0x1e5297287c2f4578ULL,
+        0xd30b22bf825ea85dULL, 0x18421286c9bf6ac6ULL,
+        0x0f3c1bcc684bb9e4ULL, 0x13680ed23aff889fULL,
+        0x18602c7a4079296dULL, 0x1f0ce4839198da98ULL,
+        0x46b356c833942124ULL, 0x18d71d360e13e213ULL,
+        0x388f78a029434db6ULL, 0x13df4a91a4dcb4dcULL,
+        0x5a7f2766a86baf8aULL, 0x1fcbaa82a1612160ULL,
+        0x153285ebb9efbfa2ULL, 0x196fbb9bb44db44dULL,
+        0xaa8ed189618c994eULL, 0x145962e2f6a4903dULL,
+        0xeed8a7a11ad6e10cULL, 0x1047824f2bb6d9caULL,
+        0x7e27729b5e249b45ULL, 0x1a0c03b1df8af611ULL,
+        0xfe85f549181d4904ULL, 0x14d6695b193bf80dULL,
+        0xcb9e5dd4134aa0d0ULL, 0x10ab877c142ff9a4ULL,
+        0xdf63c9535211014dULL, 0x1aac0bf9b9e65c3aULL,
+        0x191ca10f74da6771ULL, 0x15566ffafb1eb02fULL,
+        0xadb080d92a4852c1ULL, 0x1111f32f2f4bc025ULL,
+        0x15e7348eaa0d5134ULL, 0x1b4feb7eb212cd09ULL,
+        0xab1f5d3eee710dc4ULL, 0x15d98932280f0a6dULL,
+        0xbc1917658b8da49dULL, 0x117ad428200c0857ULL,
+        0x2cf4f23c127c3a94ULL, 0x1bf7b9d9cce00d59ULL,
+        0xf0c3f4fcdb969543ULL, 0x165fc7e170b33de0ULL,
+        0x5a365d9716121103ULL, 0x11e6398126f5cb1aULL,
+        0x9056fc24f01ce804ULL, 0x1ca38f350b22de90ULL,
+        0xd9df301d8ce3ecd0ULL, 0x16e93f5da2824ba6ULL,
+        0xe17f59b13d8323daULL, 0x125432b14ecea2ebULL,
+        0x68cbc2b52f38395cULL, 0x1d53844ee47dd179ULL,
+        0x53d6355dbf602de3ULL, 0x177603725064a794ULL,
+        0xa9782ab165e68b1cULL, 0x12c4cf8ea6b6ec76ULL,
+        0x0f26aab56fd744faULL, 0x1e07b27dd78b13f1ULL,
+        0x3f52222abfdf6a62ULL, 0x18062864ac6f4327ULL,
+        0x65db4e88997f884eULL, 0x1338205089f29c1fULL,
+        0x6fc54a7428cc0d4aULL, 0x1ec033b40fea9365ULL,
+        0x596aa1f68709a43bULL, 0x1899c2f673220f84ULL,
+        0xadeee7f86c07b696ULL, 0x13ae3591f5b4d936ULL,
+        0x497e3ff3e00c5756ULL, 0x1f7d228322baf524ULL,
+        0xd464fff64cd6ac45ULL, 0x1930e868e89590e9ULL,
+        0x4383fff83d7889d1ULL, 0x14272053ed4473eeULL,
+        0xcf9cccc69793a174ULL, 0x101f4d0ff1038ff1ULL,
+        0x7f6147a425b90252ULL, 0x19cbae7fe805b31cULL,
+        0xcc4dd2e9b7c7350fULL, 0x14a2f1ffecd15c16ULL,
+        0x3d0b0f215fd290d9ULL, 0x10825b3323dab012ULL,
+        0x61ab4b689950e7c1ULL, 0x1a6a2b85062ab350ULL,
+        0x4e22a2ba1440b967ULL, 0x1521bc6a6b555c40ULL,
+        0x0b4ee894dd009453ULL, 0x10e7c9eebc4449cdULL,
+        0x1217da87c800ed51ULL, 0x1b0c764ac6d3a948ULL,
+        0xdb46486ca000bddaULL, 0x15a391d56bdc876cULL,
+        0x490506bd4ccd64afULL, 0x114fa7ddefe39f8aULL,
+        0xa8080ac87ae23ab1ULL, 0x1bb2a62fe638ff43ULL,
+        0x5339a239fbe82ef4ULL, 0x162884f31e93ff69ULL,
+        0x75c7b4fb2fecf25dULL, 0x11ba03f5b20fff87ULL,
+        0x22d92191e647ea2eULL, 0x1c5cd322b67fff3fULL,
+        0xb57a8141850654f2ULL, 0x16b0a8e891ffff65ULL,
+        0xc4620101373843f5ULL, 0x1226ed86db3332b7ULL,
+        0x3a366801f1f39feeULL, 0x1d0b15a491eb8459ULL,
+        0xfb5eb99b27f6198bULL, 0x173c115074bc69e0ULL,
+        0x2f7efae2865e7ad6ULL, 0x129674405d6387e7ULL,
+        0xe597f7d0d6fd9156ULL, 0x1dbd86cd6238d971ULL,
+        0x8479930d78cadaabULL, 0x17cad23de82d7ac1ULL,
+        0xd06142712d6f1556ULL, 0x1308a831868ac89aULL,
+        0x4d686a4eaf182222ULL, 0x1e74404f3daada91ULL,
+        0xa453883ef279b4e8ULL, 0x185d003f6488aedaULL,
+        0xe9dc6cff28615d87ULL, 0x137d99cc506d58aeULL,
+        0xa960ae650d6895a4ULL, 0x1f2f5c7a1a488de4ULL,
+        0xbab3beb73ded4483ULL, 0x18f2b061aea07183ULL,
+        0x2ef6322c318a9d36ULL, 0x13f559e7bee6c136ULL,
+        0xe4bd1d13827761f0ULL, 0x1feef63f97d79b89ULL,
+        0x83ca7da9352c4e5aULL, 0x198bf832dfdfafa1ULL,
+        0x9ca1fe20f756a515ULL, 0x146ff9c24cb2f2e7ULL,
+        0x4a1b31b3f9121daaULL, 0x1059949b708f28b9ULL,
+        0x435eb5ecc1b695ddULL, 0x1a28edc580e50df5ULL,
+        0x35e55e57015ede4aULL, 0x14ed8b04671da4c4ULL,
+        0xc4b77eac0118b1d5ULL, 0x10be08d0527e1d69ULL,
+        0xa12597799b5ab622ULL, 0x1ac9a7b3b7302f0fULL,
+        0x4db7ac6149155e81ULL, 0x156e1fc2f8f358d9ULL,
+        0xd7c6238107444b9bULL, 0x1124e63593f5e0adULL,
+        0x593d059b3ed3ac2bULL, 0x1b6e3d2286563449ULL,
+        0xe0fd9e15cbdc89bcULL, 0x15f1ca820511c36dULL,
+        0xb3fe18116fe3a163ULL, 0x118e3b9b37416924ULL,
+        0x866359b57fd29bd1ULL, 0x1c16c5c525357507ULL,
+        0xd1e91491330ee30eULL, 0x16789e3750f790d2ULL,
+        0x74ba76da8f3f1c0bULL, 0x11fa182c40c60d75ULL,
+        0xedf72490e531c678ULL, 0x1cc359e067a348bbULL,
+        0x8b2c1d40b75b052dULL, 0x1702ae4d1fb5d3c9ULL,
+        0x6f567dcd5f7c0424ULL, 0x12688b70e62b0fd4ULL,
+        0x7ef0c94898c66d06ULL, 0x1d74124e3d11b2edULL,
+        0x98c0a106e09ebd9fULL, 0x17900ea4fda7c257ULL,
+        0x470080d24d4bcae6ULL, 0x12d9a550caec9b79ULL,
+        0xd800ce1d487944a2ULL, 0x1e29088144adc58eULL,
+        0x1333d8176d2dd082ULL, 0x1820d39a9d57d13fULL,
+        0xa8f646792424a6ceULL, 0x134d76154aaca765ULL,
+        0x74bd3d8ea03aa47dULL, 0x1ee25688777aa56fULL,
+        0x5d64313ee6955064ULL, 0x18b51206c5fbb78cULL,
+        0x4ab68dcbebaaa6b7ULL, 0x13c40e6bd1962c70ULL,
+        0x1124161312aaa457ULL, 0x1fa01712e8f0471aULL,
+        0xda8344dc0eeee9dfULL, 0x194cdf4253f36c14ULL,
+        0xe2029d7cd8bf2180ULL, 0x143d7f6843292343ULL,
+        0x4e687dfd7a328133ULL, 0x103132b9cf541c36ULL,
+        0x4a40c9959050ceb8ULL, 0x19e851294bb9c6bdULL,
+        0x0833d477a6a70bc6ULL, 0x14b9da876fc7d231ULL,
+        0xa02976c61eec096bULL, 0x1094aed2bfd30e8dULL,
+        0x004257a364acdbdfULL, 0x1a877e1dffb81749ULL,
+        0xcd01dfb5ea23e319ULL, 0x153931b1996012a0ULL,
+        0x70ce4c91881cb5aeULL, 0x10fa8e27ade6754dULL,
+        0x1ae3adb5a69455e2ULL, 0x1b2a7d0c4970bbafULL,
+        0x7be957c4854377e8ULL, 0x15bb973d078d62f2ULL,
+        0xc987796a0435f987ULL, 0x1162df64060ab58eULL,
+        0x75a58f1006bcc271ULL, 0x1bd1656cd67788e4ULL,
+        0xf7b7a5a66bca3527ULL, 0x16411df0ab92d3e9ULL,
+        0x5fc61e1ebca1c41fULL, 0x11cdb18d560f0feeULL,
+        0xffa363646102d365ULL, 0x1c7c4f4889b1b316ULL,
+        0x32e91c504d9bdc51ULL, 0x16c9d906d48e28dfULL,
+        0x8f20e37371497d0eULL, 0x123b140576d820b2ULL,
+        0x7e9b0585820f2e7cULL, 0x1d2b533bf159cdeaULL,
+        0xcbaf379e01a5becaULL, 0x1755dc2ff447d7eeULL,
+        0x0958f94b348498a1ULL, 0x12ab168cc36cacbfULL
+    };
+    return &table[2 * i];
+}
+
+static inline const uint64_t* lr__ryu_pow5(int i) {
+    static const uint64_t table[] = {
+        0x0000000000000000ULL, 0x1000000000000000ULL,
+        0x0000000000000000ULL, 0x1400000000000000ULL,
+        0x0000000000000000ULL, 0x1900000000000000ULL,
+        0x0000000000000000ULL, 0x1f40000000000000ULL,
+        0x0000000000000000ULL, 0x1388000000000000ULL,
+        0x0000000000000000ULL, 0x186a000000000000ULL,
+        0x0000000000000000ULL, 0x1e84800000000000ULL,
+        0x0000000000000000ULL, 0x1312d00000000000ULL,
+        0x0000000000000000ULL, 0x17d7840000000000ULL,
+        0x0000000000000000ULL, 0x1dcd650000000000ULL,
+        0x0000000000000000ULL, 0x12a05f2000000000ULL,
+        0x0000000000000000ULL, 0x174876e800000000ULL,
+        0x0000000000000000ULL, 0x1d1a94a200000000ULL,
+        0x0000000000000000ULL, 0x12309ce540000000ULL,
+        0x0000000000000000ULL, 0x16bcc41e90000000ULL,
+        0x0000000000000000ULL, 0x1c6bf52634000000ULL,
+        0x0000000000000000ULL, 0x11c37937e0800000ULL,
+        0x0000000000000000ULL, 0x16345785d8a00000ULL,
+        0x0000000000000000ULL, 0x1bc16d674ec80000ULL,
+        0x0000000000000000ULL, 0x1158e460913d0000ULL,
+        0x0000000000000000ULL, 0x15af1d78b58c4000ULL,
+        0x0000000000000000ULL, 0x1b1ae4d6e2ef5000ULL,
+        0x0000000000000000ULL, 0x10f0cf064dd59200ULL,
+        0x0000000000000000ULL, 0x152d02c7e14af680ULL,
+        0x0000000000000000ULL, 0x1a784379d99db420ULL,
+        0x0000000000000000ULL, 0x108b2a2c28029094ULL,
+        0x0000000000000000ULL, 0x14adf4b7320334b9ULL,
+        0x4000000000000000ULL, 0x19d971e4fe8401e7ULL,
+        0x8800000000000000ULL, 0x1027e72f1f128130ULL,
+        0xaa00000000000000ULL, 0x1431e0fae6d7217cULL,
+        0xd480000000000000ULL, 0x193e5939a08ce9dbULL,
+        0xc9a0000000000000ULL, 0x1f8def8808b02452ULL,
+        0xbe04000000000000ULL, 0x13b8b5b5056e16b3ULL,
+        0xad85000000000000ULL, 0x18a6e32246c99c60ULL,
+        0xd8e6400000000000ULL, 0x1ed09bead87c0378ULL,
+        0x878fe80000000000ULL, 0x13426172c74d822bULL,
+        0x6973e20000000000ULL, 0x1812f9cf7920e2b6ULL,
+        0x03d0da8000000000ULL, 0x1e17b84357691b64ULL,
+        0x8262889000000000ULL, 0x12ced32a16a1b11eULL,
+        0x22fb2ab400000000ULL, 0x178287f49c4a1d66ULL,
+        0xabb9f56100000000ULL, 0x1d6329f1c35ca4bfULL,
+        0xcb54395ca0000000ULL, 0x125dfa371a19e6f7ULL,
+        0xbe2947b3c8000000ULL, 0x16f578c4e0a060b5ULL,
+        0x2db399a0ba000000ULL, 0x1cb2d6f618c878e3ULL,
+        0xfc90400474400000ULL, 0x11efc659cf7d4b8dULL,
+        0x7bb4500591500000ULL, 0x166bb7f0435c9e71ULL,
+        0xdaa16406f5a40000ULL, 0x1c06a5ec5433c60dULL,
+        0xa8a4de8459868000ULL, 0x118427b3b4a05bc8ULL,
+        0xd2ce16256fe82000ULL, 0x15e531a0a1c872baULL,
+        0x87819baecbe22800ULL, 0x1b5e7e08ca3a8f69ULL,
+        0xf4b1014d3f6d5900ULL, 0x111b0ec57e6499a1ULL,
+        0x71dd41a08f48af40ULL, 0x1561d276ddfdc00aULL,
+        0x0e549208b31adb10ULL, 0x1aba4714957d300dULL,
+        0x28f4db456ff0c8eaULL, 0x10b46c6cdd6e3e08ULL,
+        0x33321216cbecfb24ULL, 0x14e1878814c9cd8aULL,
+        0xbffe969c7ee839edULL, 0x1a19e96a19fc40ecULL,
+        0xf7ff1e21cf512434ULL, 0x105031e2503da893ULL,
+        0xf5fee5aa43256d41ULL, 0x14643e5ae44d12b8ULL,
+        0x337e9f14d3eec892ULL, 0x197d4df19d605767ULL,
+        0x005e46da08ea7ab6ULL, 0x1fdca16e04b86d41ULL,
+        0xa03aec4845928cb2ULL, 0x13e9e4e4c2f34448ULL,
+        0xc849a75a56f72fdeULL, 0x18e45e1df3b0155aULL,
+        0x7a5c1130ecb4fbd6ULL, 0x1f1d75a5709c1ab1ULL,
+        0xec798abe93f11d65ULL, 0x13726987666190aeULL,
+        0xa797ed6e38ed64bfULL, 0x184f03e93ff9f4daULL,
+        0x517de8c9c728bdefULL, 0x1e62c4e38ff87211ULL,
+        0xd2eeb17e1c7976b5ULL, 0x12fdbb0e39fb474aULL,
+        0x87aa5ddda397d462ULL, 0x17bd29d1c87a191dULL,
+        0xe994f5550c7dc97bULL, 0x1dac74463a989f64ULL,
+        0x11fd195527ce9dedULL, 0x128bc8abe49f639fULL,
+        0xd67c5faa71c24568ULL, 0x172ebad6ddc73c86ULL,
+        0x8c1b77950e32d6c2ULL, 0x1cfa698c95390ba8ULL,
+        0x57912abd28dfc639ULL, 0x121c81f7dd43a749ULL,
+        0xad75756c7317b7c8ULL, 0x16a3a275d494911bULL,
+        0x98d2d2c78fdda5baULL, 0x1c4c8b1349b9b562ULL,
+        0x9f83c3bcb9ea8794ULL, 0x11afd6ec0e14115dULL,
+        0x0764b4abe8652979ULL, 0x161bcca7119915b5ULL,
+        0x493de1d6e27e73d7ULL, 0x1ba2bfd0d5ff5b22ULL,
+        0x6dc6ad264d8f0866ULL, 0x1145b7e285bf98f5ULL,
+        0xc938586fe0f2ca80ULL, 0x159725db272f7f32ULL,
+        0x7b866e8bd92f7d20ULL, 0x1afcef51f0fb5effULL,
+        0xad34051767bdae34ULL, 0x10de1593369d1b5fULL,
+        0x9881065d41ad19c1ULL, 0x15159af804446237ULL,
+        0x7ea147f492186032ULL, 0x1a5b01b605557ac5ULL,
+        0x6f24ccf8db4f3c1fULL, 0x1078e111c3556cbbULL,
+        0x4aee003712230b27ULL, 0x14971956342ac7eaULL,
+        0xdda98044d6abcdf0ULL, 0x19bcdfabc13579e4ULL,
+        0x0a89f02b062b60b6ULL, 0x10160bcb58c16c2fULL,
+        0xcd2c6c35c7b638e4ULL, 0x141b8ebe2ef1c73aULL,
+        0x8077874339a3c71dULL, 0x1922726dbaae3909ULL,
+        0xe0956914080cb8e4ULL, 0x1f6b0f092959c74bULL,
+        0x6c5d61ac8507f38eULL, 0x13a2e965b9d81c8fULL,
+        0x4774ba17a649f072ULL, 0x188ba3bf284e23b3ULL,
+        0x1951e89d8fdc6c8fULL, 0x1eae8caef261aca0ULL,
+        0x0fd3316279e9c3d9ULL, 0x132d17ed577d0be4ULL,
+        0x13c7fdbb186434cfULL, 0x17f85de8ad5c4eddULL,
+        0x58b9fd29de7d4203ULL, 0x1df67562d8b36294ULL,
+        0xb7743e3a2b0e4942ULL, 0x12ba095dc7701d9cULL,
+        0xe5514dc8b5d1db92ULL, 0x17688bb5394c2503ULL,
+        0xdea5a13ae3465277ULL, 0x1d42aea2879f2e44ULL,
+        0x0b2784c4ce0bf38aULL, 0x1249ad2594c37cebULL,
+        0xcdf165f6018ef06dULL, 0x16dc186ef9f45c25ULL,
+        0x416dbf7381f2ac88ULL, 0x1c931e8ab871732fULL,
+        0x88e497a83137abd5ULL, 0x11dbf316b346e7fdULL,
+        0xeb1dbd923d8596caULL, 0x1652efdc6018a1fcULL,
+        0x25e52cf6cce6fc7dULL, 0x1be7abd3781eca7cULL,
+        0x97af3c1a40105dceULL, 0x1170cb642b133e8dULL,
+        0xfd9b0b20d0147542ULL, 0x15ccfe3d35d80e30ULL,
+        0x3d01cde904199292ULL, 0x1b403dcc834e11bdULL,
+        0x462120b1a28ffb9bULL, 0x1108269fd210cb16ULL,
+        0xd7a968de0b33fa82ULL, 0x154a3047c694fddbULL,
+        0xcd93c3158e00f923ULL, 0x1a9cbc59b83a3d52ULL,
+        0xc07c59ed78c09bb6ULL, 0x10a1f5b813246653ULL,
+        0xb09b7068d6f0c2a3ULL, 0x14ca732617ed7fe8ULL,
+        0xdcc24c830cacf34cULL, 0x19fd0fef9de8dfe2ULL,
+        0xc9f96fd1e7ec180fULL, 0x103e29f5c2b18bedULL,
+        0x3c77cbc661e71e13ULL, 0x144db473335deee9ULL,
+        0x8b95beb7fa60e598ULL, 0x1961219000356aa3ULL,
+        0x6e7b2e65f8f91efeULL, 0x1fb969f40042c54cULL,
+        0xc50cfcffbb9bb35fULL, 0x13d3e2388029bb4fULL,
+        0xb6503c3faa82a037ULL, 0x18c8dac6a0342a23ULL,
+        0xa3e44b4f95234844ULL, 0x1efb1178484134acULL,
+        0xe66eaf11bd360d2bULL, 0x135ceaeb2d28c0ebULL,
+        0xe00a5ad62c839075ULL, 0x183425a5f872f126ULL,
+        0x980cf18bb7a47493ULL, 0x1e412f0f768fad70ULL,
+        0x5f0816f752c6c8dcULL, 0x12e8bd69aa19cc66ULL,
+        0xf6ca1cb527787b13ULL, 0x17a2ecc414a03f7fULL,
+        0xf47ca3e2715699d7ULL, 0x1d8ba7f519c84f5fULL,
+        0xf8cde66d86d62026ULL, 0x127748f9301d319bULL,
+        0xf7016008e88ba830ULL, 0x17151b377c247e02ULL,
+        0xb4c1b80b22ae923cULL, 0x1cda62055b2d9d83ULL,
+        0x50f91306f5ad1b65ULL, 0x12087d4358fc8272ULL,
+        0xe53757c8b318623fULL, 0x168a9c942f3ba30eULL,
+        0x9e852dbadfde7acfULL, 0x1c2d43b93b0a8bd2ULL,
+        0xa3133c94cbeb0cc1ULL, 0x119c4a53c4e69763ULL,
+        0x8bd80bb9fee5cff1ULL, 0x16035ce8b6203d3cULL,
+        0xaece0ea87e9f43eeULL, 0x1b843422e3a84c8bULL,
+        0x4d40c9294f238a75ULL, 0x1132a095ce492fd7ULL,
+        0x2090fb73a2ec6d12ULL, 0x157f48bb41db7bcdULL,
+        0x68b53a508ba78856ULL, 0x1adf1aea12525ac0ULL,
+        0x417144725748b536ULL, 0x10cb70d24b7378b8ULL,
+        0x51cd958eed1ae283ULL, 0x14fe4d06de5056e6ULL,
+        0xe640faf2a8619b24ULL, 0x1a3de04895e46c9fULL,
+        0xefe89cd7a93d00f7ULL, 0x1066ac2d5daec3e3ULL,
+        0xebe2c40d938c4134ULL, 0x14805738b51a74dcULL,
+        0x26db7510f86f5181ULL, 0x19a06d06e2611214ULL,
+        0x9849292a9b4592f1ULL, 0x100444244d7cab4cULL,
+        0xbe5b73754216f7adULL, 0x1405552d60dbd61fULL,
+        0xadf25052929cb598ULL, 0x1906aa78b912cba7ULL,
+        0x996ee4673743e2ffULL, 0x1f485516e7577e91ULL,
+        0xffe54ec0828a6ddfULL, 0x138d352e5096af1aULL,
+        0xbfdea270a32d0957ULL, 0x18708279e4bc5ae1ULL,
+        0x2fd64b0ccbf84badULL, 0x1e8ca3185deb719aULL,
+        0x5de5eee7ff7b2f4cULL, 0x1317e5ef3ab32700ULL,
+        0x755f6aa1ff59fb1fULL, 0x17dddf6b095ff0c0ULL,
+        0x92b7454a7f3079e7ULL, 0x1dd55745cbb7ecf0ULL,
+        0x5bb28b4e8f7e4c30ULL, 0x12a5568b9f52f416ULL,
+        0xf29f2e22335ddf3cULL, 0x174eac2e8727b11bULL,
+        0xef46f9aac035570bULL, 0x1d22573a28f19d62ULL,
+        0xd58c5c0ab8215667ULL, 0x123576845997025dULL,
+        0x4aef730d6629ac01ULL, 0x16c2d4256ffcc2f5ULL,
+        0x9dab4fd0bfb41701ULL, 0x1c73892ecbfbf3b2ULL,
+        0xa28b11e277d08e60ULL, 0x11c835bd3f7d784fULL,
+        0x8b2dd65b15c4b1f9ULL, 0x163a432c8f5cd663ULL,
+        0x6df94bf1db35de77ULL, 0x1bc8d3f7b3340bfcULL,
+        0xc4bbcf772901ab0aULL, 0x115d847ad000877dULL,
+        0x35eac354f34215cdULL, 0x15b4e5998400a95dULL,
+        0x8365742a30129b40ULL, 0x1b221effe500d3b4ULL,
+        0xd21f689a5e0ba108ULL, 0x10f5535fef208450ULL,
+        0x06a742c0f58e894aULL, 0x1532a837eae8a565ULL,
+        0x4851137132f22b9dULL, 0x1a7f5245e5a2cebeULL,
+        0xed32ac26bfd75b42ULL, 0x108f936baf85c136ULL,
+        0xa87f57306fcd3212ULL, 0x14b378469b673184ULL,
+        0xd29f2cfc8bc07e97ULL, 0x19e056584240fde5ULL,
+        0xa3a37c1dd7584f1eULL, 0x102c35f729689eafULL,
+        0x8c8c5b254d2e62e6ULL, 0x14374374f3c2c65bULL,
+        0x6faf71eea079fb9fULL, 0x1945145230b377f2ULL,
+        0x0b9b4e6a48987a87ULL, 0x1f965966bce055efULL,
+        0x674111026d5f4c94ULL, 0x13bdf7e0360c35b5ULL,
+        0xc111554308b71fbaULL, 0x18ad75d8438f4322ULL,
+        0x7155aa93cae4e7a8ULL, 0x1ed8d34e547313ebULL,
+        0x26d58a9c5ecf10c9ULL, 0x13478410f4c7ec73ULL,
+        0xf08aed437682d4fbULL, 0x1819651531f9e78fULL,
+        0xecada89454238a3aULL, 0x1e1fbe5a7e786173ULL,
+        0x73ec895cb4963664ULL, 0x12d3d6f88f0b3ce8ULL,
+        0x90e7abb3e1bbc3fdULL, 0x1788ccb6b2ce0c22ULL,
+        0x352196a0da2ab4fdULL, 0x1d6affe45f818f2bULL,
+        0x0134fe24885ab11eULL, 0x1262dfeebbb0f97bULL,
+        0xc1823dadaa715d65ULL, 0x16fb97ea6a9d37d9ULL,
+        0x31e2cd19150db4bfULL, 0x1cba7de5054485d0ULL,
+        0x1f2dc02fad2890f7ULL, 0x11f48eaf234ad3a2ULL,
+        0xa6f9303b9872b535ULL, 0x1671b25aec1d888aULL,
+        0x50b77c4a7e8f6282ULL, 0x1c0e1ef1a724eaadULL,
+        0x5272adae8f199d91ULL, 0x1188d357087712acULL,
+        0x670f591a32e004f6ULL, 0x15eb082cca94d757ULL,
+        0x40d32f60bf980633ULL, 0x1b65ca37fd3a0d2dULL,
+        0x4883fd9c77bf03e0ULL, 0x111f9e62fe44483cULL,
+        0x5aa4fd0395aec4d8ULL, 0x156785fbbdd55a4bULL,
+        0x314e3c447b1a760eULL, 0x1ac1677aad4ab0deULL,
+        0xded0e5aaccf089c9ULL, 0x10b8e0acac4eae8aULL,
+        0x96851f15802cac3bULL, 0x14e718d7d7625a2dULL,
+        0xfc2666dae037d74aULL, 0x1a20df0dcd3af0b8ULL,
+        0x9d980048cc22e68eULL, 0x10548b68a044d673ULL,
+        0x84fe005aff2ba032ULL, 0x1469ae42c8560c10ULL,
+        0xa63d8071bef6883eULL, 0x198419d37a6b8f14ULL,
+        0xcfcce08e2eb42a4eULL, 0x1fe52048590672d9ULL,
+        0x21e00c58dd309a70ULL, 0x13ef342d37a407c8ULL,
+        0x2a580f6f147cc10dULL, 0x18eb0138858d09baULL,
+        0xb4ee134ad99bf150ULL, 0x1f25c186a6f04c28ULL,
+        0x7114cc0ec80176d2ULL, 0x137798f428562f99ULL,
+        0xcd59ff127a01d486ULL, 0x18557f31326bbb7fULL,
+        0xc0b07ed7188249a8ULL, 0x1e6adefd7f06aa5fULL,
+        0xd86e4f466f516e09ULL, 0x1302cb5e6f642a7bULL,
+        0xce89e3180b25c98bULL, 0x17c37e360b3d351aULL,
+        0x822c5bde0def3beeULL, 0x1db45dc38e0c8261ULL,
+        0xf15bb96ac8b58575ULL, 0x1290ba9a38c7d17cULL,
+        0x2db2a7c57ae2e6d2ULL, 0x1734e940c6f9c5dcULL,
+        0x391f51b6d99ba086ULL, 0x1d022390f8b83753ULL,
+        0x03b3931248014454ULL, 0x1221563a9b732294ULL,
+        0x04a077d6da019569ULL, 0x16a9abc9424feb39ULL,
+        0x45c895cc9081fac3ULL, 0x1c5416bb92e3e607ULL,
+        0x8b9d5d9fda513cbaULL, 0x11b48e353bce6fc4ULL,
+        0xae84b507d0e58be8ULL, 0x1621b1c28ac20bb5ULL,
+        0x1a25e249c51eeee3ULL, 0x1baa1e332d728ea3ULL,
+        0xf057ad6e1b33554dULL, 0x114a52dffc679925ULL,
+        0x6c6d98c9a2002aa1ULL, 0x159ce797fb817f6fULL,
+        0x4788fefc0a803549ULL, 0x1b04217dfa61df4bULL,
+        0x0cb59f5d8690214eULL, 0x10e294eebc7d2b8fULL,
+        0xcfe30734e83429a1ULL, 0x151b3a2a6b9c7672ULL,
+        0x83dbc9022241340aULL, 0x1a6208b50683940fULL,
+        0xb2695da15568c086ULL, 0x107d457124123c89ULL,
+        0x1f03b509aac2f0a7ULL, 0x149c96cd6d16cbacULL,
+        0x26c4a24c1573acd1ULL, 0x19c3bc80c85c7e97ULL,
+        0x783ae56f8d684c03ULL, 0x101a55d07d39cf1eULL,
+        0x16499ecb70c25f03ULL, 0x1420eb449c8842e6ULL,
+        0x9bdc067e4cf2f6c4ULL, 0x19292615c3aa539fULL,
+        0x82d3081de02fb476ULL, 0x1f736f9b3494e887ULL,
+        0xb1c3e512ac1dd0c9ULL, 0x13a825c100dd1154ULL,
+        0xde34de57572544fcULL, 0x18922f31411455a9ULL,
+        0x55c215ed2cee963bULL, 0x1eb6bafd91596b14ULL,
+        0xb5994db43c151de5ULL, 0x133234de7ad7e2ecULL,
+        0xe2ffa1214b1a655eULL, 0x17fec216198ddba7ULL,
+        0xdbbf89699de0feb6ULL, 0x1dfe729b9ff15291ULL,
+        0x2957b5e202ac9f31ULL, 0x12bf07a143f6d39bULL,
+        0xf3ada35a8357c6feULL, 0x176ec98994f48881ULL,
+        0x70990c31242db8bdULL, 0x1d4a7bebfa31aaa2ULL,
+        0x865fa79eb69c9376ULL, 0x124e8d737c5f0aa5ULL,
+        0xe7f791866443b854ULL, 0x16e230d05b76cd4eULL,
+        0xa1f575e7fd54a669ULL, 0x1c9abd04725480a2ULL,
+        0xa53969b0fe54e801ULL, 0x11e0b622c774d065ULL,
+        0x0e87c41d3dea2202ULL, 0x1658e3ab7952047fULL,
+        0xd229b5248d64aa82ULL, 0x1bef1c9657a6859eULL,
+        0x435a1136d85eea91ULL, 0x117571ddf6c81383ULL,
+        0x143095848e76a536ULL, 0x15d2ce55747a1864ULL,
+        0x193cbae5b2144e83ULL, 0x1b4781ead1989e7dULL,
+        0x2fc5f4cf8f4cb112ULL, 0x110cb132c2ff630eULL,
+        0xbbb77203731fdd56ULL, 0x154fdd7f73bf3bd1ULL,
+        0x2aa54e844fe7d4acULL, 0x1aa3d4df50af0ac6ULL,
+        0xdaa75112b1f0e4ebULL, 0x10a6650b926d66bbULL,
+        0xd15125575e6d1e26ULL, 0x14cffe4e7708c06aULL,
+        0x85a56ead360865b0ULL, 0x1a03fde214caf085ULL,
+        0x7387652c41c53f8eULL, 0x10427ead4cfed653ULL,
+        0x50693e7752368f71ULL, 0x14531e58a03e8be8ULL,
+        0x64838e1526c4334eULL, 0x1967e5eec84e2ee2ULL,
+        0xfda4719a70754022ULL, 0x1fc1df6a7a61ba9aULL,
+        0xde86c70086494815ULL, 0x13d92ba28c7d14a0ULL,
+        0x162878c0a7db9a1aULL, 0x18cf768b2f9c59c9ULL,
+        0x5bb296f0d1d280a1ULL, 0x1f03542dfb83703bULL,
+        0x194f9e5683239064ULL, 0x1362149cbd322625ULL,
+        0x5fa385ec23ec747eULL, 0x183a99c3ec7eafaeULL,
+        0xf78c67672ce7919dULL, 0x1e494034e79e5b99ULL,
+        0x3ab7c0a07c10bb02ULL, 0x12edc82110c2f940ULL,
+        0x4965b0c89b14e9c3ULL, 0x17a93a2954f3b790ULL,
+        0x5bbf1cfac1da2433ULL, 0x1d9388b3aa30a574ULL,
+        0xb957721cb92856a0ULL, 0x127c35704a5e6768ULL,
+        0xe7ad4ea3e7726c48ULL, 0x171b42cc5cf60142ULL,
+        0xa198a24ce14f075aULL, 0x1ce2137f74338193ULL,
+        0x44ff65700cd16498ULL, 0x120d4c2fa8a030fcULL,
+        0x563f3ecc1005bdbeULL, 0x16909f3b92c83d3bULL,
+        0x2bcf0e7f14072d2eULL, 0x1c34c70a777a4c8aULL,
+        0x5b61690f6c847c3dULL, 0x11a0fc668aac6fd6ULL,
+        0xf239c35347a59b4cULL, 0x16093b802d578bcbULL,
+        0xeec83428198f021fULL, 0x1b8b8a6038ad6ebeULL,
+        0x553d20990ff96153ULL, 0x1137367c236c6537ULL,
+        0x2a8c68bf53f7b9a8ULL, 0x1585041b2c477e85ULL,
+        0x752f82ef28f5a812ULL, 0x1ae64521f7595e26ULL,
+        0x093db1d57999890bULL, 0x10cfeb353a97dad8ULL,
+        0x0b8d1e4ad7ffeb4eULL, 0x1503e602893dd18eULL,
+        0x8e7065dd8dffe622ULL, 0x1a44df832b8d45f1ULL,
+        0xf9063faa78bfefd5ULL, 0x106b0bb1fb384bb6ULL,
+        0xb747cf9516efebcaULL, 0x1485ce9e7a065ea4ULL,
+        0xe519c37a5cabe6bdULL, 0x19a742461887f64dULL,
+        0xaf301a2c79eb7036ULL, 0x1008896bcf54f9f0ULL,
+        0xdafc20b798664c43ULL, 0x140aabc6c32a386cULL,
+        0x11bb28e57e7fdf54ULL, 0x190d56b873f4c688ULL,
+        0x1629f31ede1fd72aULL, 0x1f50ac6690f1f82aULL,
+        0x4dda37f34ad3e67aULL, 0x13926bc01a973b1aULL,
+        0xe150c5f01d88e019ULL, 0x187706b0213d09e0ULL,
+        0x19a4f76c24eb181fULL, 0x1e94c85c298c4c59ULL,
+        0xb0071aa39712ef13ULL, 0x131cfd3999f7afb7ULL,
+        0x9c08e14c7cd7aad8ULL, 0x17e43c8800759ba5ULL,
+        0x030b199f9c0d958eULL, 0x1ddd4baa0093028fULL,
+        0x61e6f003c1887d79ULL, 0x12aa4f4a405be199ULL,
+        0xba60ac04b1ea9cd7ULL, 0x1754e31cd072d9ffULL,
+        0xa8f8d705de65440dULL, 0x1d2a1be4048f907fULL,
+        0xc99b8663aaff4a88ULL, 0x123a516e82d9ba4fULL,
+        0xbc0267fc95bf1d2aULL, 0x16c8e5ca239028e3ULL,
+        0xab0301fbbb2ee474ULL, 0x1c7b1f3cac74331cULL,
+        0xeae1e13d54fd4ec9ULL, 0x11ccf385ebc89ff1ULL,
+        0x659a598caa3ca27bULL, 0x1640306766bac7eeULL,
+        0xff00efefd4cbcb1aULL, 0x1bd03c81406979e9ULL,
+        0x3f6095f5e4ff5ef0ULL, 0x116225d0c841ec32ULL,
+        0xcf38bb735e3f36acULL, 0x15baaf44fa52673eULL,
+        0x8306ea5035cf0457ULL, 0x1b295b1638e7010eULL,
+        0x11e4527221a162b6ULL, 0x10f9d8ede39060a9ULL,
+        0x565d670eaa09bb64ULL, 0x15384f295c7478d3ULL,
+        0x2bf4c0d2548c2a3dULL, 0x1a8662f3b3919708ULL,
+        0x1b78f88374d79a66ULL, 0x1093fdd8503afe65ULL,
+        0x625736a4520d8100ULL, 0x14b8fd4e6449bdfeULL,
+        0xfaed044d6690e140ULL, 0x19e73ca1fd5c2d7dULL,
+        0xbcd422b0601a8cc8ULL, 0x103085e53e599c6eULL,
+        0x6c092b5c78212ffaULL, 0x143ca75e8df0038aULL,
+        0x070b763396297bf8ULL, 0x194bd136316c046dULL,
+        0x48ce53c07bb3daf6ULL, 0x1f9ec583bdc70588ULL,
+        0x2d80f4584d5068daULL, 0x13c33b72569c6375ULL,
+        0x78e1316e60a48310ULL, 0x18b40a4eec437c52ULL
+    };
+    return &table[2 * i];
+}
+
+/* (m * mul) >> j for a 125-bit multiplier, 64 < j < 128 */
+static inline uint64_t lr__ryu_mulshift(uint64_t m, const uint64_t* mul, int j) {
+    uint64_t high0, high1, low1, sum;
+    
+    lr__mul128(m, mul[0], &high0);
+    low1 = lr__mul128(m, mul[1], &high1);
+    sum = high0 + low1;
+    high1 += (sum < high0);
+    j -= 64;
+    return (high1 << (64 - j)) | (sum >> j);
+}
+
+static inline int lr__pow5_factor(uint64_t v) {
+    int count = 0;
+    while (v % 5 == 0) {
+        v /= 5;
+        count++;
+    }
+    return count;
+}
+
+/* Ryu: shortest decimal d * 10^e10 that rounds back to mantissa/exponent.
+ * Works for any format up to binary64 given its mantissa bits and bias. */
+static inline uint64_t lr__ryu(uint64_t ieee_mantissa, uint32_t ieee_exponent,
+                               int mantissa_bits, int bias, int32_t* exp10) {
+    int32_t e2, e10, removed = 0;
+    uint64_t m2, mv, vr, vp, vm, output;
+    uint32_t mm_shift;
+    int accept_bounds, vm_trailing_zeros = 0, vr_trailing_zeros = 0;
+    uint8_t last_removed = 0;
+    
+    if (ieee_exponent == 0) {
+        e2 = 1 - bias - mantissa_bits - 2;
+        m2 = ieee_mantissa;
+    } else {
+        e2 = (int32_t)ieee_exponent - bias - mantissa_bits - 2;
+        m2 = (1ULL << mantissa_bits) | ieee_mantissa;
+    }
+    accept_bounds = (m2 & 1) == 0;
+    
+    /* The interval of decimals that round to m2 is (4*m2 - 1 - mm_shift, 4*m2 + 2) * 2^e2 */
+    mv = 4 * m2;
+    mm_shift = ieee_mantissa != 0 || ieee_exponent <= 1;
+    
+    if (e2 >= 0) {
+        uint32_t q = (((uint32_t)e2 * 78913) >> 18) - (e2 > 3);
+        int32_t k = 125 + (int32_t)((q * 1217359) >> 19) + 1 - 1;
+        int32_t i = -e2 + (int32_t)q + k;
+        const uint64_t* mul = lr__ryu_pow5_inv((int)q);
+        e10 = (int32_t)q;
+        vr = lr__ryu_mulshift(mv, mul, i);
+        vp = lr__ryu_mulshift(mv + 2, mul, i);
+        vm = lr__ryu_mulshift(mv - 1 - mm_shift, mul, i);
+        if (q <= 21) {
+            /* Only one of mp, mv and mm can be a multiple of 5, if any */
+            if (mv % 5 == 0) {
+                vr_trailing_zeros = lr__pow5_factor(mv) >= (int)q;
+            } else if (accept_bounds) {
+                vm_trailing_zeros = lr__pow5_factor(mv - 1 - mm_shift) >= (int)q;
+            } else {
+                vp -= lr__pow5_factor(mv + 2) >= (int)q;
+            }
+        }
+    } else {
+        uint32_t q = (((uint32_t)-e2 * 732923) >> 20) - (-e2 > 1);
+        int32_t i = -e2 - (int32_t)q;
+        int32_t k = (int32_t)(((uint32_t)i * 1217359) >> 19) + 1 - 125;
+        int32_t j = (int32_t)q - k;
+        const uint64_t* mul = lr__ryu_pow5(i);
+        e10 = (int32_t)q + e2;
+        vr = lr__ryu_mulshift(mv, mul, j);
+        vp = lr__ryu_mulshift(mv + 2, mul, j);
+        vm = lr__ryu_mulshift(mv - 1 - mm_shift, mul, j);
+        if (q <= 1) {
+            /* mv = 4 * m2 always has at least two trailing zero bits */
+            vr_trailing_zeros = 1;
+            if (accept_bounds) {
+                vm_trailing_zeros = mm_shift == 1;
+            } else {
+                vp--;
+            }
+        } else if (q < 63) {
+            vr_trailing_zeros = (mv & ((1ULL << q) - 1)) == 0;
+        }
+    }
+    
+    /* Drop digits while the interval still holds a shorter decimal */
+    if (vm_trailing_zeros || vr_trailing_zeros) {
+        /* Rare general case: track exact ties for round-half-even */
+        while (vp / 10 > vm / 10) {
+            vm_trailing_zeros &= vm % 10 == 0;
+            vr_trailing_zeros &= last_removed == 0;
+            last_removed = (uint8_t)(vr % 10);
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            removed++;
+        }
+        if (vm_trailing_zeros) {
+            while (vm % 10 == 0) {
+                vr_trailing_zeros &= last_removed == 0;
+                last_removed = (uint8_t)(vr % 10);
+                vr /= 10;
+                vp /= 10;
+                vm /= 10;
+                removed++;
+            }
+        }
+        if (vr_trailing_zeros && last_removed == 5 && vr % 2 == 0) {
+            last_removed = 4;
+        }
+        output = vr + ((vr == vm && (!accept_bounds || !vm_trailing_zeros)) || last_removed >= 5);
+    } else {
+        int round_up = 0;
+        if (vp / 100 > vm / 100) {
+            round_up = vr % 100 >= 50;
+            vr /= 100;
+            vp /= 100;
+            vm /= 100;
+            removed += 2;
+        }
+        while (vp / 10 > vm / 10) {
+            round_up = vr % 10 >= 5;
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+            removed++;
+        }
+        output = vr + (vr == vm || round_up);
+    }
+    
+    *exp10 = e10 + removed;
+    return output;
+}
+
+/* Format digits * 10^e10 like %g: fixed notation unless the decimal
+ * exponent is below -4 or at least max_fixed */
+static inline int lr__format_decimal(char* buf, int negative, uint64_t digits, int32_t e10, int max_fixed) {
+    char tmp[20];
+    char* p = buf;
+    int n = lr__u64toa(tmp, digits), i;
+    int32_t x = e10 + n - 1;
+    
+    if (negative) {
+        *p++ = '-';
+    }
+    
+    if (x >= -4 && x < max_fixed) {
+        if (x < 0) {
+            *p++ = '0';
+            *p++ = '.';
+            for (i = -1; i > x; i--) {
+                *p++ = '0';
+            }
+            for (i = 0; i < n; i++) {
+                *p++ = tmp[i];
+            }
+        } else {
+            for (i = 0; i < n || i <= x; i++) {
+                if (i == x + 1) {
+                    *p++ = '.';
+                }
+                *p++ = i < n ? tmp[i] : '0';
+            }
+        }
+    } else {
+        *p++ = tmp[0];
+        if (n > 1) {
+            *p++ = '.';
+            for (i = 1; i < n; i++) {
+                *p++ = tmp[i];
+            }
+        }
+        *p++ = 'e';
+        *p++ = x < 0 ? '-' : '+';
+        if (x < 0) {
+            x = -x;
+        }
+        if (x < 10) {
+            *p++ = '0';
+        }
+        p += lr__u64toa(p, (uint64_t)x);
+    }
+    
+    *p = '\0';
+    return (int)(p - buf);
+}
+
+static inline int lr__format_special(char* buf, int negative, int is_nan) {
+    char* p = buf;
+    if (negative) {
+        *p++ = '-';
+    }
+    *p++ = is_nan ? 'n' : 'i';
+    *p++ = is_nan ? 'a' : 'n';
+    *p++ = is_nan ? 'n' : 'f';
+    *p = '\0';
+    return (int)(p - buf);
+}
+
+/* Shortest string that parses back to x exactly; buf needs LR_DTOA_BUFSIZE
+ * bytes. Returns the length written, excluding the terminator. */
+static inline int dtoa_shortest(char* buf, double x) {
+    union { double d; uint64_t i; } u = { x };
+    int negative = (int)(u.i >> 63);
+    uint64_t mantissa = u.i & ((1ULL << 52) - 1);
+    uint32_t exponent = (uint32_t)(u.i >> 52) & 0x7FF;
+    uint64_t digits;
+    int32_t e10;
+    
+    if (exponent == 0x7FF) {
+        return lr__format_special(buf, negative, mantissa != 0);
+    }
+    if (exponent == 0 && mantissa == 0) {
+        return lr__format_decimal(buf, negative, 0, 0, 17);
+    }
+    
+    digits = lr__ryu(mantissa, exponent, 52, 1023, &e10);
+    return lr__format_decimal(buf, negative, digits, e10, 17);
+}
+
+static inline int ftoa_shortest(char* buf, float x) {
+    union { float f; uint32_t i; } u = { x };
+    int negative = (int)(u.i >> 31);
+    uint32_t mantissa = u.i & ((1U << 23) - 1);
+    uint32_t exponent = (u.i >> 23) & 0xFF;
+    uint64_t digits;
+    int32_t e10;
+    
+    if (exponent == 0xFF) {
+        return lr__format_special(buf, negative, mantissa != 0);
+    }
+    if (exponent == 0 && mantissa == 0) {
+        return lr__format_decimal(buf, negative, 0, 0, 9);
+    }
+    
+    digits = lr__ryu(mantissa, exponent, 23, 127, &e10);
+    return lr__format_decimal(buf, negative, digits, e10, 9);
+}
+
+/* Bounded output for the snprintf-style formatters: writes what fits in
+ * cap - 1 bytes and counts the full length */
+typedef struct {
+    char* buf;
+    size_t cap;
+    size_t len;
+} lr__out;
+
+static inline void lr__out_char(lr__out* o, char c) {
+    if (o->len + 1 < o->cap) {
+        o->buf[o->len] = c;
+    }
+    o->len++;
+}
+
+/* Runs this short are copied inline with two overlapping moves; rep
+ * movsb/stosb have a fixed startup cost that dominates for a typical field.
+ * (A byte loop would be turned back into a library memcpy/memset call.) */
+#define LR__OUT_SHORT 32
+
+/* step is all ones to copy s, or 0 to repeat its first 16 bytes */
+static inline void lr__out_short(char* d, const char* s, size_t n, size_t step) {
+    if (n >= 16) {
+        LR__COPY_FIXED(d, s, 16);
+        LR__COPY_FIXED(d + n - 16, s + ((n - 16) & step), 16);
+    } else if (n >= 8) {
+        LR__COPY_FIXED(d, s, 8);
+        LR__COPY_FIXED(d + n - 8, s + ((n - 8) & step), 8);
+    } else if (n >= 4) {
+        LR__COPY_FIXED(d, s, 4);
+        LR__COPY_FIXED(d + n - 4, s + ((n - 4) & step), 4);
+    } else if (n >= 2) {
+        LR__COPY_FIXED(d, s, 2);
+        LR__COPY_FIXED(d + n - 2, s + ((n - 2) & step), 2);
+    } else if (n) {
+        d[0] = s[0];
+    }
+}
+
+static inline void lr__out_chars(lr__out* o, const char* s, size_t n) {
+    if (o->len + n < o->cap && n <= LR__OUT_SHORT) {
+        lr__out_short(o->buf + o->len, s, n, ~(size_t)0);
+    } else if (o->len + 1 < o->cap) {
+        size_t room = o->cap - 1 - o->len;
+        memcpy(o->buf + o->len, s, n < room ? n : room);
+    }
+    o->len += n;
+}
+
+static inline void lr__out_fill(lr__out* o, char c, size_t n) {
+    if (o->len + n < o->cap && n <= LR__OUT_SHORT) {
+        uint64_t v[2];
+        v[0] = v[1] = 0x0101010101010101ULL * (unsigned char)c;
+        lr__out_short(o->buf + o->len, (const char*)v, n, 0);
+    } else if (o->len + 1 < o->cap) {
+        size_t room = o->cap - 1 - o->len;
+        memset(o->buf + o->len, c, n < room ? n : room);
+    }
+    o->len += n;
+}
+
+static inline int lr__out_finish(lr__out* o) {
+    if (o->cap) {
+        o->buf[o->len < o->cap ? o->len : o->cap - 1] = '\0';
+    }
+    return (int)o->len;
+}
+
+/* Exact decimal expansion for the fixed-precision formats. A double has at
+ * most 767 significant digits, so a bounded buffer always suffices. */
+#define LR__EXACT_DIGITS 780
+
+typedef struct {
+    char digits[LR__EXACT_DIGITS];
+    int count;          /* Significant digits in digits[]; 0 for zero */
+    int exp10;          /* Decimal exponent of digits[0] */
+} lr__exact;
+
+/* Significant digits of m * 2^e down to the 10^stop place, at most max_sig
+ * of them; *sticky is set if anything nonzero was left out */
+static inline void lr__exact_digits(lr__exact* r, uint64_t m, int e, int max_sig, int stop, int* sticky) {
+    /* Fixed point with fw fraction words: value = w / 2^(32 * fw) */
+    uint32_t w[40];
+    uint32_t chunks[40];
+    int fw = e < 0 ? (-e + 31) / 32 : 0;
+    int s = e + 32 * fw, n = s / 32 + 3, b = s % 32;
+    int nchunks = 0, count = 0, pos, lo = 0, i, j;
+    char* out = r->digits;
+    char tmp[20];
+    
+    if (max_sig > LR__EXACT_DIGITS) {
+        max_sig = LR__EXACT_DIGITS;
+    }
+    *sticky = 0;
+    
+    /* Small exponents: the integer part and the fraction each fit in 64
+     * bits, and each multiplication by 10 carries out one exact digit */
+    if (e >= -64 && e <= 10) {
+        uint64_t ip = e >= 0 ? m << e : e > -64 ? m >> -e : 0;
+        uint64_t frac = e >= 0 ? 0 : e > -64 ? m << (64 + e) : m, d;
+        
+        count = ip ? lr__u64toa(out, ip) : 0;
+        r->exp10 = count - 1;
+        if (count > max_sig) {
+            for (i = max_sig; i < count; i++) {
+                *sticky |= out[i] != '0';
+            }
+            count = max_sig;
+        }
+        for (pos = r->exp10 - count; frac && pos >= stop && count < max_sig; pos--) {
+            frac = lr__mul128(frac, 10, &d);
+            if (count > 0 || d) {
+                if (count == 0) {
+                    r->exp10 = pos;
+                }
+                out[count++] = (char)('0' + d);
+            }
+        }
+        *sticky |= frac != 0;
+        if (count == 0) {
+            r->exp10 = stop - 1;
+        }
+        r->count = count;
+        return;
+    }
+    
+    n = n > fw ? n : fw;
+    for (i = 0; i < n; i++) {
+        w[i] = 0;
+    }
+    w[s / 32] = (uint32_t)(m << b);
+    w[s / 32 + 1] = (uint32_t)(b ? m >> (32 - b) : m >> 32);
+    w[s / 32 + 2] = (uint32_t)(b ? m >> (64 - b) : 0);
+    while (n > fw && w[n - 1] == 0) {
+        n--;
+    }
+    
+    /* Integer part */
+    if (n - fw <= 2) {
+        uint64_t v = n > fw ? w[fw] | (n - fw == 2 ? (uint64_t)w[fw + 1] << 32 : 0) : 0;
+        if (v) {
+            count = lr__u64toa(out, v);
+        }
+    } else {
+        /* Peel off base-10^9 chunks, least significant first */
+        while (n > fw) {
+            uint64_t rem = 0;
+            for (i = n - 1; i >= fw; i--) {
+                uint64_t cur = (rem << 32) | w[i];
+                w[i] = (uint32_t)(cur / 1000000000U);
+                rem = cur % 1000000000U;
+            }
+            chunks[nchunks++] = (uint32_t)rem;
+            while (n > fw && w[n - 1] == 0) {
+                n--;
+            }
+        }
+        count = lr__u64toa(out, chunks[--nchunks]);
+        while (nchunks--) {
+            uint32_t c = chunks[nchunks];
+            for (j = 8; j >= 0; j--) {
+                out[count + j] = (char)('0' + c % 10);
+                c /= 10;
+            }
+            count += 9;
+        }
+    }
+    
+    r->exp10 = count - 1;
+    if (count > max_sig) {
+        for (i = max_sig; i < count; i++) {
+            *sticky |= out[i] != '0';
+        }
+        count = max_sig;
+    }
+    pos = r->exp10 - count;
+    
+    /* Fraction: each multiplication by 10^9 carries the next nine digits out
+     * of the top word */
+    while (pos >= stop && count < max_sig) {
+        uint64_t carry = 0;
+        
+        while (lo < fw && w[lo] == 0) {
+            lo++;
+        }
+        if (lo == fw) {
+            break;
+        }
+        for (i = lo; i < fw; i++) {
+            uint64_t cur = (uint64_t)w[i] * 1000000000U + carry;
+            w[i] = (uint32_t)cur;
+            carry = cur >> 32;
+        }
+        for (j = 8; j >= 0; j--) {
+            tmp[j] = (char)('0' + carry % 10);
+            carry /= 10;
+        }
+        for (j = 0; j < 9; j++, pos--) {
+            if (pos < stop || count >= max_sig) {
+                *sticky |= tmp[j] != '0';
+            } else if (count > 0 || tmp[j] != '0') {
+                if (count == 0) {
+                    r->exp10 = pos;
+                }
+                out[count++] = tmp[j];
+            }
+        }
+    }
+    for (i = lo; i < fw; i++) {
+        *sticky |= w[i] != 0;
+    }
+    
+    if (count == 0) {
+        r->exp10 = stop - 1;
+    }
+    r->count = count;
+}
+
+/* Keep the first keep digits, rounding half to even; a carry out of the
+ * top digit (9.99 -> 10.0) bumps exp10 */
+static inline void lr__exact_round(lr__exact* r, int keep, int sticky) {
+    int up, i;
+    
+    if (keep >= r->count) {
+        return;
+    }
+    if (keep < 0) {
+        r->count = 0;
+        return;
+    }
+    
+    up = r->digits[keep] > '5';
+    if (r->digits[keep] == '5') {
+        up = sticky;
+        for (i = keep + 1; i < r->count; i++) {
+            up |= r->digits[i] != '0';
+        }
+        if (!up && keep > 0) {
+            up = (r->digits[keep - 1] - '0') & 1;
+        }
+    }
+    
+    r->count = keep;
+    if (up) {
+        for (i = keep - 1; i >= 0 && r->digits[i] == '9'; i--) {
+            ;
+        }
+        if (i < 0) {
+            r->digits[0] = '1';
+            r->count = 1;
+            r->exp10++;
+        } else {
+            r->digits[i]++;
+            r->count = i + 1;
+        }
+    }
+}
+
+/* Finite nonzero x as m * 2^e */
+static inline void lr__fp_decompose(double x, uint64_t* m, int* e) {
+    union { double d; uint64_t i; } u = { x };
+    uint32_t exponent = (uint32_t)(u.i >> 52) & 0x7FF;
+    *m = u.i & ((1ULL << 52) - 1);
+    if (exponent) {
+        *m |= 1ULL << 52;
+        *e = (int)exponent - 1075;
+    } else {
+        *e = -1074;
+    }
+}
+
+/* x rounded to precision places after the point (as %.*f) */
+static inline void lr__exact_fixed(lr__exact* r, double x, int precision) {
+    uint64_t m;
+    int e, sticky;
+    
+    r->count = 0;
+    r->exp10 = 0;
+    if (x == 0) {
+        return;
+    }
+    lr__fp_decompose(x, &m, &e);
+    lr__exact_digits(r, m, e, LR__EXACT_DIGITS, -precision - 1, &sticky);
+    lr__exact_round(r, r->exp10 + precision + 1, sticky);
+}
+
+/* x rounded to digits significant digits (as %.*e with digits - 1) */
+static inline void lr__exact_sig(lr__exact* r, double x, int digits) {
+    uint64_t m;
+    int e, sticky;
+    
+    r->count = 0;
+    r->exp10 = 0;
+    if (x == 0) {
+        return;
+    }
+    lr__fp_decompose(x, &m, &e);
+    lr__exact_digits(r, m, e, digits + 1, -2000, &sticky);
+    lr__exact_round(r, digits, sticky);
+}
+
+/* alt keeps the point when no digits follow it (the '#' flag) */
+static inline void lr__emit_fixed(lr__out* o, const lr__exact* r, int precision, int alt) {
+    int written = 0;
+    
+    if (r->count == 0 || r->exp10 < 0) {
+        lr__out_char(o, '0');
+    } else {
+        int n = r->count < r->exp10 + 1 ? r->count : r->exp10 + 1;
+        lr__out_chars(o, r->digits, (size_t)n);
+        lr__out_fill(o, '0', (size_t)(r->exp10 + 1 - n));
+    }
+    if (precision > 0) {
+        lr__out_char(o, '.');
+        if (r->count) {
+            /* Zeros up to the first significant digit, the digits, then padding */
+            int lead = r->exp10 < -1 ? -r->exp10 - 1 : 0;
+            int start = r->exp10 + 1 > 0 ? r->exp10 + 1 : 0;
+            int avail;
+            
+            lead = lead < precision ? lead : precision;
+            lr__out_fill(o, '0', (size_t)lead);
+            written = lead;
+            avail = r->count - start;
+            avail = avail < precision - written ? avail : precision - written;
+            if (avail > 0) {
+                lr__out_chars(o, r->digits + start, (size_t)avail);
+                written += avail;
+            }
+        }
+        lr__out_fill(o, '0', (size_t)(precision - written));
+    } else if (alt) {
+        lr__out_char(o, '.');
+    }
+}
+
+/* alt keeps the point when no digits follow it (the '#' flag) */
+static inline void lr__emit_exp(lr__out* o, const lr__exact* r, int precision, char e, int alt) {
+    char tmp[8];
+    int x = r->count ? r->exp10 : 0, n;
+    
+    lr__out_char(o, r->count ? r->digits[0] : '0');
+    if (precision > 0 || alt) {
+        n = r->count - 1 < precision ? r->count - 1 : precision;
+        n = n < 0 ? 0 : n;
+        lr__out_char(o, '.');
+        lr__out_chars(o, r->digits + 1, (size_t)n);
+        lr__out_fill(o, '0', (size_t)(precision - n));
+    }
+    lr__out_char(o, e);
+    lr__out_char(o, x < 0 ? '-' : '+');
+    x = x < 0 ? -x : x;
+    if (x < 10) {
+        lr__out_char(o, '0');
+    }
+    n = lr__u64toa(tmp, (uint64_t)x);
+    lr__out_chars(o, tmp, (size_t)n);
+}
+
+static inline void lr__emit_special(lr__out* o, double x) {
+    char tmp[8];
+    lr__out_chars(o, tmp, (size_t)lr__format_special(tmp, 0, isnan(x)));
+}
+
+/* x with precision digits after the point, as snprintf "%.*f"; returns the
+ * full length, which may exceed cap - 1 (1e308 has 309 integer digits) */
+static inline int dtoa_fixed(char* buf, size_t cap, double x, int precision) {
+    lr__out o = { buf, cap, 0 };
+    lr__exact r;
+    
+    if (precision < 0) {
+        precision = 6;
+    }
+    if (signbit(x)) {
+        lr__out_char(&o, '-');
+    }
+    if (!isfinite(x)) {
+        lr__emit_special(&o, x);
+    } else {
+        lr__exact_fixed(&r, x, precision);
+        lr__emit_fixed(&o, &r, precision, 0);
+    }
+    return lr__out_finish(&o);
+}
+
+/* x in scientific notation with precision digits after the point, as
+ * snprintf "%.*e" */
+static inline int dtoa_exp(char* buf, size_t cap, double x, int precision) {
+    lr__out o = { buf, cap, 0 };
+    lr__exact r;
+    
+    if (precision < 0) {
+        precision = 6;
+    }
+    if (signbit(x)) {
+        lr__out_char(&o, '-');
+    }
+    if (!isfinite(x)) {
+        lr__emit_special(&o, x);
+    } else {
+        lr__exact_sig(&r, x, precision + 1);
+        lr__emit_exp(&o, &r, precision, 'e', 0);
+    }
+    return lr__out_finish(&o);
+}
+
+/* Hex encoding */
+
+/* Returned by the decoders for malformed input */
+#define LR_DECODE_ERROR ((size_t)-1)
+
+/* Writes 2 * n hex digits (no terminator) to dst; returns 2 * n */
+static inline size_t hex_encode(char* dst, const void* src, size_t n, int upper) {
+    const unsigned char* s = (const unsigned char*)src;
+    const char* digits = upper ? "0123456789ABCDEF" : "0123456789abcdef";
+    size_t i = 0;
+    
+    #if defined(LR_SIMD) && defined(__AVX2__)
+    {
+        const lr__v32 table = lr__v32_broadcast16(digits);
+        const lr__v32 nibble = lr__v32_set1(0x0F);
+        for (; i + 32 <= n; i += 32) {
+            lr__v32 v = lr__v32_interleave_lanes(lr__v32_load(s + i));
+            lr__v32 hi = lr__v32_shuffle(table, lr__v32_srl16(v, 4) & nibble);
+            lr__v32 lo = lr__v32_shuffle(table, v & nibble);
+            lr__v32_store(dst + 2 * i, lr__v32_unpacklo(hi, lo));
+            lr__v32_store(dst + 2 * i + 32, lr__v32_unpackhi(hi, lo));
+        }
+    }
+    #endif
+    #if defined(LR_SIMD) && defined(__SSSE3__)
+    {
+        const lr__v16 table = lr__v16_load(digits);
+        const lr__v16 nibble = lr__v16_set1(0x0F);
+        for (; i + 16 <= n; i += 16) {
+            lr__v16 v = lr__v16_load(s + i);
+            lr__v16 hi = lr__v16_shuffle(table, lr__v16_srl16(v, 4) & nibble);
+            lr__v16 lo = lr__v16_shuffle(table, v & nibble);
+            lr__v16_store(dst + 2 * i, lr__v16_unpacklo(hi, lo));
+            lr__v16_store(dst + 2 * i + 16, lr__v16_unpackhi(hi, lo));
+        }
+    }
+    #endif
+    
+    for (; i < n; i++) {
+        dst[2 * i] = digits[s[i] >> 4];
+        dst[2 * i + 1] = digits[s[i] & 15];
+    }
+    
+    return 2 * n;
+}
+
+/* Decodes n hex digits (either case) into n / 2 bytes; returns n / 2, or
+ * LR_DECODE_ERROR if n is odd or a character is not a hex digit (dst is
+ * then partially written) */
+static inline size_t hex_decode(void* dst, const char* src, size_t n) {
+    unsigned char* d = (unsigned char*)dst;
+    size_t i = 0;
+    
+    if (n & 1) {
+        return LR_DECODE_ERROR;
+    }
+    
+    /* Per byte: digits keep their low nibble, letters (case folded) add 9;
+     * then pmaddubsw forms hi * 16 + lo from each pair */
+    #if defined(LR_SIMD) && defined(__AVX2__)
+    {
+        const lr__v32 below0 = lr__v32_set1('0' - 1), above9 = lr__v32_set1('9' + 1);
+        const lr__v32 belowa = lr__v32_set1('a' - 1), abovef = lr__v32_set1('f' + 1);
+        const lr__v32 fold = lr__v32_set1(0x20), nibble = lr__v32_set1(0x0F), nine = lr__v32_set1(9);
+        const lr__v32 weights = { 16, 1, 16, 1, 16, 1, 16, 1, 16, 1, 16, 1, 16, 1, 16, 1,
+                                  16, 1, 16, 1, 16, 1, 16, 1, 16, 1, 16, 1, 16, 1, 16, 1 };
+        for (; i + 64 <= n; i += 64) {
+            lr__v32 a = lr__v32_load(src + i), b = lr__v32_load(src + i + 32);
+            lr__v32 la = a | fold, lb = b | fold;
+            lr__v32 alpha_a = lr__v32_cmpgt(la, belowa) & lr__v32_cmpgt(abovef, la);
+            lr__v32 alpha_b = lr__v32_cmpgt(lb, belowa) & lr__v32_cmpgt(abovef, lb);
+            lr__v32 digit_a = lr__v32_cmpgt(a, below0) & lr__v32_cmpgt(above9, a);
+            lr__v32 digit_b = lr__v32_cmpgt(b, below0) & lr__v32_cmpgt(above9, b);
+            if ((lr__v32_movemask(alpha_a | digit_a) & lr__v32_movemask(alpha_b | digit_b)) != 0xFFFFFFFFU) {
+                return LR_DECODE_ERROR;
+            }
+            a = lr__v32_maddubs((a & nibble) + (alpha_a & nine), weights);
+            b = lr__v32_maddubs((b & nibble) + (alpha_b & nine), weights);
+            lr__v32_store(d + i / 2, lr__v32_interleave_lanes(lr__v32_packus16(a, b)));
+        }
+    }
+    #endif
+    #if defined(LR_SIMD) && defined(__SSSE3__)
+    {
+        const lr__v16 below0 = lr__v16_set1('0' - 1), above9 = lr__v16_set1('9' + 1);
+        const lr__v16 belowa = lr__v16_set1('a' - 1), abovef = lr__v16_set1('f' + 1);
+        const lr__v16 fold = lr__v16_set1(0x20), nibble = lr__v16_set1(0x0F), nine = lr__v16_set1(9);
+        const lr__v16 weights = { 16, 1, 16, 1, 16, 1, 16, 1, 16, 1, 16, 1, 16, 1, 16, 1 };
+        for (; i + 32 <= n; i += 32) {
+            lr__v16 a = lr__v16_load(src + i), b = lr__v16_load(src + i + 16);
+            lr__v16 la = a | fold, lb = b | fold;
+            lr__v16 alpha_a = lr__v16_cmpgt(la, belowa) & lr__v16_cmpgt(abovef, la);
+            lr__v16 alpha_b = lr__v16_cmpgt(lb, belowa) & lr__v16_cmpgt(abovef, lb);
+            lr__v16 digit_a = lr__v16_cmpgt(a, below0) & lr__v16_cmpgt(above9, a);
+            lr__v16 digit_b = lr__v16_cmpgt(b, below0) & lr__v16_cmpgt(above9, b);
+            if ((lr__v16_movemask(alpha_a | digit_a) & lr__v16_movemask(alpha_b | digit_b)) != 0xFFFF) {
+                return LR_DECODE_ERROR;
+            }
+            a = lr__v16_maddubs((a & nibble) + (alpha_a & nine), weights);
+            b = lr__v16_maddubs((b & nibble) + (alpha_b & nine), weights);
+            lr__v16_store(d + i / 2, lr__v16_packus16(a, b));
+        }
+    }
+    #endif
+    
+    for (; i < n; i += 2) {
+        unsigned hi = lr__digit_value((unsigned char)src[i]);
+        unsigned lo = lr__digit_value((unsigned char)src[i + 1]);
+        if ((hi | lo) >= 16) {
+            return LR_DECODE_ERROR;
+        }
+        d[i / 2] = (unsigned char)(hi << 4 | lo);
+    }
+    
+    return n / 2;
+}
+
+/* Base64 */
+
+/* Encoded length: padded for the standard alphabet, unpadded for base64url */
+static inline size_t base64_encoded_len(size_t n) {
+    return (n + 2) / 3 * 4;
+}
+
+static inline size_t base64url_encoded_len(size_t n) {
+    return n / 3 * 4 + (n % 3 ? n % 3 + 1 : 0);
+}
+
+/* Exact decoded length of n characters, or LR_DECODE_ERROR if no valid
+ * input has that shape; characters themselves are checked when decoding */
+static inline size_t base64_decoded_len(const char* src, size_t n) {
+    if (n % 4) {
+        return LR_DECODE_ERROR;
+    }
+    if (n == 0) {
+        return 0;
+    }
+    return n / 4 * 3 - (src[n - 1] == '=') - (src[n - 1] == '=' && src[n - 2] == '=');
+}
+
+static inline size_t base64url_decoded_len(const char* src, size_t n) {
+    if (n % 4 == 0 && n && src[n - 1] == '=') {
+        n -= 1 + (src[n - 2] == '=');
+    }
+    if (n % 4 == 1) {
+        return LR_DECODE_ERROR;
+    }
+    return n / 4 * 3 + (n % 4 ? n % 4 - 1 : 0);
+}
+
+#if defined(LR_SIMD) && defined(__SSSE3__)
+/* Muła's encoder: spread 12 bytes into 16 six-bit indices, then map each
+ * index range to ASCII with one pshufb of per-range offsets */
+static inline lr__v16 lr__base64_encode16(lr__v16 in, lr__v16 offsets) {
+    const lr__v16 spread = { 1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10 };
+    lr__v16 t0, t1, idx, r;
+    
+    in = lr__v16_shuffle(in, spread);
+    t0 = lr__v16_mulhi_u16(in & lr__v16_set1_32(0x0FC0FC00), lr__v16_set1_32(0x04000040));
+    t1 = lr__v16_mullo_16(in & lr__v16_set1_32(0x003F03F0), lr__v16_set1_32(0x01000010));
+    idx = t0 | t1;
+    
+    r = lr__v16_subs_u8(idx, lr__v16_set1(51));
+    r |= lr__v16_cmpgt(lr__v16_set1(26), idx) & lr__v16_set1(13);
+    return lr__v16_shuffle(offsets, r) + idx;
+}
+
+/* 16 characters to 16 six-bit values; *valid collects the per-byte result */
+static inline lr__v16 lr__base64_values16(lr__v16 c, char c62, char c63, unsigned* valid) {
+    lr__v16 upper = lr__v16_cmpgt(c, lr__v16_set1('A' - 1)) & lr__v16_cmpgt(lr__v16_set1('Z' + 1), c);
+    lr__v16 lower = lr__v16_cmpgt(c, lr__v16_set1('a' - 1)) & lr__v16_cmpgt(lr__v16_set1('z' + 1), c);
+    lr__v16 digit = lr__v16_cmpgt(c, lr__v16_set1('0' - 1)) & lr__v16_cmpgt(lr__v16_set1('9' + 1), c);
+    lr__v16 is62 = lr__v16_cmpeq(c, lr__v16_set1(c62));
+    lr__v16 is63 = lr__v16_cmpeq(c, lr__v16_set1(c63));
+    
+    *valid &= lr__v16_movemask(upper | lower | digit | is62 | is63);
+    return c + ((upper & lr__v16_set1(-'A')) | (lower & lr__v16_set1(26 - 'a')) |
+                (digit & lr__v16_set1(52 - '0')) | (is62 & lr__v16_set1((char)(62 - c62))) |
+                (is63 & lr__v16_set1((char)(63 - c63))));
+}
+
+/* 16 six-bit values to 12 bytes in the low lanes */
+static inline lr__v16 lr__base64_pack16(lr__v16 v) {
+    const lr__v16 order = { 2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1 };
+    v = lr__v16_maddubs(v, lr__v16_set1_32(0x01400140));
+    v = lr__v16_madd16(v, lr__v16_set1_32(0x00011000));
+    return lr__v16_shuffle(v, order);
+}
+#endif
+
+#if defined(LR_SIMD) && defined(__AVX2__)
+static inline lr__v32 lr__base64_encode32(lr__v32 in, lr__v32 offsets) {
+    /* Loaded from 4 bytes before the block: lane 0 holds input bytes 0-11 at
+     * offset 4, lane 1 holds bytes 12-23 at offset 0 */
+    const lr__v32 spread = { 5, 4, 6, 5, 8, 7, 9, 8, 11, 10, 12, 11, 14, 13, 15, 14,
+                             1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10 };
+    lr__v32 t0, t1, idx, r;
+    
+    in = lr__v32_shuffle(in, spread);
+    t0 = lr__v32_mulhi_u16(in & lr__v32_set1_32(0x0FC0FC00), lr__v32_set1_32(0x04000040));
+    t1 = lr__v32_mullo_16(in & lr__v32_set1_32(0x003F03F0), lr__v32_set1_32(0x01000010));
+    idx = t0 | t1;
+    
+    r = lr__v32_subs_u8(idx, lr__v32_set1(51));
+    r |= lr__v32_cmpgt(lr__v32_set1(26), idx) & lr__v32_set1(13);
+    return lr__v32_shuffle(offsets, r) + idx;
+}
+
+static inline lr__v32 lr__base64_values32(lr__v32 c, char c62, char c63, unsigned* valid) {
+    lr__v32 upper = lr__v32_cmpgt(c, lr__v32_set1('A' - 1)) & lr__v32_cmpgt(lr__v32_set1('Z' + 1), c);
+    lr__v32 lower = lr__v32_cmpgt(c, lr__v32_set1('a' - 1)) & lr__v32_cmpgt(lr__v32_set1('z' + 1), c);
+    lr__v32 digit = lr__v32_cmpgt(c, lr__v32_set1('0' - 1)) & lr__v32_cmpgt(lr__v32_set1('9' + 1), c);
+    lr__v32 is62 = lr__v32_cmpeq(c, lr__v32_set1(c62));
+    lr__v32 is63 = lr__v32_cmpeq(c, lr__v32_set1(c63));
+    
+    *valid &= lr__v32_movemask(upper | lower | digit | is62 | is63);
+    return c + ((upper & lr__v32_set1(-'A')) | (lower & lr__v32_set1(26 - 'a')) |
+                (digit & lr__v32_set1(52 - '0')) | (is62 & lr__v32_set1((char)(62 - c62))) |
+                (is63 & lr__v32_set1((char)(63 - c63))));
+}
+
+/* 32 six-bit values to 24 bytes in the low 24 lanes */
+static inline lr__v32 lr__base64_pack32(lr__v32 v) {
+    const lr__v32 order = { 2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+                            2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1 };
+    typedef uint32_t lr__u32x8 __attribute__((vector_size(32)));
+    const lr__u32x8 compact = { 0, 1, 2, 4, 5, 6, 3, 7 };
+    v = lr__v32_maddubs(v, lr__v32_set1_32(0x01400140));
+    v = lr__v32_madd16(v, lr__v32_set1_32(0x00011000));
+    return lr__v32_permute32(lr__v32_shuffle(v, order), (lr__v32)compact);
+}
+#endif
+
+static inline size_t lr__base64_encode(char* dst, const void* src, size_t n, const char* alphabet, int pad) {
+    const unsigned char* s = (const unsigned char*)src;
+    char* d = dst;
+    size_t i = 0;
+    
+    #if defined(LR_SIMD) && defined(__SSSE3__)
+    {
+        const char c62 = alphabet[62], c63 = alphabet[63];
+        const lr__v16 offsets = { 'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                  '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                  (char)(c62 - 62), (char)(c63 - 63), 'A', 0, 0 };
+        #ifdef __AVX2__
+        if (n >= 32) {
+            const lr__v32 offsets32 = { 'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                        '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                        (char)(c62 - 62), (char)(c63 - 63), 'A', 0, 0,
+                                        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                        '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                        (char)(c62 - 62), (char)(c63 - 63), 'A', 0, 0 };
+            /* The first block goes through SSSE3 so later loads can start 4 bytes back */
+            lr__v16_store(d, lr__base64_encode16(lr__v16_load(s), offsets));
+            i = 12;
+            d += 16;
+            for (; i + 28 <= n; i += 24, d += 32) {
+                lr__v32_store(d, lr__base64_encode32(lr__v32_load(s + i - 4), offsets32));
+            }
+        }
+        #endif
+        for (; i + 16 <= n; i += 12, d += 16) {
+            lr__v16_store(d, lr__base64_encode16(lr__v16_load(s + i), offsets));
+        }
+    }
+    #endif
+    
+    for (; i + 3 <= n; i += 3) {
+        uint32_t v = (uint32_t)s[i] << 16 | (uint32_t)s[i + 1] << 8 | s[i + 2];
+        *d++ = alphabet[v >> 18];
+        *d++ = alphabet[(v >> 12) & 63];
+        *d++ = alphabet[(v >> 6) & 63];
+        *d++ = alphabet[v & 63];
+    }
+    if (i < n) {
+        uint32_t v = (uint32_t)s[i] << 16 | (i + 1 < n ? (uint32_t)s[i + 1] << 8 : 0);
+        *d++ = alphabet[v >> 18];
+        *d++ = alphabet[(v >> 12) & 63];
+        if (i + 1 < n) {
+            *d++ = alphabet[(v >> 6) & 63];
+        } else if (pad) {
+            *d++ = '=';
+        }
+        if (pad) {
+            *d++ = '=';
+        }
+    }
+    
+    return (size_t)(d - dst);
+}
+
+/* Six-bit value of c, or 64 if it is not in the alphabet */
+static inline unsigned lr__base64_value(int c, int c62, int c63) {
+    if (c >= 'A' && c <= 'Z') return (unsigned)(c - 'A');
+    if (c >= 'a' && c <= 'z') return (unsigned)(c - 'a' + 26);
+    if (c >= '0' && c <= '9') return (unsigned)(c - '0' + 52);
+    if (c == c62) return 62;
+    if (c == c63) return 63;
+    return 64;
+}
+
+/* pad_required: 1 demands '=' padding, 0 accepts it only if correct */
+static inline size_t lr__base64_decode(void* dst, const char* src, size_t n, char c62, char c63, int pad_required) {
+    unsigned char* d = (unsigned char*)dst;
+    size_t i = 0, len;
+    unsigned a, b, c, e;
+    
+    len = pad_required ? base64_decoded_len(src, n) : base64url_decoded_len(src, n);
+    if (len == LR_DECODE_ERROR) {
+        return LR_DECODE_ERROR;
+    }
+    if (n % 4 == 0 && n && src[n - 1] == '=') {
+        n -= 1 + (src[n - 2] == '=');
+    }
+    
+    /* Each vector block writes a few bytes past its output; the trailing
+     * characters left for the scalar loop guarantee that room exists */
+    #if defined(LR_SIMD) && defined(__AVX2__)
+    for (; i + 48 <= n; i += 32, d += 24) {
+        unsigned valid = ~0U;
+        lr__v32 v = lr__base64_values32(lr__v32_load(src + i), c62, c63, &valid);
+        if (valid != ~0U) {
+            return LR_DECODE_ERROR;
+        }
+        lr__v32_store(d, lr__base64_pack32(v));
+    }
+    #endif
+    #if defined(LR_SIMD) && defined(__SSSE3__)
+    for (; i + 24 <= n; i += 16, d += 12) {
+        unsigned valid = 0xFFFF;
+        lr__v16 v = lr__base64_values16(lr__v16_load(src + i), c62, c63, &valid);
+        if (valid != 0xFFFF) {
+            return LR_DECODE_ERROR;
+        }
+        lr__v16_store(d, lr__base64_pack16(v));
+    }
+    #endif
+    
+    for (; i + 4 <= n; i += 4) {
+        a = lr__base64_value((unsigned char)src[i], c62, c63);
+        b = lr__base64_value((unsigned char)src[i + 1], c62, c63);
+        c = lr__base64_value((unsigned char)src[i + 2], c62, c63);
+        e = lr__base64_value((unsigned char)src[i + 3], c62, c63);
+        if ((a | b | c | e) >= 64) {
+            return LR_DECODE_ERROR;
+        }
+        *d++ = (unsigned char)(a << 2 | b >> 4);
+        *d++ = (unsigned char)(b << 4 | c >> 2);
+        *d++ = (unsigned char)(c << 6 | e);
+    }
+    
+    /* Final partial quantum; unused low bits must be zero (canonical form) */
+    if (i < n) {
+        a = lr__base64_value((unsigned char)src[i], c62, c63);
+        b = lr__base64_value((unsigned char)src[i + 1], c62, c63);
+        c = n - i == 3 ? lr__base64_value((unsigned char)src[i + 2], c62, c63) : 0;
+        if ((a | b | c) >= 64 || (n - i == 2 ? b & 15 : c & 3)) {
+            return LR_DECODE_ERROR;
+        }
+        *d++ = (unsigned char)(a << 2 | b >> 4);
+        if (n - i == 3) {
+            *d++ = (unsigned char)(b << 4 | c >> 2);
+        }
+    }
+    
+    return len;
+}
+
+/* Standard alphabet with '=' padding; returns the characters written */
+static inline size_t base64_encode(char* dst, const void* src, size_t n) {
+    return lr__base64_encode(dst, src, n, "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/", 1);
+}
+
+/* URL-safe alphabet ('-' and '_'), unpadded as in JWTs */
+static inline size_t base64url_encode(char* dst, const void* src, size_t n) {
+    return lr__base64_encode(dst, src, n, "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_", 0);
+}
+
+/* Padded standard base64; returns the bytes written or LR_DECODE_ERROR for
+ * bad characters, bad padding or nonzero trailing bits */
+static inline size_t base64_decode(void* dst, const char* src, size_t n) {
+    return lr__base64_decode(dst, src, n, '+', '/', 1);
+}
+
+/* base64url, with or without (correct) padding */
+static inline size_t base64url_decode(void* dst, const char* src, size_t n) {
+    return lr__base64_decode(dst, src, n, '-', '_', 0);
+}
+
+/* Formatted output */
+
+#define LR__FMT_LEFT  0x01
+#define LR__FMT_PLUS  0x02
+#define LR__FMT_SPACE 0x04
+#define LR__FMT_ALT   0x08
+#define LR__FMT_ZERO  0x10
+
+/* Width or precision given as '*', taken from an int argument */
+#define LR__FMT_STAR  (-2)
+
+/* The parser is constexpr in C++14 so formats can be split at compile time */
+#if defined(__cplusplus) && __cplusplus >= 201402L
+#define LR__CONSTEXPR constexpr
+#else
+#define LR__CONSTEXPR
+#endif
+
+/* One "%[flags][width][.precision][length]conv" specification */
+typedef struct {
+    char conv;          /* 0 if the format ended after the '%' */
+    char length;        /* 0, 'H' (hh), 'h', 'l', 'q' (ll), 'j', 'z', 't', 'L' */
+    unsigned char flags;
+    int width;          /* 0 if absent */
+    int precision;      /* -1 if absent */
+} lr__fmtspec;
+
+/* An argument already widened according to its specification */
+typedef union {
+    long long i;
+    unsigned long long u;
+    double d;
+    const void* p;
+} lr__fmtarg;
+
+/* End of the literal run at f: the next '%' or the terminator */
+static inline LR__CONSTEXPR const char* lr__fmt_literal(const char* f) {
+    while (*f && *f != '%') {
+        f++;
+    }
+    return f;
+}
+
+/* lr__fmt_literal 16 bytes at a time, for formats parsed at run time */
+static inline const char* lr__fmt_scan(const char* f) {
+    #ifdef LR_SIMD
+    const lr__v16 pct = lr__v16_set1('%');
+    const lr__v16 nul = lr__v16_set1(0);
+    while (lr__v16_page_safe(f)) {
+        lr__v16 v = lr__v16_load(f);
+        unsigned m = lr__v16_movemask(lr__v16_cmpeq(v, pct) | lr__v16_cmpeq(v, nul));
+        if (m) {
+            return f + __builtin_ctz(m);
+        }
+        f += 16;
+    }
+    #endif
+    return lr__fmt_literal(f);
+}
+
+static inline LR__CONSTEXPR int lr__fmt_number(const char** f) {
+    int n = 0;
+    for (; **f >= '0' && **f <= '9'; (*f)++) {
+        if (n < 100000000) {
+            n = n * 10 + (**f - '0');
+        }
+    }
+    return n;
+}
+
+/* Parses the specification after a '%'; returns the character after it */
+static inline LR__CONSTEXPR const char* lr__fmt_parse(const char* f, lr__fmtspec* spec) {
+    spec->length = 0;
+    spec->flags = 0;
+    spec->width = 0;
+    spec->precision = -1;
+    
+    for (;; f++) {
+        if (*f == '-') {
+            spec->flags |= LR__FMT_LEFT;
+        } else if (*f == '+') {
+            spec->flags |= LR__FMT_PLUS;
+        } else if (*f == ' ') {
+            spec->flags |= LR__FMT_SPACE;
+        } else if (*f == '#') {
+            spec->flags |= LR__FMT_ALT;
+        } else if (*f == '0') {
+            spec->flags |= LR__FMT_ZERO;
+        } else {
+            break;
+        }
+    }
+    
+    if (*f == '*') {
+        spec->width = LR__FMT_STAR;
+        f++;
+    } else {
+        spec->width = lr__fmt_number(&f);
+    }
+    if (*f == '.') {
+        f++;
+        if (*f == '*') {
+            spec->precision = LR__FMT_STAR;
+            f++;
+        } else {
+            spec->precision = lr__fmt_number(&f);
+        }
+    }
+    
+    if (*f == 'h' || *f == 'l') {
+        spec->length = *f++;
+        if (*f == spec->length) {
+            spec->length = *f++ == 'h' ? 'H' : 'q';
+        }
+    } else if (*f == 'j' || *f == 'z' || *f == 't' || *f == 'L') {
+        spec->length = *f++;
+    }
+    
+    spec->conv = *f;
+    return *f ? f + 1 : f;
+}
+
+/* Next argument for spec from the va_list; conversions that take none
+ * ('%' and unknown ones) leave it alone */
+static inline lr__fmtarg lr__fmt_fetch(const lr__fmtspec* spec, va_list* ap) {
+    lr__fmtarg a;
+    char c = spec->conv, len = spec->length;
+    
+    a.u = 0;
+    if (c == 'd' || c == 'i') {
+        if (len == 'l') {
+            a.i = va_arg(*ap, long);
+        } else if (len == 'q') {
+            a.i = va_arg(*ap, long long);
+        } else if (len == 'j') {
+            a.i = va_arg(*ap, intmax_t);
+        } else if (len == 'z' || len == 't') {
+            a.i = va_arg(*ap, ptrdiff_t);
+        } else {
+            a.i = va_arg(*ap, int);
+            a.i = len == 'H' ? (signed char)a.i : len == 'h' ? (short)a.i : a.i;
+        }
+    } else if (c == 'u' || c == 'x' || c == 'X' || c == 'o') {
+        if (len == 'l') {
+            a.u = va_arg(*ap, unsigned long);
+        } else if (len == 'q') {
+            a.u = va_arg(*ap, unsigned long long);
+        } else if (len == 'j') {
+            a.u = va_arg(*ap, uintmax_t);
+        } else if (len == 'z' || len == 't') {
+            a.u = va_arg(*ap, size_t);
+        } else {
+            a.u = va_arg(*ap, unsigned);
+            a.u = len == 'H' ? (unsigned char)a.u : len == 'h' ? (unsigned short)a.u : a.u;
+        }
+    } else if (c == 'c') {
+        a.i = va_arg(*ap, int);
+    } else if (c == 's' || c == 'p') {
+        a.p = va_arg(*ap, const void*);
+    } else if (c == 'f' || c == 'F' || c == 'e' || c == 'E' || c == 'g' || c == 'G') {
+        a.d = len == 'L' ? (double)va_arg(*ap, long double) : va_arg(*ap, double);
+    }
+    return a;
+}
+
+/* Width padding around a body of n characters: spaces (or zeros after the
+ * prefix with the '0' flag) go out now; returns the spaces owed after the
+ * body when left-justified */
+static inline size_t lr__fmt_pad(lr__out* o, int flags, int width, const char* prefix, size_t plen, size_t zeros, size_t n) {
+    size_t total = plen + zeros + n;
+    size_t pad = (size_t)width > total ? (size_t)width - total : 0;
+    
+    if (flags & LR__FMT_LEFT) {
+        lr__out_chars(o, prefix, plen);
+        lr__out_fill(o, '0', zeros);
+        return pad;
+    }
+    if (flags & LR__FMT_ZERO) {
+        zeros += pad;
+    } else {
+        lr__out_fill(o, ' ', pad);
+    }
+    lr__out_chars(o, prefix, plen);
+    lr__out_fill(o, '0', zeros);
+    return 0;
+}
+
+static inline void lr__fmt_integer(lr__out* o, char conv, int flags, int width, int precision, lr__fmtarg arg) {
+    char digits[24], prefix[2];
+    char* p = digits + sizeof digits;
+    unsigned long long u = arg.u;
+    size_t plen = 0, n, zeros, after;
+    
+    /* Plain %d/%u with room for any value: digits go straight to the buffer */
+    if (!flags && !width && precision < 0 && conv != 'x' && conv != 'X' && conv != 'o' && o->len + 21 < o->cap) {
+        p = o->buf + o->len;
+        if (conv != 'u' && arg.i < 0) {
+            *p++ = '-';
+            u = 0 - u;
+        }
+        o->len = (size_t)(p - o->buf) + (size_t)lr__u64toa(p, u);
+        return;
+    }
+    
+    if (conv == 'd' || conv == 'i') {
+        if (arg.i < 0) {
+            prefix[plen++] = '-';
+            u = 0 - u;
+        } else if (flags & LR__FMT_PLUS) {
+            prefix[plen++] = '+';
+        } else if (flags & LR__FMT_SPACE) {
+            prefix[plen++] = ' ';
+        }
+    }
+    
+    if (conv == 'x' || conv == 'X') {
+        const char* hex = conv == 'x' ? "0123456789abcdef" : "0123456789ABCDEF";
+        do {
+            *--p = hex[u & 15];
+            u >>= 4;
+        } while (u);
+        n = (size_t)(digits + sizeof digits - p);
+        if ((flags & LR__FMT_ALT) && arg.u) {
+            prefix[plen++] = '0';
+            prefix[plen++] = conv;
+        }
+    } else if (conv == 'o') {
+        do {
+            *--p = (char)('0' + (u & 7));
+            u >>= 3;
+        } while (u);
+        n = (size_t)(digits + sizeof digits - p);
+    } else {
+        p = digits;
+        n = (size_t)lr__u64toa(digits, u);
+    }
+    
+    if (precision == 0 && arg.u == 0) {
+        n = 0;
+    }
+    zeros = precision > 0 && (size_t)precision > n ? (size_t)precision - n : 0;
+    if (conv == 'o' && (flags & LR__FMT_ALT) && zeros == 0 && (n == 0 || *p != '0')) {
+        zeros = 1;
+    }
+    if (precision >= 0) {
+        flags &= ~LR__FMT_ZERO;
+    }
+    
+    after = lr__fmt_pad(o, flags, width, prefix, plen, zeros, n);
+    lr__out_chars(o, p, n);
+    lr__out_fill(o, ' ', after);
+}
+
+/* %f, %e and %g (and their uppercase forms) */
+static inline void lr__fmt_float(lr__out* o, char conv, int flags, int width, int precision, double x) {
+    lr__exact r;
+    char prefix[1];
+    char style = (char)(conv | 0x20);
+    int alt = (flags & LR__FMT_ALT) != 0, x10;
+    size_t plen = 0, n, after;
+    
+    if (signbit(x)) {
+        prefix[plen++] = '-';
+    } else if (flags & LR__FMT_PLUS) {
+        prefix[plen++] = '+';
+    } else if (flags & LR__FMT_SPACE) {
+        prefix[plen++] = ' ';
+    }
+    
+    if (!isfinite(x)) {
+        const char* s = isnan(x) ? (conv & 0x20 ? "nan" : "NAN") : (conv & 0x20 ? "inf" : "INF");
+        after = lr__fmt_pad(o, flags & ~LR__FMT_ZERO, width, prefix, plen, 0, 3);
+        lr__out_chars(o, s, 3);
+        lr__out_fill(o, ' ', after);
+        return;
+    }
+    
+    if (precision < 0) {
+        precision = 6;
+    }
+    if (style == 'g') {
+        /* Round to P significant digits, then pick the notation from the
+         * resulting exponent; trailing zeros go unless '#' */
+        int sig = precision ? precision : 1;
+        lr__exact_sig(&r, x, sig);
+        x10 = r.count ? r.exp10 : 0;
+        if (!alt) {
+            while (r.count > 0 && r.digits[r.count - 1] == '0') {
+                r.count--;
+            }
+        }
+        if (x10 < sig && x10 >= -4) {
+            style = 'f';
+            precision = sig - 1 - x10;
+            if (!alt && precision > r.count - 1 - x10) {
+                precision = r.count - 1 - x10 > 0 ? r.count - 1 - x10 : 0;
+            }
+        } else {
+            style = 'e';
+            precision = sig - 1;
+            if (!alt && precision > r.count - 1) {
+                precision = r.count - 1 > 0 ? r.count - 1 : 0;
+            }
+        }
+    } else if (style == 'e') {
+        lr__exact_sig(&r, x, precision + 1);
+    } else {
+        lr__exact_fixed(&r, x, precision);
+    }
+    
+    /* Body length, so the padding can go first */
+    n = precision > 0 || alt ? (size_t)precision + 1 : 0;
+    x10 = r.count ? r.exp10 : 0;
+    if (style == 'f') {
+        n += x10 >= 0 ? (size_t)x10 + 1 : 1;
+    } else {
+        n += x10 <= -100 || x10 >= 100 ? 6 : 5;     /* d, e, sign, exponent */
+    }
+    
+    after = lr__fmt_pad(o, flags, width, prefix, plen, 0, n);
+    if (style == 'f') {
+        lr__emit_fixed(o, &r, precision, alt);
+    } else {
+        lr__emit_exp(o, &r, precision, conv & 0x20 ? 'e' : 'E', alt);
+    }
+    lr__out_fill(o, ' ', after);
+}
+
+/* Formats one conversion with width and precision resolved; a negative
+ * width ('*') left-justifies, a negative precision means none */
+static inline void lr__fmt_emit(lr__out* o, const lr__fmtspec* spec, int width, int precision, lr__fmtarg arg) {
+    char c = spec->conv;
+    int flags = spec->flags;
+    size_t n, after;
+    
+    if (width < 0) {
+        flags |= LR__FMT_LEFT;
+        width = width < -0x3FFFFFFF ? 0x3FFFFFFF : -width;
+    }
+    if (flags & LR__FMT_LEFT) {
+        flags &= ~LR__FMT_ZERO;
+    }
+    
+    if (c == 'd' || c == 'i' || c == 'u' || c == 'x' || c == 'X' || c == 'o') {
+        lr__fmt_integer(o, c, flags, width, precision, arg);
+    } else if (c == 'f' || c == 'F' || c == 'e' || c == 'E' || c == 'g' || c == 'G') {
+        lr__fmt_float(o, c, flags, width, precision, arg.d);
+    } else if (c == 'p' && arg.p) {
+        arg.u = (uintptr_t)arg.p;
+        lr__fmt_integer(o, 'x', flags | LR__FMT_ALT, width, precision, arg);
+    } else if (c == 's' || c == 'p') {
+        const char* s = c == 'p' ? "(nil)" : arg.p ? (const char*)arg.p : "(null)";
+        if (c == 'p' || precision < 0) {
+            n = strlen(s);
+        } else {
+            for (n = 0; n < (size_t)precision && s[n]; n++) {
+                ;
+            }
+        }
+        after = lr__fmt_pad(o, flags & ~LR__FMT_ZERO, width, "", 0, 0, n);
+        lr__out_chars(o, s, n);
+        lr__out_fill(o, ' ', after);
+    } else if (c == 'c') {
+        after = lr__fmt_pad(o, flags & ~LR__FMT_ZERO, width, "", 0, 0, 1);
+        lr__out_char(o, (char)arg.i);
+        lr__out_fill(o, ' ', after);
+    } else if (c == '%') {
+        lr__out_char(o, '%');
+    } else if (c) {
+        /* Unsupported (including %n): echoed rather than guessed at */
+        lr__out_char(o, '%');
+        lr__out_char(o, c);
+    }
+}
+
+/* vsnprintf subset: %d %i %u %x %X %o %c %s %p %f %F %e %E %g %G %%, with
+ * flags, width, precision ('*' for either) and length modifiers. Writes at
+ * most cap bytes including the terminator; returns the full length. */
+static inline int lr_vsnprintf(char* buf, size_t cap, const char* fmt, va_list ap) {
+    lr__out o = { buf, cap, 0 };
+    lr__fmtspec spec;
+    va_list args;
+    int width, precision;
+    
+    va_copy(args, ap);
+    for (;;) {
+        const char* end = lr__fmt_scan(fmt);
+        lr__out_chars(&o, fmt, (size_t)(end - fmt));
+        if (!*end) {
+            break;
+        }
+        fmt = lr__fmt_parse(end + 1, &spec);
+        width = spec.width == LR__FMT_STAR ? va_arg(args, int) : spec.width;
+        precision = spec.precision == LR__FMT_STAR ? va_arg(args, int) : spec.precision;
+        lr__fmt_emit(&o, &spec, width, precision, lr__fmt_fetch(&spec, &args));
+    }
+    va_end(args);
+    return lr__out_finish(&o);
+}
+
+static inline int lr_snprintf(char* buf, size_t cap, const char* fmt, ...) {
+    va_list ap;
+    int n;
+    
+    va_start(ap, fmt);
+    n = lr_vsnprintf(buf, cap, fmt, ap);
+    va_end(ap);
+    return n;
+}
+
+/* CRC-32 */
+
+/* Slicing-by-8 tables, reflected: entry 256 * k + b is the CRC of byte b
+ * followed by k zero bytes */
+static inline const uint32_t* lr__crc32c_table(void) {
+    static const uint32_t table[2048] = {
+        0x00000000U, 0xf26b8303U, 0xe13b70f7U, 0x1350f3f4U, 0xc79a971fU, 0x35f1141cU,
+        0x26a1e7e8U, 0xd4ca64ebU, 0x8ad958cfU, 0x78b2dbccU, 0x6be22838U, 0x9989ab3bU,
+        0x4d43cfd0U, 0xbf284cd3U, 0xac78bf27U, 0x5e133c24U, 0x105ec76fU, 0xe235446cU,
+        0xf165b798U, 0x030e349bU, 0xd7c45070U, 0x25afd373U, 0x36ff2087U, 0xc494a384U,
+        0x9a879fa0U, 0x68ec1ca3U, 0x7bbcef57U, 0x89d76c54U, 0x5d1d08bfU, 0xaf768bbcU,
+        0xbc267848U, 0x4e4dfb4bU, 0x20bd8edeU, 0xd2d60dddU, 0xc186fe29U, 0x33ed7d2aU,
+        0xe72719c1U, 0x154c9ac2U, 0x061c6936U, 0xf477ea35U, 0xaa64d611U, 0x580f5512U,
+        0x4b5fa6e6U, 0xb93425e5U, 0x6dfe410eU, 0x9f95c20dU, 0x8cc531f9U, 0x7eaeb2faU,
+        0x30e349b1U, 0xc288cab2U, 0xd1d83946U, 0x23b3ba45U, 0xf779deaeU, 0x05125dadU,
+        0x1642ae59U, 0xe4292d5aU, 0xba3a117eU, 0x4851927dU, 0x5b016189U, 0xa96ae28aU,
+        0x7da08661U, 0x8fcb0562U, 0x9c9bf696U, 0x6ef07595U, 0x417b1dbcU, 0xb3109ebfU,
+        0xa0406d4bU, 0x522bee48U, 0x86e18aa3U, 0x748a09a0U, 0x67dafa54U, 0x95b17957U,
+        0xcba24573U, 0x39c9c670U, 0x2a993584U, 0xd8f2b687U, 0x0c38d26cU, 0xfe53516fU,
+        0xed03a29bU, 0x1f682198U, 0x5125dad3U, 0xa34e59d0U, 0xb01eaa24U, 0x42752927U,
+        0x96bf4dccU, 0x64d4cecfU, 0x77843d3bU, 0x85efbe38U, 0xdbfc821cU, 0x2997011fU,
+        0x3ac7f2ebU, 0xc8ac71e8U, 0x1c661503U, 0xee0d9600U, 0xfd5d65f4U, 0x0f36e6f7U,
+        0x61c69362U, 0x93ad1061U, 0x80fde395U, 0x72966096U, 0xa65c047dU, 0x5437877eU,
+        0x4767748aU, 0xb50cf789U, 0xeb1fcbadU, 0x197448aeU, 0x0a24bb5aU, 0xf84f3859U,
+        0x2c855cb2U, 0xdeeedfb1U, 0xcdbe2c45U, 0x3fd5af46U, 0x7198540dU, 0x83f3d70eU,
+        0x90a324faU, 0x62c8a7f9U, 0xb602c312U, 0x44694011U, 0x5739b3e5U, 0xa55230e6U,
+        0xfb410cc2U, 0x092a8fc1U, 0x1a7a7c35U, 0xe811ff36U, 0x3cdb9bddU, 0xceb018deU,
+        0xdde0eb2aU, 0x2f8b6829U, 0x82f63b78U, 0x709db87bU, 0x63cd4b8fU, 0x91a6c88cU,
+        0x456cac67U, 0xb7072f64U, 0xa457dc90U, 0x563c5f93U, 0x082f63b7U, 0xfa44e0b4U,
+        0xe9141340U, 0x1b7f9043U, 0xcfb5f4a8U, 0x3dde77abU, 0x2e8e845fU, 0xdce5075cU,
+        0x92a8fc17U, 0x60c37f14U, 0x73938ce0U, 0x81f80fe3U, 0x55326b08U, 0xa759e80bU,
+        0xb4091bffU, 0x466298fcU, 0x1871a4d8U, 0xea1a27dbU, 0xf94ad42fU, 0x0b21572cU,
+        0xdfeb33c7U, 0x2d80b0c4U, 0x3ed04330U, 0xccbbc033U, 0xa24bb5a6U, 0x502036a5U,
+        0x4370c551U, 0xb11b4652U, 0x65d122b9U, 0x97baa1baU, 0x84ea524eU, 0x7681d14dU,
+        0x2892ed69U, 0xdaf96e6aU, 0xc9a99d9eU, 0x3bc21e9dU, 0xef087a76U, 0x1d63f975U,
+        0x0e330a81U, 0xfc588982U, 0xb21572c9U, 0x407ef1caU, 0x532e023eU, 0xa145813dU,
+        0x758fe5d6U, 0x87e466d5U, 0x94b49521U, 0x66df1622U, 0x38cc2a06U, 0xcaa7a905U,
+        0xd9f75af1U, 0x2b9cd9f2U, 0xff56bd19U, 0x0d3d3e1aU, 0x1e6dcdeeU, 0xec064eedU,
+        0xc38d26c4U, 0x31e6a5c7U, 0x22b65633U, 0xd0ddd530U, 0x0417b1dbU, 0xf67c32d8U,
+        0xe52cc12cU, 0x1747422fU, 0x49547e0bU, 0xbb3ffd08U, 0xa86f0efcU, 0x5a048dffU,
+        0x8ecee914U, 0x7ca56a17U, 0x6ff599e3U, 0x9d9e1ae0U, 0xd3d3e1abU, 0x21b862a8U,
+        0x32e8915cU, 0xc083125fU, 0x144976b4U, 0xe622f5b7U, 0xf5720643U, 0x07198540U,
+        0x590ab964U, 0xab613a67U, 0xb831c993U, 0x4a5a4a90U, 0x9e902e7bU, 0x6cfbad78U,
+        0x7fab5e8cU, 0x8dc0dd8fU, 0xe330a81aU, 0x115b2b19U, 0x020bd8edU, 0xf0605beeU,
+        0x24aa3f05U, 0xd6c1bc06U, 0xc5914ff2U, 0x37faccf1U, 0x69e9f0d5U, 0x9b8273d6U,
+        0x88d28022U, 0x7ab90321U, 0xae7367caU, 0x5c18e4c9U, 0x4f48173dU, 0xbd23943eU,
+        0xf36e6f75U, 0x0105ec76U, 0x12551f82U, 0xe03e9c81U, 0x34f4f86aU, 0xc69f7b69U,
+        0xd5cf889dU, 0x27a40b9eU, 0x79b737baU, 0x8bdcb4b9U, 0x988c474dU, 0x6ae7c44eU,
+        0xbe2da0a5U, 0x4c4623a6U, 0x5f16d052U, 0xad7d5351U, 0x00000000U, 0x13a29877U,
+        0x274530eeU, 0x34e7a899U, 0x4e8a61dcU, 0x5d28f9abU, 0x69cf5132U, 0x7a6dc945U,
+        0x9d14c3b8U, 0x8eb65bcfU, 0xba51f356U, 0xa9f36b21U, 0xd39ea264U, 0xc03c3a13U,
+        0xf4db928aU, 0xe7790afdU, 0x3fc5f181U, 0x2c6769f6U, 0x1880c16fU, 0x0b225918U,
+        0x714f905dU, 0x62ed082aU, 0x560aa0b3U, 0x45a838c4U, 0xa2d13239U, 0xb173aa4eU,
+        0x859402d7U, 0x96369aa0U, 0xec5b53e5U, 0xfff9cb92U, 0xcb1e630bU, 0xd8bcfb7cU,
+        0x7f8be302U, 0x6c297b75U, 0x58ced3ecU, 0x4b6c4b9bU, 0x310182deU, 0x22a31aa9U,
+        0x1644b230U, 0x05e62a47U, 0xe29f20baU, 0xf13db8cdU, 0xc5da1054U, 0xd6788823U,
+        0xac154166U, 0xbfb7d911U, 0x8b507188U, 0x98f2e9ffU, 0x404e1283U, 0x53ec8af4U,
+        0x670b226dU, 0x74a9ba1aU, 0x0ec4735fU, 0x1d66eb28U, 0x298143b1U, 0x3a23dbc6U,
+        0xdd5ad13bU, 0xcef8494cU, 0xfa1fe1d5U, 0xe9bd79a2U, 0x93d0b0e7U, 0x80722890U,
+        0xb4958009U, 0xa737187eU, 0xff17c604U, 0xecb55e73U, 0xd852f6eaU, 0xcbf06e9dU,
+        0xb19da7d8U, 0xa23f3fafU, 0x96d89736U, 0x857a0f41U, 0x620305bcU, 0x71a19dcbU,
+        0x45463552U, 0x56e4ad25U, 0x2c896460U, 0x3f2bfc17U, 0x0bcc548eU, 0x186eccf9U,
+        0xc0d23785U, 0xd370aff2U, 0xe797076bU, 0xf4359f1cU, 0x8e585659U, 0x9dface2eU,
+        0xa91d66b7U, 0xbabffec0U, 0x5dc6f43dU, 0x4e646c4aU, 0x7a83c4d3U, 0x69215ca4U,
+        0x134c95e1U, 0x00ee0d96U, 0x3409a50fU, 0x27ab3d78U, 0x809c2506U, 0x933ebd71U,
+        0xa7d915e8U, 0xb47b8d9fU, 0xce1644daU, 0xddb4dcadU, 0xe9537434U, 0xfaf1ec43U,
+        0x1d88e6beU, 0x0e2a7ec9U, 0x3acdd650U, 0x296f4e27U, 0x53028762U, 0x40a01f15U,
+        0x7447b78cU, 0x67e52ffbU, 0xbf59d487U, 0xacfb4cf0U, 0x981ce469U, 0x8bbe7c1eU,
+        0xf1d3b55bU, 0xe2712d2cU, 0xd69685b5U, 0xc5341dc2U, 0x224d173fU, 0x31ef8f48U,
+        0x050827d1U, 0x16aabfa6U, 0x6cc776e3U, 0x7f65ee94U, 0x4b82460dU, 0x5820de7aU,
+        0xfbc3faf9U, 0xe861628eU, 0xdc86ca17U, 0xcf245260U, 0xb5499b25U, 0xa6eb0352U,
+        0x920cabcbU, 0x81ae33bcU, 0x66d73941U, 0x7575a136U, 0x419209afU, 0x523091d8U,
+        0x285d589dU, 0x3bffc0eaU, 0x0f186873U, 0x1cbaf004U, 0xc4060b78U, 0xd7a4930fU,
+        0xe3433b96U, 0xf0e1a3e1U, 0x8a8c6aa4U, 0x992ef2d3U, 0xadc95a4aU, 0xbe6bc23dU,
+        0x5912c8c0U, 0x4ab050b7U, 0x7e57f82eU, 0x6df56059U, 0x1798a91cU, 0x043a316bU,
+        0x30dd99f2U, 0x237f0185U, 0x844819fbU, 0x97ea818cU, 0xa30d2915U, 0xb0afb162U,
+        0xcac27827U, 0xd960e050U, 0xed8748c9U, 0xfe25d0beU, 0x195cda43U, 0x0afe4234U,
+        0x3e19eaadU, 0x2dbb72daU, 0x57d6bb9fU, 0x447423e8U, 0x70938b71U, 0x63311306U,
+        0xbb8de87aU, 0xa82f700dU, 0x9cc8d894U, 0x8f6a40e3U, 0xf50789a6U, 0xe6a511d1U,
+        0xd242b948U, 0xc1e0213fU, 0x26992bc2U, 0x353bb3b5U, 0x01dc1b2cU, 0x127e835bU,
+        0x68134a1eU, 0x7bb1d269U, 0x4f567af0U, 0x5cf4e287U, 0x04d43cfdU, 0x1776a48aU,
+        0x23910c13U, 0x30339464U, 0x4a5e5d21U, 0x59fcc556U, 0x6d1b6dcfU, 0x7eb9f5b8U,
+        0x99c0ff45U, 0x8a626732U, 0xbe85cfabU, 0xad2757dcU, 0xd74a9e99U, 0xc4e806eeU,
+        0xf00fae77U, 0xe3ad3600U, 0x3b11cd7cU, 0x28b3550bU, 0x1c54fd92U, 0x0ff665e5U,
+        0x759baca0U, 0x663934d7U, 0x52de9c4eU, 0x417c0439U, 0xa6050ec4U, 0xb5a796b3U,
+        0x81403e2aU, 0x92e2a65dU, 0xe88f6f18U, 0xfb2df76fU, 0xcfca5ff6U, 0xdc68c781U,
+        0x7b5fdfffU, 0x68fd4788U, 0x5c1aef11U, 0x4fb87766U, 0x35d5be23U, 0x26772654U,
+        0x12908ecdU, 0x013216baU, 0xe64b1c47U, 0xf5e98430U, 0xc10e2ca9U, 0xd2acb4deU,
+        0xa8c17d9bU, 0xbb63e5ecU, 0x8f844d75U, 0x9c26d502U, 0x449a2e7eU, 0x5738b609U,
+        0x63df1e90U, 0x707d86e7U, 0x0a104fa2U, 0x19b2d7d5U, 0x2d557f4cU, 0x3ef7e73bU,
+        0xd98eedc6U, 0xca2c75b1U, 0xfecbdd28U, 0xed69455fU, 0x97048c1aU, 0x84a6146dU,
+        0xb041bcf4U, 0xa3e32483U, 0x00000000U, 0xa541927eU, 0x4f6f520dU, 0xea2ec073U,
+        0x9edea41aU, 0x3b9f3664U, 0xd1b1f617U, 0x74f06469U, 0x38513ec5U, 0x9d10acbbU,
+        0x773e6cc8U, 0xd27ffeb6U, 0xa68f9adfU, 0x03ce08a1U, 0xe9e0c8d2U, 0x4ca15aacU,
+        0x70a27d8aU, 0xd5e3eff4U, 0x3fcd2f87U, 0x9a8cbdf9U, 0xee7cd990U, 0x4b3d4beeU,
+        0xa1138b9dU, 0x045219e3U, 0x48f3434fU, 0xedb2d131U, 0x079c1142U, 0xa2dd833cU,
+        0xd62de755U, 0x736c752bU, 0x9942b558U, 0x3c032726U, 0xe144fb14U, 0x4405696aU,
+        0xae2ba919U, 0x0b6a3b67U, 0x7f9a5f0eU, 0xdadbcd70U, 0x30f50d03U, 0x95b49f7dU,
+        0xd915c5d1U, 0x7c5457afU, 0x967a97dcU, 0x333b05a2U, 0x47cb61cbU, 0xe28af3b5U,
+        0x08a433c6U, 0xade5a1b8U, 0x91e6869eU, 0x34a714e0U, 0xde89d493U, 0x7bc846edU,
+        0x0f382284U, 0xaa79b0faU, 0x40577089U, 0xe516e2f7U, 0xa9b7b85bU, 0x0cf62a25U,
+        0xe6d8ea56U, 0x43997828U, 0x37691c41U, 0x92288e3fU, 0x78064e4cU, 0xdd47dc32U,
+        0xc76580d9U, 0x622412a7U, 0x880ad2d4U, 0x2d4b40aaU, 0x59bb24c3U, 0xfcfab6bdU,
+        0x16d476ceU, 0xb395e4b0U, 0xff34be1cU, 0x5a752c62U, 0xb05bec11U, 0x151a7e6fU,
+        0x61ea1a06U, 0xc4ab8878U, 0x2e85480bU, 0x8bc4da75U, 0xb7c7fd53U, 0x12866f2dU,
+        0xf8a8af5eU, 0x5de93d20U, 0x29195949U, 0x8c58cb37U, 0x66760b44U, 0xc337993aU,
+        0x8f96c396U, 0x2ad751e8U, 0xc0f9919bU, 0x65b803e5U, 0x1148678cU, 0xb409f5f2U,
+        0x5e273581U, 0xfb66a7ffU, 0x26217bcdU, 0x8360e9b3U, 0x694e29c0U, 0xcc0fbbbeU,
+        0xb8ffdfd7U, 0x1dbe4da9U, 0xf7908ddaU, 0x52d11fa4U, 0x1e704508U, 0xbb31d776U,
+        0x511f1705U, 0xf45e857bU, 0x80aee112U, 0x25ef736cU, 0xcfc1b31fU, 0x6a802161U,
+        0x56830647U, 0xf3c29439U, 0x19ec544aU, 0xbcadc634U, 0xc85da25dU, 0x6d1c3023U,
+        0x8732f050U, 0x2273622eU, 0x6ed23882U, 0xcb93aafcU, 0x21bd6a8fU, 0x84fcf8f1U,
+        0xf00c9c98U, 0x554d0ee6U, 0xbf63ce95U, 0x1a225cebU, 0x8b277743U, 0x2e66e53dU,
+        0xc448254eU, 0x6109b730U, 0x15f9d359U, 0xb0b84127U, 0x5a968154U, 0xffd7132aU,
+        0xb3764986U, 0x1637dbf8U, 0xfc191b8bU, 0x595889f5U, 0x2da8ed9cU, 0x88e97fe2U,
+        0x62c7bf91U, 0xc7862defU, 0xfb850ac9U, 0x5ec498b7U, 0xb4ea58c4U, 0x11abcabaU,
+        0x655baed3U, 0xc01a3cadU, 0x2a34fcdeU, 0x8f756ea0U, 0xc3d4340cU, 0x6695a672U,
+        0x8cbb6601U, 0x29faf47fU, 0x5d0a9016U, 0xf84b0268U, 0x1265c21bU, 0xb7245065U,
+        0x6a638c57U, 0xcf221e29U, 0x250cde5aU, 0x804d4c24U, 0xf4bd284dU, 0x51fcba33U,
+        0xbbd27a40U, 0x1e93e83eU, 0x5232b292U, 0xf77320ecU, 0x1d5de09fU, 0xb81c72e1U,
+        0xccec1688U, 0x69ad84f6U, 0x83834485U, 0x26c2d6fbU, 0x1ac1f1ddU, 0xbf8063a3U,
+        0x55aea3d0U, 0xf0ef31aeU, 0x841f55c7U, 0x215ec7b9U, 0xcb7007caU, 0x6e3195b4U,
+        0x2290cf18U, 0x87d15d66U, 0x6dff9d15U, 0xc8be0f6bU, 0xbc4e6b02U, 0x190ff97cU,
+        0xf321390fU, 0x5660ab71U, 0x4c42f79aU, 0xe90365e4U, 0x032da597U, 0xa66c37e9U,
+        0xd29c5380U, 0x77ddc1feU, 0x9df3018dU, 0x38b293f3U, 0x7413c95fU, 0xd1525b21U,
+        0x3b7c9b52U, 0x9e3d092cU, 0xeacd6d45U, 0x4f8cff3bU, 0xa5a23f48U, 0x00e3ad36U,
+        0x3ce08a10U, 0x99a1186eU, 0x738fd81dU, 0xd6ce4a63U, 0xa23e2e0aU, 0x077fbc74U,
+        0xed517c07U, 0x4810ee79U, 0x04b1b4d5U, 0xa1f026abU, 0x4bdee6d8U, 0xee9f74a6U,
+        0x9a6f10cfU, 0x3f2e82b1U, 0xd50042c2U, 0x7041d0bcU, 0xad060c8eU, 0x08479ef0U,
+        0xe2695e83U, 0x4728ccfdU, 0x33d8a894U, 0x96993aeaU, 0x7cb7fa99U, 0xd9f668e7U,
+        0x9557324bU, 0x3016a035U, 0xda386046U, 0x7f79f238U, 0x0b899651U, 0xaec8042fU,
+        0x44e6c45cU, 0xe1a75622U, 0xdda47104U, 0x78e5e37aU, 0x92cb2309U, 0x378ab177U,
+        0x437ad51eU, 0xe63b4760U, 0x0c158713U, 0xa954156dU, 0xe5f54fc1U, 0x40b4ddbfU,
+        0xaa9a1dccU, 0x0fdb8fb2U, 0x7b2bebdbU, 0xde6a79a5U, 0x3444b9d6U, 0x91052ba8U,
+        0x00000000U, 0xdd45aab8U, 0xbf672381U, 0x62228939U, 0x7b2231f3U, 0xa6679b4bU,
+        0xc4451272U, 0x1900b8caU, 0xf64463e6U, 0x2b01c95eU, 0x49234067U, 0x9466eadfU,
+        0x8d665215U, 0x5023f8adU, 0x32017194U, 0xef44db2cU, 0xe964b13dU, 0x34211b85U,
+        0x560392bcU, 0x8b463804U, 0x924680ceU, 0x4f032a76U, 0x2d21a34fU, 0xf06409f7U,
+        0x1f20d2dbU, 0xc2657863U, 0xa047f15aU, 0x7d025be2U, 0x6402e328U, 0xb9474990U,
+        0xdb65c0a9U, 0x06206a11U, 0xd725148bU, 0x0a60be33U, 0x6842370aU, 0xb5079db2U,
+        0xac072578U, 0x71428fc0U, 0x136006f9U, 0xce25ac41U, 0x2161776dU, 0xfc24ddd5U,
+        0x9e0654ecU, 0x4343fe54U, 0x5a43469eU, 0x8706ec26U, 0xe524651fU, 0x3861cfa7U,
+        0x3e41a5b6U, 0xe3040f0eU, 0x81268637U, 0x5c632c8fU, 0x45639445U, 0x98263efdU,
+        0xfa04b7c4U, 0x27411d7cU, 0xc805c650U, 0x15406ce8U, 0x7762e5d1U, 0xaa274f69U,
+        0xb327f7a3U, 0x6e625d1bU, 0x0c40d422U, 0xd1057e9aU, 0xaba65fe7U, 0x76e3f55fU,
+        0x14c17c66U, 0xc984d6deU, 0xd0846e14U, 0x0dc1c4acU, 0x6fe34d95U, 0xb2a6e72dU,
+        0x5de23c01U, 0x80a796b9U, 0xe2851f80U, 0x3fc0b538U, 0x26c00df2U, 0xfb85a74aU,
+        0x99a72e73U, 0x44e284cbU, 0x42c2eedaU, 0x9f874462U, 0xfda5cd5bU, 0x20e067e3U,
+        0x39e0df29U, 0xe4a57591U, 0x8687fca8U, 0x5bc25610U, 0xb4868d3cU, 0x69c32784U,
+        0x0be1aebdU, 0xd6a40405U, 0xcfa4bccfU, 0x12e11677U, 0x70c39f4eU, 0xad8635f6U,
+        0x7c834b6cU, 0xa1c6e1d4U, 0xc3e468edU, 0x1ea1c255U, 0x07a17a9fU, 0xdae4d027U,
+        0xb8c6591eU, 0x6583f3a6U, 0x8ac7288aU, 0x57828232U, 0x35a00b0bU, 0xe8e5a1b3U,
+        0xf1e51979U, 0x2ca0b3c1U, 0x4e823af8U, 0x93c79040U, 0x95e7fa51U, 0x48a250e9U,
+        0x2a80d9d0U, 0xf7c57368U, 0xeec5cba2U, 0x3380611aU, 0x51a2e823U, 0x8ce7429bU,
+        0x63a399b7U, 0xbee6330fU, 0xdcc4ba36U, 0x0181108eU, 0x1881a844U, 0xc5c402fcU,
+        0xa7e68bc5U, 0x7aa3217dU, 0x52a0c93fU, 0x8fe56387U, 0xedc7eabeU, 0x30824006U,
+        0x2982f8ccU, 0xf4c75274U, 0x96e5db4dU, 0x4ba071f5U, 0xa4e4aad9U, 0x79a10061U,
+        0x1b838958U, 0xc6c623e0U, 0xdfc69b2aU, 0x02833192U, 0x60a1b8abU, 0xbde41213U,
+        0xbbc47802U, 0x6681d2baU, 0x04a35b83U, 0xd9e6f13bU, 0xc0e649f1U, 0x1da3e349U,
+        0x7f816a70U, 0xa2c4c0c8U, 0x4d801be4U, 0x90c5b15cU, 0xf2e73865U, 0x2fa292ddU,
+        0x36a22a17U, 0xebe780afU, 0x89c50996U, 0x5480a32eU, 0x8585ddb4U, 0x58c0770cU,
+        0x3ae2fe35U, 0xe7a7548dU, 0xfea7ec47U, 0x23e246ffU, 0x41c0cfc6U, 0x9c85657eU,
+        0x73c1be52U, 0xae8414eaU, 0xcca69dd3U, 0x11e3376bU, 0x08e38fa1U, 0xd5a62519U,
+        0xb784ac20U, 0x6ac10698U, 0x6ce16c89U, 0xb1a4c631U, 0xd3864f08U, 0x0ec3e5b0U,
+        0x17c35d7aU, 0xca86f7c2U, 0xa8a47efbU, 0x75e1d443U, 0x9aa50f6fU, 0x47e0a5d7U,
+        0x25c22ceeU, 0xf8878656U, 0xe1873e9cU, 0x3cc29424U, 0x5ee01d1dU, 0x83a5b7a5U,
+        0xf90696d8U, 0x24433c60U, 0x4661b559U, 0x9b241fe1U, 0x8224a72bU, 0x5f610d93U,
+        0x3d4384aaU, 0xe0062e12U, 0x0f42f53eU, 0xd2075f86U, 0xb025d6bfU, 0x6d607c07U,
+        0x7460c4cdU, 0xa9256e75U, 0xcb07e74cU, 0x16424df4U, 0x106227e5U, 0xcd278d5dU,
+        0xaf050464U, 0x7240aedcU, 0x6b401616U, 0xb605bcaeU, 0xd4273597U, 0x09629f2fU,
+        0xe6264403U, 0x3b63eebbU, 0x59416782U, 0x8404cd3aU, 0x9d0475f0U, 0x4041df48U,
+        0x22635671U, 0xff26fcc9U, 0x2e238253U, 0xf36628ebU, 0x9144a1d2U, 0x4c010b6aU,
+        0x5501b3a0U, 0x88441918U, 0xea669021U, 0x37233a99U, 0xd867e1b5U, 0x05224b0dU,
+        0x6700c234U, 0xba45688cU, 0xa345d046U, 0x7e007afeU, 0x1c22f3c7U, 0xc167597fU,
+        0xc747336eU, 0x1a0299d6U, 0x782010efU, 0xa565ba57U, 0xbc65029dU, 0x6120a825U,
+        0x0302211cU, 0xde478ba4U, 0x31035088U, 0xec46fa30U, 0x8e647309U, 0x5321d9b1U,
+        0x4a21617bU, 0x9764cbc3U, 0xf54642faU, 0x2803e842U, 0x00000000U, 0x38116facU,
+        0x7022df58U, 0x4833b0f4U, 0xe045beb0U, 0xd854d11cU, 0x906761e8U, 0xa8760e44U,
+        0xc5670b91U, 0xfd76643dU, 0xb545d4c9U, 0x8d54bb65U, 0x2522b521U, 0x1d33da8dU,
+        0x55006a79U, 0x6d1105d5U, 0x8f2261d3U, 0xb7330e7fU, 0xff00be8bU, 0xc711d127U,
+        0x6f67df63U, 0x5776b0cfU, 0x1f45003bU, 0x27546f97U, 0x4a456a42U, 0x725405eeU,
+        0x3a67b51aU, 0x0276dab6U, 0xaa00d4f2U, 0x9211bb5eU, 0xda220baaU, 0xe2336406U,
+        0x1ba8b557U, 0x23b9dafbU, 0x6b8a6a0fU, 0x539b05a3U, 0xfbed0be7U, 0xc3fc644bU,
+        0x8bcfd4bfU, 0xb3debb13U, 0xdecfbec6U, 0xe6ded16aU, 0xaeed619eU, 0x96fc0e32U,
+        0x3e8a0076U, 0x069b6fdaU, 0x4ea8df2eU, 0x76b9b082U, 0x948ad484U, 0xac9bbb28U,
+        0xe4a80bdcU, 0xdcb96470U, 0x74cf6a34U, 0x4cde0598U, 0x04edb56cU, 0x3cfcdac0U,
+        0x51eddf15U, 0x69fcb0b9U, 0x21cf004dU, 0x19de6fe1U, 0xb1a861a5U, 0x89b90e09U,
+        0xc18abefdU, 0xf99bd151U, 0x37516aaeU, 0x0f400502U, 0x4773b5f6U, 0x7f62da5aU,
+        0xd714d41eU, 0xef05bbb2U, 0xa7360b46U, 0x9f2764eaU, 0xf236613fU, 0xca270e93U,
+        0x8214be67U, 0xba05d1cbU, 0x1273df8fU, 0x2a62b023U, 0x625100d7U, 0x5a406f7bU,
+        0xb8730b7dU, 0x806264d1U, 0xc851d425U, 0xf040bb89U, 0x5836b5cdU, 0x6027da61U,
+        0x28146a95U, 0x10050539U, 0x7d1400ecU, 0x45056f40U, 0x0d36dfb4U, 0x3527b018U,
+        0x9d51be5cU, 0xa540d1f0U, 0xed736104U, 0xd5620ea8U, 0x2cf9dff9U, 0x14e8b055U,
+        0x5cdb00a1U, 0x64ca6f0dU, 0xccbc6149U, 0xf4ad0ee5U, 0xbc9ebe11U, 0x848fd1bdU,
+        0xe99ed468U, 0xd18fbbc4U, 0x99bc0b30U, 0xa1ad649cU, 0x09db6ad8U, 0x31ca0574U,
+        0x79f9b580U, 0x41e8da2cU, 0xa3dbbe2aU, 0x9bcad186U, 0xd3f96172U, 0xebe80edeU,
+        0x439e009aU, 0x7b8f6f36U, 0x33bcdfc2U, 0x0badb06eU, 0x66bcb5bbU, 0x5eadda17U,
+        0x169e6ae3U, 0x2e8f054fU, 0x86f90b0bU, 0xbee864a7U, 0xf6dbd453U, 0xcecabbffU,
+        0x6ea2d55cU, 0x56b3baf0U, 0x1e800a04U, 0x269165a8U, 0x8ee76becU, 0xb6f60440U,
+        0xfec5b4b4U, 0xc6d4db18U, 0xabc5decdU, 0x93d4b161U, 0xdbe70195U, 0xe3f66e39U,
+        0x4b80607dU, 0x73910fd1U, 0x3ba2bf25U, 0x03b3d089U, 0xe180b48fU, 0xd991db23U,
+        0x91a26bd7U, 0xa9b3047bU, 0x01c50a3fU, 0x39d46593U, 0x71e7d567U, 0x49f6bacbU,
+        0x24e7bf1eU, 0x1cf6d0b2U, 0x54c56046U, 0x6cd40feaU, 0xc4a201aeU, 0xfcb36e02U,
+        0xb480def6U, 0x8c91b15aU, 0x750a600bU, 0x4d1b0fa7U, 0x0528bf53U, 0x3d39d0ffU,
+        0x954fdebbU, 0xad5eb117U, 0xe56d01e3U, 0xdd7c6e4fU, 0xb06d6b9aU, 0x887c0436U,
+        0xc04fb4c2U, 0xf85edb6eU, 0x5028d52aU, 0x6839ba86U, 0x200a0a72U, 0x181b65deU,
+        0xfa2801d8U, 0xc2396e74U, 0x8a0ade80U, 0xb21bb12cU, 0x1a6dbf68U, 0x227cd0c4U,
+        0x6a4f6030U, 0x525e0f9cU, 0x3f4f0a49U, 0x075e65e5U, 0x4f6dd511U, 0x777cbabdU,
+        0xdf0ab4f9U, 0xe71bdb55U, 0xaf286ba1U, 0x9739040dU, 0x59f3bff2U, 0x61e2d05eU,
+        0x29d160aaU, 0x11c00f06U, 0xb9b60142U, 0x81a76eeeU, 0xc994de1aU, 0xf185b1b6U,
+        0x9c94b463U, 0xa485dbcfU, 0xecb66b3bU, 0xd4a70497U, 0x7cd10ad3U, 0x44c0657fU,
+        0x0cf3d58bU, 0x34e2ba27U, 0xd6d1de21U, 0xeec0b18dU, 0xa6f30179U, 0x9ee26ed5U,
+        0x36946091U, 0x0e850f3dU, 0x46b6bfc9U, 0x7ea7d065U, 0x13b6d5b0U, 0x2ba7ba1cU,
+        0x63940ae8U, 0x5b856544U, 0xf3f36b00U, 0xcbe204acU, 0x83d1b458U, 0xbbc0dbf4U,
+        0x425b0aa5U, 0x7a4a6509U, 0x3279d5fdU, 0x0a68ba51U, 0xa21eb415U, 0x9a0fdbb9U,
+        0xd23c6b4dU, 0xea2d04e1U, 0x873c0134U, 0xbf2d6e98U, 0xf71ede6cU, 0xcf0fb1c0U,
+        0x6779bf84U, 0x5f68d028U, 0x175b60dcU, 0x2f4a0f70U, 0xcd796b76U, 0xf56804daU,
+        0xbd5bb42eU, 0x854adb82U, 0x2d3cd5c6U, 0x152dba6aU, 0x5d1e0a9eU, 0x650f6532U,
+        0x081e60e7U, 0x300f0f4bU, 0x783cbfbfU, 0x402dd013U, 0xe85bde57U, 0xd04ab1fbU,
+        0x9879010fU, 0xa0686ea3U, 0x00000000U, 0xef306b19U, 0xdb8ca0c3U, 0x34bccbdaU,
+        0xb2f53777U, 0x5dc55c6eU, 0x697997b4U, 0x8649fcadU, 0x6006181fU, 0x8f367306U,
+        0xbb8ab8dcU, 0x54bad3c5U, 0xd2f32f68U, 0x3dc34471U, 0x097f8fabU, 0xe64fe4b2U,
+        0xc00c303eU, 0x2f3c5b27U, 0x1b8090fdU, 0xf4b0fbe4U, 0x72f90749U, 0x9dc96c50U,
+        0xa975a78aU, 0x4645cc93U, 0xa00a2821U, 0x4f3a4338U, 0x7b8688e2U, 0x94b6e3fbU,
+        0x12ff1f56U, 0xfdcf744fU, 0xc973bf95U, 0x2643d48cU, 0x85f4168dU, 0x6ac47d94U,
+        0x5e78b64eU, 0xb148dd57U, 0x370121faU, 0xd8314ae3U, 0xec8d8139U, 0x03bdea20U,
+        0xe5f20e92U, 0x0ac2658bU, 0x3e7eae51U, 0xd14ec548U, 0x570739e5U, 0xb83752fcU,
+        0x8c8b9926U, 0x63bbf23fU, 0x45f826b3U, 0xaac84daaU, 0x9e748670U, 0x7144ed69U,
+        0xf70d11c4U, 0x183d7addU, 0x2c81b107U, 0xc3b1da1eU, 0x25fe3eacU, 0xcace55b5U,
+        0xfe729e6fU, 0x1142f576U, 0x970b09dbU, 0x783b62c2U, 0x4c87a918U, 0xa3b7c201U,
+        0x0e045bebU, 0xe13430f2U, 0xd588fb28U, 0x3ab89031U, 0xbcf16c9cU, 0x53c10785U,
+        0x677dcc5fU, 0x884da746U, 0x6e0243f4U, 0x813228edU, 0xb58ee337U, 0x5abe882eU,
+        0xdcf77483U, 0x33c71f9aU, 0x077bd440U, 0xe84bbf59U, 0xce086bd5U, 0x213800ccU,
+        0x1584cb16U, 0xfab4a00fU, 0x7cfd5ca2U, 0x93cd37bbU, 0xa771fc61U, 0x48419778U,
+        0xae0e73caU, 0x413e18d3U, 0x7582d309U, 0x9ab2b810U, 0x1cfb44bdU, 0xf3cb2fa4U,
+        0xc777e47eU, 0x28478f67U, 0x8bf04d66U, 0x64c0267fU, 0x507ceda5U, 0xbf4c86bcU,
+        0x39057a11U, 0xd6351108U, 0xe289dad2U, 0x0db9b1cbU, 0xebf65579U, 0x04c63e60U,
+        0x307af5baU, 0xdf4a9ea3U, 0x5903620eU, 0xb6330917U, 0x828fc2cdU, 0x6dbfa9d4U,
+        0x4bfc7d58U, 0xa4cc1641U, 0x9070dd9bU, 0x7f40b682U, 0xf9094a2fU, 0x16392136U,
+        0x2285eaecU, 0xcdb581f5U, 0x2bfa6547U, 0xc4ca0e5eU, 0xf076c584U, 0x1f46ae9dU,
+        0x990f5230U, 0x763f3929U, 0x4283f2f3U, 0xadb399eaU, 0x1c08b7d6U, 0xf338dccfU,
+        0xc7841715U, 0x28b47c0cU, 0xaefd80a1U, 0x41cdebb8U, 0x75712062U, 0x9a414b7bU,
+        0x7c0eafc9U, 0x933ec4d0U, 0xa7820f0aU, 0x48b26413U, 0xcefb98beU, 0x21cbf3a7U,
+        0x1577387dU, 0xfa475364U, 0xdc0487e8U, 0x3334ecf1U, 0x0788272bU, 0xe8b84c32U,
+        0x6ef1b09fU, 0x81c1db86U, 0xb57d105cU, 0x5a4d7b45U, 0xbc029ff7U, 0x5332f4eeU,
+        0x678e3f34U, 0x88be542dU, 0x0ef7a880U, 0xe1c7c399U, 0xd57b0843U, 0x3a4b635aU,
+        0x99fca15bU, 0x76ccca42U, 0x42700198U, 0xad406a81U, 0x2b09962cU, 0xc439fd35U,
+        0xf08536efU, 0x1fb55df6U, 0xf9fab944U, 0x16cad25dU, 0x22761987U, 0xcd46729eU,
+        0x4b0f8e33U, 0xa43fe52aU, 0x90832ef0U, 0x7fb345e9U, 0x59f09165U, 0xb6c0fa7cU,
+        0x827c31a6U, 0x6d4c5abfU, 0xeb05a612U, 0x0435cd0bU, 0x308906d1U, 0xdfb96dc8U,
+        0x39f6897aU, 0xd6c6e263U, 0xe27a29b9U, 0x0d4a42a0U, 0x8b03be0dU, 0x6433d514U,
+        0x508f1eceU, 0xbfbf75d7U, 0x120cec3dU, 0xfd3c8724U, 0xc9804cfeU, 0x26b027e7U,
+        0xa0f9db4aU, 0x4fc9b053U, 0x7b757b89U, 0x94451090U, 0x720af422U, 0x9d3a9f3bU,
+        0xa98654e1U, 0x46b63ff8U, 0xc0ffc355U, 0x2fcfa84cU, 0x1b736396U, 0xf443088fU,
+        0xd200dc03U, 0x3d30b71aU, 0x098c7cc0U, 0xe6bc17d9U, 0x60f5eb74U, 0x8fc5806dU,
+        0xbb794bb7U, 0x544920aeU, 0xb206c41cU, 0x5d36af05U, 0x698a64dfU, 0x86ba0fc6U,
+        0x00f3f36bU, 0xefc39872U, 0xdb7f53a8U, 0x344f38b1U, 0x97f8fab0U, 0x78c891a9U,
+        0x4c745a73U, 0xa344316aU, 0x250dcdc7U, 0xca3da6deU, 0xfe816d04U, 0x11b1061dU,
+        0xf7fee2afU, 0x18ce89b6U, 0x2c72426cU, 0xc3422975U, 0x450bd5d8U, 0xaa3bbec1U,
+        0x9e87751bU, 0x71b71e02U, 0x57f4ca8eU, 0xb8c4a197U, 0x8c786a4dU, 0x63480154U,
+        0xe501fdf9U, 0x0a3196e0U, 0x3e8d5d3aU, 0xd1bd3623U, 0x37f2d291U, 0xd8c2b988U,
+        0xec7e7252U, 0x034e194bU, 0x8507e5e6U, 0x6a378effU, 0x5e8b4525U, 0xb1bb2e3cU,
+        0x00000000U, 0x68032cc8U, 0xd0065990U, 0xb8057558U, 0xa5e0c5d1U, 0xcde3e919U,
+        0x75e69c41U, 0x1de5b089U, 0x4e2dfd53U, 0x262ed19bU, 0x9e2ba4c3U, 0xf628880bU,
+        0xebcd3882U, 0x83ce144aU, 0x3bcb6112U, 0x53c84ddaU, 0x9c5bfaa6U, 0xf458d66eU,
+        0x4c5da336U, 0x245e8ffeU, 0x39bb3f77U, 0x51b813bfU, 0xe9bd66e7U, 0x81be4a2fU,
+        0xd27607f5U, 0xba752b3dU, 0x02705e65U, 0x6a7372adU, 0x7796c224U, 0x1f95eeecU,
+        0xa7909bb4U, 0xcf93b77cU, 0x3d5b83bdU, 0x5558af75U, 0xed5dda2dU, 0x855ef6e5U,
+        0x98bb466cU, 0xf0b86aa4U, 0x48bd1ffcU, 0x20be3334U, 0x73767eeeU, 0x1b755226U,
+        0xa370277eU, 0xcb730bb6U, 0xd696bb3fU, 0xbe9597f7U, 0x0690e2afU, 0x6e93ce67U,
+        0xa100791bU, 0xc90355d3U, 0x7106208bU, 0x19050c43U, 0x04e0bccaU, 0x6ce39002U,
+        0xd4e6e55aU, 0xbce5c992U, 0xef2d8448U, 0x872ea880U, 0x3f2bddd8U, 0x5728f110U,
+        0x4acd4199U, 0x22ce6d51U, 0x9acb1809U, 0xf2c834c1U, 0x7ab7077aU, 0x12b42bb2U,
+        0xaab15eeaU, 0xc2b27222U, 0xdf57c2abU, 0xb754ee63U, 0x0f519b3bU, 0x6752b7f3U,
+        0x349afa29U, 0x5c99d6e1U, 0xe49ca3b9U, 0x8c9f8f71U, 0x917a3ff8U, 0xf9791330U,
+        0x417c6668U, 0x297f4aa0U, 0xe6ecfddcU, 0x8eefd114U, 0x36eaa44cU, 0x5ee98884U,
+        0x430c380dU, 0x2b0f14c5U, 0x930a619dU, 0xfb094d55U, 0xa8c1008fU, 0xc0c22c47U,
+        0x78c7591fU, 0x10c475d7U, 0x0d21c55eU, 0x6522e996U, 0xdd279cceU, 0xb524b006U,
+        0x47ec84c7U, 0x2fefa80fU, 0x97eadd57U, 0xffe9f19fU, 0xe20c4116U, 0x8a0f6ddeU,
+        0x320a1886U, 0x5a09344eU, 0x09c17994U, 0x61c2555cU, 0xd9c72004U, 0xb1c40cccU,
+        0xac21bc45U, 0xc422908dU, 0x7c27e5d5U, 0x1424c91dU, 0xdbb77e61U, 0xb3b452a9U,
+        0x0bb127f1U, 0x63b20b39U, 0x7e57bbb0U, 0x16549778U, 0xae51e220U, 0xc652cee8U,
+        0x959a8332U, 0xfd99affaU, 0x459cdaa2U, 0x2d9ff66aU, 0x307a46e3U, 0x58796a2bU,
+        0xe07c1f73U, 0x887f33bbU, 0xf56e0ef4U, 0x9d6d223cU, 0x25685764U, 0x4d6b7bacU,
+        0x508ecb25U, 0x388de7edU, 0x808892b5U, 0xe88bbe7dU, 0xbb43f3a7U, 0xd340df6fU,
+        0x6b45aa37U, 0x034686ffU, 0x1ea33676U, 0x76a01abeU, 0xcea56fe6U, 0xa6a6432eU,
+        0x6935f452U, 0x0136d89aU, 0xb933adc2U, 0xd130810aU, 0xccd53183U, 0xa4d61d4bU,
+        0x1cd36813U, 0x74d044dbU, 0x27180901U, 0x4f1b25c9U, 0xf71e5091U, 0x9f1d7c59U,
+        0x82f8ccd0U, 0xeafbe018U, 0x52fe9540U, 0x3afdb988U, 0xc8358d49U, 0xa036a181U,
+        0x1833d4d9U, 0x7030f811U, 0x6dd54898U, 0x05d66450U, 0xbdd31108U, 0xd5d03dc0U,
+        0x8618701aU, 0xee1b5cd2U, 0x561e298aU, 0x3e1d0542U, 0x23f8b5cbU, 0x4bfb9903U,
+        0xf3feec5bU, 0x9bfdc093U, 0x546e77efU, 0x3c6d5b27U, 0x84682e7fU, 0xec6b02b7U,
+        0xf18eb23eU, 0x998d9ef6U, 0x2188ebaeU, 0x498bc766U, 0x1a438abcU, 0x7240a674U,
+        0xca45d32cU, 0xa246ffe4U, 0xbfa34f6dU, 0xd7a063a5U, 0x6fa516fdU, 0x07a63a35U,
+        0x8fd9098eU, 0xe7da2546U, 0x5fdf501eU, 0x37dc7cd6U, 0x2a39cc5fU, 0x423ae097U,
+        0xfa3f95cfU, 0x923cb907U, 0xc1f4f4ddU, 0xa9f7d815U, 0x11f2ad4dU, 0x79f18185U,
+        0x6414310cU, 0x0c171dc4U, 0xb412689cU, 0xdc114454U, 0x1382f328U, 0x7b81dfe0U,
+        0xc384aab8U, 0xab878670U, 0xb66236f9U, 0xde611a31U, 0x66646f69U, 0x0e6743a1U,
+        0x5daf0e7bU, 0x35ac22b3U, 0x8da957ebU, 0xe5aa7b23U, 0xf84fcbaaU, 0x904ce762U,
+        0x2849923aU, 0x404abef2U, 0xb2828a33U, 0xda81a6fbU, 0x6284d3a3U, 0x0a87ff6bU,
+        0x17624fe2U, 0x7f61632aU, 0xc7641672U, 0xaf673abaU, 0xfcaf7760U, 0x94ac5ba8U,
+        0x2ca92ef0U, 0x44aa0238U, 0x594fb2b1U, 0x314c9e79U, 0x8949eb21U, 0xe14ac7e9U,
+        0x2ed97095U, 0x46da5c5dU, 0xfedf2905U, 0x96dc05cdU, 0x8b39b544U, 0xe33a998cU,
+        0x5b3fecd4U, 0x333cc01cU, 0x60f48dc6U, 0x08f7a10eU, 0xb0f2d456U, 0xd8f1f89eU,
+        0xc5144817U, 0xad1764dfU, 0x15121187U, 0x7d113d4fU, 0x00000000U, 0x493c7d27U,
+        0x9278fa4eU, 0xdb448769U, 0x211d826dU, 0x6821ff4aU, 0xb3657823U, 0xfa590504U,
+        0x423b04daU, 0x0b0779fdU, 0xd043fe94U, 0x997f83b3U, 0x632686b7U, 0x2a1afb90U,
+        0xf15e7cf9U, 0xb86201deU, 0x847609b4U, 0xcd4a7493U, 0x160ef3faU, 0x5f328eddU,
+        0xa56b8bd9U, 0xec57f6feU, 0x37137197U, 0x7e2f0cb0U, 0xc64d0d6eU, 0x8f717049U,
+        0x5435f720U, 0x1d098a07U, 0xe7508f03U, 0xae6cf224U, 0x7528754dU, 0x3c14086aU,
+        0x0d006599U, 0x443c18beU, 0x9f789fd7U, 0xd644e2f0U, 0x2c1de7f4U, 0x65219ad3U,
+        0xbe651dbaU, 0xf759609dU, 0x4f3b6143U, 0x06071c64U, 0xdd439b0dU, 0x947fe62aU,
+        0x6e26e32eU, 0x271a9e09U, 0xfc5e1960U, 0xb5626447U, 0x89766c2dU, 0xc04a110aU,
+        0x1b0e9663U, 0x5232eb44U, 0xa86bee40U, 0xe1579367U, 0x3a13140eU, 0x732f6929U,
+        0xcb4d68f7U, 0x827115d0U, 0x593592b9U, 0x1009ef9eU, 0xea50ea9aU, 0xa36c97bdU,
+        0x782810d4U, 0x31146df3U, 0x1a00cb32U, 0x533cb615U, 0x8878317cU, 0xc1444c5bU,
+        0x3b1d495fU, 0x72213478U, 0xa965b311U, 0xe059ce36U, 0x583bcfe8U, 0x1107b2cfU,
+        0xca4335a6U, 0x837f4881U, 0x79264d85U, 0x301a30a2U, 0xeb5eb7cbU, 0xa262caecU,
+        0x9e76c286U, 0xd74abfa1U, 0x0c0e38c8U, 0x453245efU, 0xbf6b40ebU, 0xf6573dccU,
+        0x2d13baa5U, 0x642fc782U, 0xdc4dc65cU, 0x9571bb7bU, 0x4e353c12U, 0x07094135U,
+        0xfd504431U, 0xb46c3916U, 0x6f28be7fU, 0x2614c358U, 0x1700aeabU, 0x5e3cd38cU,
+        0x857854e5U, 0xcc4429c2U, 0x361d2cc6U, 0x7f2151e1U, 0xa465d688U, 0xed59abafU,
+        0x553baa71U, 0x1c07d756U, 0xc743503fU, 0x8e7f2d18U, 0x7426281cU, 0x3d1a553bU,
+        0xe65ed252U, 0xaf62af75U, 0x9376a71fU, 0xda4ada38U, 0x010e5d51U, 0x48322076U,
+        0xb26b2572U, 0xfb575855U, 0x2013df3cU, 0x692fa21bU, 0xd14da3c5U, 0x9871dee2U,
+        0x4335598bU, 0x0a0924acU, 0xf05021a8U, 0xb96c5c8fU, 0x6228dbe6U, 0x2b14a6c1U,
+        0x34019664U, 0x7d3deb43U, 0xa6796c2aU, 0xef45110dU, 0x151c1409U, 0x5c20692eU,
+        0x8764ee47U, 0xce589360U, 0x763a92beU, 0x3f06ef99U, 0xe44268f0U, 0xad7e15d7U,
+        0x572710d3U, 0x1e1b6df4U, 0xc55fea9dU, 0x8c6397baU, 0xb0779fd0U, 0xf94be2f7U,
+        0x220f659eU, 0x6b3318b9U, 0x916a1dbdU, 0xd856609aU, 0x0312e7f3U, 0x4a2e9ad4U,
+        0xf24c9b0aU, 0xbb70e62dU, 0x60346144U, 0x29081c63U, 0xd3511967U, 0x9a6d6440U,
+        0x4129e329U, 0x08159e0eU, 0x3901f3fdU, 0x703d8edaU, 0xab7909b3U, 0xe2457494U,
+        0x181c7190U, 0x51200cb7U, 0x8a648bdeU, 0xc358f6f9U, 0x7b3af727U, 0x32068a00U,
+        0xe9420d69U, 0xa07e704eU, 0x5a27754aU, 0x131b086dU, 0xc85f8f04U, 0x8163f223U,
+        0xbd77fa49U, 0xf44b876eU, 0x2f0f0007U, 0x66337d20U, 0x9c6a7824U, 0xd5560503U,
+        0x0e12826aU, 0x472eff4dU, 0xff4cfe93U, 0xb67083b4U, 0x6d3404ddU, 0x240879faU,
+        0xde517cfeU, 0x976d01d9U, 0x4c2986b0U, 0x0515fb97U, 0x2e015d56U, 0x673d2071U,
+        0xbc79a718U, 0xf545da3fU, 0x0f1cdf3bU, 0x4620a21cU, 0x9d642575U, 0xd4585852U,
+        0x6c3a598cU, 0x250624abU, 0xfe42a3c2U, 0xb77edee5U, 0x4d27dbe1U, 0x041ba6c6U,
+        0xdf5f21afU, 0x96635c88U, 0xaa7754e2U, 0xe34b29c5U, 0x380faeacU, 0x7133d38bU,
+        0x8b6ad68fU, 0xc256aba8U, 0x19122cc1U, 0x502e51e6U, 0xe84c5038U, 0xa1702d1fU,
+        0x7a34aa76U, 0x3308d751U, 0xc951d255U, 0x806daf72U, 0x5b29281bU, 0x1215553cU,
+        0x230138cfU, 0x6a3d45e8U, 0xb179c281U, 0xf845bfa6U, 0x021cbaa2U, 0x4b20c785U,
+        0x906440ecU, 0xd9583dcbU, 0x613a3c15U, 0x28064132U, 0xf342c65bU, 0xba7ebb7cU,
+        0x4027be78U, 0x091bc35fU, 0xd25f4436U, 0x9b633911U, 0xa777317bU, 0xee4b4c5cU,
+        0x350fcb35U, 0x7c33b612U, 0x866ab316U, 0xcf56ce31U, 0x14124958U, 0x5d2e347fU,
+        0xe54c35a1U, 0xac704886U, 0x7734cfefU, 0x3e08b2c8U, 0xc451b7ccU, 0x8d6dcaebU,
+        0x56294d82U, 0x1f1530a5U
+    };
+    return table;
+}
+
+static inline const uint32_t* lr__crc32_table(void) {
+    static const uint32_t table[2048] = {
+        0x00000000U, 0x77073096U, 0xee0e612cU, 0x990951baU, 0x076dc419U, 0x706af48fU,
+        0xe963a535U, 0x9e6495a3U, 0x0edb8832U, 0x79dcb8a4U, 0xe0d5e91eU, 0x97d2d988U,
+        0x09b64c2bU, 0x7eb17cbdU, 0xe7b82d07U, 0x90bf1d91U, 0x1db71064U, 0x6ab020f2U,
+        0xf3b97148U, 0x84be41deU, 0x1adad47dU, 0x6ddde4ebU, 0xf4d4b551U, 0x83d385c7U,
+        0x136c9856U, 0x646ba8c0U, 0xfd62f97aU, 0x8a65c9ecU, 0x14015c4fU, 0x63066cd9U,
+        0xfa0f3d63U, 0x8d080df5U, 0x3b6e20c8U, 0x4c69105eU, 0xd56041e4U, 0xa2677172U,
+        0x3c03e4d1U, 0x4b04d447U, 0xd20d85fdU, 0xa50ab56bU, 0x35b5a8faU, 0x42b2986cU,
+        0xdbbbc9d6U, 0xacbcf940U, 0x32d86ce3U, 0x45df5c75U, 0xdcd60dcfU, 0xabd13d59U,
+        0x26d930acU, 0x51de003aU, 0xc8d75180U, 0xbfd06116U, 0x21b4f4b5U, 0x56b3c423U,
+        0xcfba9599U, 0xb8bda50fU, 0x2802b89eU, 0x5f058808U, 0xc60cd9b2U, 0xb10be924U,
+        0x2f6f7c87U, 0x58684c11U, 0xc1611dabU, 0xb6662d3dU, 0x76dc4190U, 0x01db7106U,
+        0x98d220bcU, 0xefd5102aU, 0x71b18589U, 0x06b6b51fU, 0x9fbfe4a5U, 0xe8b8d433U,
+        0x7807c9a2U, 0x0f00f934U, 0x9609a88eU, 0xe10e9818U, 0x7f6a0dbbU, 0x086d3d2dU,
+        0x91646c97U, 0xe6635c01U, 0x6b6b51f4U, 0x1c6c6162U, 0x856530d8U, 0xf262004eU,
+        0x6c0695edU, 0x1b01a57bU, 0x8208f4c1U, 0xf50fc457U, 0x65b0d9c6U, 0x12b7e950U,
+        0x8bbeb8eaU, 0xfcb9887cU, 0x62dd1ddfU, 0x15da2d49U, 0x8cd37cf3U, 0xfbd44c65U,
+        0x4db26158U, 0x3ab551ceU, 0xa3bc0074U, 0xd4bb30e2U, 0x4adfa541U, 0x3dd895d7U,
+        0xa4d1c46dU, 0xd3d6f4fbU, 0x4369e96aU, 0x346ed9fcU, 0xad678846U, 0xda60b8d0U,
+        0x44042d73U, 0x33031de5U, 0xaa0a4c5fU, 0xdd0d7cc9U, 0x5005713cU, 0x270241aaU,
+        0xbe0b1010U, 0xc90c2086U, 0x5768b525U, 0x206f85b3U, 0xb966d409U, 0xce61e49fU,
+        0x5edef90eU, 0x29d9c998U, 0xb0d09822U, 0xc7d7a8b4U, 0x59b33d17U, 0x2eb40d81U,
+        0xb7bd5c3bU, 0xc0ba6cadU, 0xedb88320U, 0x9abfb3b6U, 0x03b6e20cU, 0x74b1d29aU,
+        0xead54739U, 0x9dd277afU, 0x04db2615U, 0x73dc1683U, 0xe3630b12U, 0x94643b84U,
+        0x0d6d6a3eU, 0x7a6a5aa8U, 0xe40ecf0bU, 0x9309ff9dU, 0x0a00ae27U, 0x7d079eb1U,
+        0xf00f9344U, 0x8708a3d2U, 0x1e01f268U, 0x6906c2feU, 0xf762575dU, 0x806567cbU,
+        0x196c3671U, 0x6e6b06e7U, 0xfed41b76U, 0x89d32be0U, 0x10da7a5aU, 0x67dd4accU,
+        0xf9b9df6fU, 0x8ebeeff9U, 0x17b7be43U, 0x60b08ed5U, 0xd6d6a3e8U, 0xa1d1937eU,
+        0x38d8c2c4U, 0x4fdff252U, 0xd1bb67f1U, 0xa6bc5767U, 0x3fb506ddU, 0x48b2364bU,
+        0xd80d2bdaU, 0xaf0a1b4cU, 0x36034af6U, 0x41047a60U, 0xdf60efc3U, 0xa867df55U,
+        0x316e8eefU, 0x4669be79U, 0xcb61b38cU, 0xbc66831aU, 0x256fd2a0U, 0x5268e236U,
+        0xcc0c7795U, 0xbb0b4703U, 0x220216b9U, 0x5505262fU, 0xc5ba3bbeU, 0xb2bd0b28U,
+        0x2bb45a92U, 0x5cb36a04U, 0xc2d7ffa7U, 0xb5d0cf31U, 0x2cd99e8bU, 0x5bdeae1dU,
+        0x9b64c2b0U, 0xec63f226U, 0x756aa39cU, 0x026d930aU, 0x9c0906a9U, 0xeb0e363fU,
+        0x72076785U, 0x05005713U, 0x95bf4a82U, 0xe2b87a14U, 0x7bb12baeU, 0x0cb61b38U,
+        0x92d28e9bU, 0xe5d5be0dU, 0x7cdcefb7U, 0x0bdbdf21U, 0x86d3d2d4U, 0xf1d4e242U,
+        0x68ddb3f8U, 0x1fda836eU, 0x81be16cdU, 0xf6b9265bU, 0x6fb077e1U, 0x18b74777U,
+        0x88085ae6U, 0xff0f6a70U, 0x66063bcaU, 0x11010b5cU, 0x8f659effU, 0xf862ae69U,
+        0x616bffd3U, 0x166ccf45U, 0xa00ae278U, 0xd70dd2eeU, 0x4e048354U, 0x3903b3c2U,
+        0xa7672661U, 0xd06016f7U, 0x4969474dU, 0x3e6e77dbU, 0xaed16a4aU, 0xd9d65adcU,
+        0x40df0b66U, 0x37d83bf0U, 0xa9bcae53U, 0xdebb9ec5U, 0x47b2cf7fU, 0x30b5ffe9U,
+        0xbdbdf21cU, 0xcabac28aU, 0x53b39330U, 0x24b4a3a6U, 0xbad03605U, 0xcdd70693U,
+        0x54de5729U, 0x23d967bfU, 0xb3667a2eU, 0xc4614ab8U, 0x5d681b02U, 0x2a6f2b94U,
+        0xb40bbe37U, 0xc30c8ea1U, 0x5a05df1bU, 0x2d02ef8dU, 0x00000000U, 0x191b3141U,
+        0x32366282U, 0x2b2d53c3U, 0x646cc504U, 0x7d77f445U, 0x565aa786U, 0x4f4196c7U,
+        0xc8d98a08U, 0xd1c2bb49U, 0xfaefe88aU, 0xe3f4d9cbU, 0xacb54f0cU, 0xb5ae7e4dU,
+        0x9e832d8eU, 0x87981ccfU, 0x4ac21251U, 0x53d92310U, 0x78f470d3U, 0x61ef4192U,
+        0x2eaed755U, 0x37b5e614U, 0x1c98b5d7U, 0x05838496U, 0x821b9859U, 0x9b00a918U,
+        0xb02dfadbU, 0xa936cb9aU, 0xe6775d5dU, 0xff6c6c1cU, 0xd4413fdfU, 0xcd5a0e9eU,
+        0x958424a2U, 0x8c9f15e3U, 0xa7b24620U, 0xbea97761U, 0xf1e8e1a6U, 0xe8f3d0e7U,
+        0xc3de8324U, 0xdac5b265U, 0x5d5daeaaU, 0x44469febU, 0x6f6bcc28U, 0x7670fd69U,
+        0x39316baeU, 0x202a5aefU, 0x0b07092cU, 0x121c386dU, 0xdf4636f3U, 0xc65d07b2U,
+        0xed705471U, 0xf46b6530U, 0xbb2af3f7U, 0xa231c2b6U, 0x891c9175U, 0x9007a034U,
+        0x179fbcfbU, 0x0e848dbaU, 0x25a9de79U, 0x3cb2ef38U, 0x73f379ffU, 0x6ae848beU,
+        0x41c51b7dU, 0x58de2a3cU, 0xf0794f05U, 0xe9627e44U, 0xc24f2d87U, 0xdb541cc6U,
+        0x94158a01U, 0x8d0ebb40U, 0xa623e883U, 0xbf38d9c2U, 0x38a0c50dU, 0x21bbf44cU,
+        0x0a96a78fU, 0x138d96ceU, 0x5ccc0009U, 0x45d73148U, 0x6efa628bU, 0x77e153caU,
+        0xbabb5d54U, 0xa3a06c15U, 0x888d3fd6U, 0x91960e97U, 0xded79850U, 0xc7cca911U,
+        0xece1fad2U, 0xf5facb93U, 0x7262d75cU, 0x6b79e61dU, 0x4054b5deU, 0x594f849fU,
+        0x160e1258U, 0x0f152319U, 0x243870daU, 0x3d23419bU, 0x65fd6ba7U, 0x7ce65ae6U,
+        0x57cb0925U, 0x4ed03864U, 0x0191aea3U, 0x188a9fe2U, 0x33a7cc21U, 0x2abcfd60U,
+        0xad24e1afU, 0xb43fd0eeU, 0x9f12832dU, 0x8609b26cU, 0xc94824abU, 0xd05315eaU,
+        0xfb7e4629U, 0xe2657768U, 0x2f3f79f6U, 0x362448b7U, 0x1d091b74U, 0x04122a35U,
+        0x4b53bcf2U, 0x52488db3U, 0x7965de70U, 0x607eef31U, 0xe7e6f3feU, 0xfefdc2bfU,
+        0xd5d0917cU, 0xcccba03dU, 0x838a36faU, 0x9a9107bbU, 0xb1bc5478U, 0xa8a76539U,
+        0x3b83984bU, 0x2298a90aU, 0x09b5fac9U, 0x10aecb88U, 0x5fef5d4fU, 0x46f46c0eU,
+        0x6dd93fcdU, 0x74c20e8cU, 0xf35a1243U, 0xea412302U, 0xc16c70c1U, 0xd8774180U,
+        0x9736d747U, 0x8e2de606U, 0xa500b5c5U, 0xbc1b8484U, 0x71418a1aU, 0x685abb5bU,
+        0x4377e898U, 0x5a6cd9d9U, 0x152d4f1eU, 0x0c367e5fU, 0x271b2d9cU, 0x3e001cddU,
+        0xb9980012U, 0xa0833153U, 0x8bae6290U, 0x92b553d1U, 0xddf4c516U, 0xc4eff457U,
+        0xefc2a794U, 0xf6d996d5U, 0xae07bce9U, 0xb71c8da8U, 0x9c31de6bU, 0x852aef2aU,
+        0xca6b79edU, 0xd37048acU, 0xf85d1b6fU, 0xe1462a2eU, 0x66de36e1U, 0x7fc507a0U,
+        0x54e85463U, 0x4df36522U, 0x02b2f3e5U, 0x1ba9c2a4U, 0x30849167U, 0x299fa026U,
+        0xe4c5aeb8U, 0xfdde9ff9U, 0xd6f3cc3aU, 0xcfe8fd7bU, 0x80a96bbcU, 0x99b25afdU,
+        0xb29f093eU, 0xab84387fU, 0x2c1c24b0U, 0x350715f1U, 0x1e2a4632U, 0x07317773U,
+        0x4870e1b4U, 0x516bd0f5U, 0x7a468336U, 0x635db277U, 0xcbfad74eU, 0xd2e1e60fU,
+        0xf9ccb5ccU, 0xe0d7848dU, 0xaf96124aU, 0xb68d230bU, 0x9da070c8U, 0x84bb4189U,
+        0x03235d46U, 0x1a386c07U, 0x31153fc4U, 0x280e0e85U, 0x674f9842U, 0x7e54a903U,
+        0x5579fac0U, 0x4c62cb81U, 0x8138c51fU, 0x9823f45eU, 0xb30ea79dU, 0xaa1596dcU,
+        0xe554001bU, 0xfc4f315aU, 0xd7626299U, 0xce7953d8U, 0x49e14f17U, 0x50fa7e56U,
+        0x7bd72d95U, 0x62cc1cd4U, 0x2d8d8a13U, 0x3496bb52U, 0x1fbbe891U, 0x06a0d9d0U,
+        0x5e7ef3ecU, 0x4765c2adU, 0x6c48916eU, 0x7553a02fU, 0x3a1236e8U, 0x230907a9U,
+        0x0824546aU, 0x113f652bU, 0x96a779e4U, 0x8fbc48a5U, 0xa4911b66U, 0xbd8a2a27U,
+        0xf2cbbce0U, 0xebd08da1U, 0xc0fdde62U, 0xd9e6ef23U, 0x14bce1bdU, 0x0da7d0fcU,
+        0x268a833fU, 0x3f91b27eU, 0x70d024b9U, 0x69cb15f8U, 0x42e6463bU, 0x5bfd777aU,
+        0xdc656bb5U, 0xc57e5af4U, 0xee530937U, 0xf7483876U, 0xb809aeb1U, 0xa1129ff0U,
+        0x8a3fcc33U, 0x9324fd72U, 0x00000000U, 0x01c26a37U, 0x0384d46eU, 0x0246be59U,
+        0x0709a8dcU, 0x06cbc2ebU, 0x048d7cb2U, 0x054f1685U, 0x0e1351b8U, 0x0fd13b8fU,
+        0x0d9785d6U, 0x0c55efe1U, 0x091af964U, 0x08d89353U, 0x0a9e2d0aU, 0x0b5c473dU,
+        0x1c26a370U, 0x1de4c947U, 0x1fa2771eU, 0x1e601d29U, 0x1b2f0bacU, 0x1aed619bU,
+        0x18abdfc2U, 0x1969b5f5U, 0x1235f2c8U, 0x13f798ffU, 0x11b126a6U, 0x10734c91U,
+        0x153c5a14U, 0x14fe3023U, 0x16b88e7aU, 0x177ae44dU, 0x384d46e0U, 0x398f2cd7U,
+        0x3bc9928eU, 0x3a0bf8b9U, 0x3f44ee3cU, 0x3e86840bU, 0x3cc03a52U, 0x3d025065U,
+        0x365e1758U, 0x379c7d6fU, 0x35dac336U, 0x3418a901U, 0x3157bf84U, 0x3095d5b3U,
+        0x32d36beaU, 0x331101ddU, 0x246be590U, 0x25a98fa7U, 0x27ef31feU, 0x262d5bc9U,
+        0x23624d4cU, 0x22a0277bU, 0x20e69922U, 0x2124f315U, 0x2a78b428U, 0x2bbade1fU,
+        0x29fc6046U, 0x283e0a71U, 0x2d711cf4U, 0x2cb376c3U, 0x2ef5c89aU, 0x2f37a2adU,
+        0x709a8dc0U, 0x7158e7f7U, 0x731e59aeU, 0x72dc3399U, 0x7793251cU, 0x76514f2bU,
+        0x7417f172U, 0x75d59b45U, 0x7e89dc78U, 0x7f4bb64fU, 0x7d0d0816U, 0x7ccf6221U,
+        0x798074a4U, 0x78421e93U, 0x7a04a0caU, 0x7bc6cafdU, 0x6cbc2eb0U, 0x6d7e4487U,
+        0x6f38fadeU, 0x6efa90e9U, 0x6bb5866cU, 0x6a77ec5bU, 0x68315202U, 0x69f33835U,
+        0x62af7f08U, 0x636d153fU, 0x612bab66U, 0x60e9c151U, 0x65a6d7d4U, 0x6464bde3U,
+        0x662203baU, 0x67e0698dU, 0x48d7cb20U, 0x4915a117U, 0x4b531f4eU, 0x4a917579U,
+        0x4fde63fcU, 0x4e1c09cbU, 0x4c5ab792U, 0x4d98dda5U, 0x46c49a98U, 0x4706f0afU,
+        0x45404ef6U, 0x448224c1U, 0x41cd3244U, 0x400f5873U, 0x4249e62aU, 0x438b8c1dU,
+        0x54f16850U, 0x55330267U, 0x5775bc3eU, 0x56b7d609U, 0x53f8c08cU, 0x523aaabbU,
+        0x507c14e2U, 0x51be7ed5U, 0x5ae239e8U, 0x5b2053dfU, 0x5966ed86U, 0x58a487b1U,
+        0x5deb9134U, 0x5c29fb03U, 0x5e6f455aU, 0x5fad2f6dU, 0xe1351b80U, 0xe0f771b7U,
+        0xe2b1cfeeU, 0xe373a5d9U, 0xe63cb35cU, 0xe7fed96bU, 0xe5b86732U, 0xe47a0d05U,
+        0xef264a38U, 0xeee4200fU, 0xeca29e56U, 0xed60f461U, 0xe82fe2e4U, 0xe9ed88d3U,
+        0xebab368aU, 0xea695cbdU, 0xfd13b8f0U, 0xfcd1d2c7U, 0xfe976c9eU, 0xff5506a9U,
+        0xfa1a102cU, 0xfbd87a1bU, 0xf99ec442U, 0xf85cae75U, 0xf300e948U, 0xf2c2837fU,
+        0xf0843d26U, 0xf1465711U, 0xf4094194U, 0xf5cb2ba3U, 0xf78d95faU, 0xf64fffcdU,
+        0xd9785d60U, 0xd8ba3757U, 0xdafc890eU, 0xdb3ee339U, 0xde71f5bcU, 0xdfb39f8bU,
+        0xddf521d2U, 0xdc374be5U, 0xd76b0cd8U, 0xd6a966efU, 0xd4efd8b6U, 0xd52db281U,
+        0xd062a404U, 0xd1a0ce33U, 0xd3e6706aU, 0xd2241a5dU, 0xc55efe10U, 0xc49c9427U,
+        0xc6da2a7eU, 0xc7184049U, 0xc25756ccU, 0xc3953cfbU, 0xc1d382a2U, 0xc011e895U,
+        0xcb4dafa8U, 0xca8fc59fU, 0xc8c97bc6U, 0xc90b11f1U, 0xcc440774U, 0xcd866d43U,
+        0xcfc0d31aU, 0xce02b92dU, 0x91af9640U, 0x906dfc77U, 0x922b422eU, 0x93e92819U,
+        0x96a63e9cU, 0x976454abU, 0x9522eaf2U, 0x94e080c5U, 0x9fbcc7f8U, 0x9e7eadcfU,
+        0x9c381396U, 0x9dfa79a1U, 0x98b56f24U, 0x99770513U, 0x9b31bb4aU, 0x9af3d17dU,
+        0x8d893530U, 0x8c4b5f07U, 0x8e0de15eU, 0x8fcf8b69U, 0x8a809decU, 0x8b42f7dbU,
+        0x89044982U, 0x88c623b5U, 0x839a6488U, 0x82580ebfU, 0x801eb0e6U, 0x81dcdad1U,
+        0x8493cc54U, 0x8551a663U, 0x8717183aU, 0x86d5720dU, 0xa9e2d0a0U, 0xa820ba97U,
+        0xaa6604ceU, 0xaba46ef9U, 0xaeeb787cU, 0xaf29124bU, 0xad6fac12U, 0xacadc625U,
+        0xa7f18118U, 0xa633eb2fU, 0xa4755576U, 0xa5b73f41U, 0xa0f829c4U, 0xa13a43f3U,
+        0xa37cfdaaU, 0xa2be979dU, 0xb5c473d0U, 0xb40619e7U, 0xb640a7beU, 0xb782cd89U,
+        0xb2cddb0cU, 0xb30fb13bU, 0xb1490f62U, 0xb08b6555U, 0xbbd72268U, 0xba15485fU,
+        0xb853f606U, 0xb9919c31U, 0xbcde8ab4U, 0xbd1ce083U, 0xbf5a5edaU, 0xbe9834edU,
+        0x00000000U, 0xb8bc6765U, 0xaa09c88bU, 0x12b5afeeU, 0x8f629757U, 0x37def032U,
+        0x256b5fdcU, 0x9dd738b9U, 0xc5b428efU, 0x7d084f8aU, 0x6fbde064U, 0xd7018701U,
+        0x4ad6bfb8U, 0xf26ad8ddU, 0xe0df7733U, 0x58631056U, 0x5019579fU, 0xe8a530faU,
+        0xfa109f14U, 0x42acf871U, 0xdf7bc0c8U, 0x67c7a7adU, 0x75720843U, 0xcdce6f26U,
+        0x95ad7f70U, 0x2d111815U, 0x3fa4b7fbU, 0x8718d09eU, 0x1acfe827U, 0xa2738f42U,
+        0xb0c620acU, 0x087a47c9U, 0xa032af3eU, 0x188ec85bU, 0x0a3b67b5U, 0xb28700d0U,
+        0x2f503869U, 0x97ec5f0cU, 0x8559f0e2U, 0x3de59787U, 0x658687d1U, 0xdd3ae0b4U,
+        0xcf8f4f5aU, 0x7733283fU, 0xeae41086U, 0x525877e3U, 0x40edd80dU, 0xf851bf68U,
+        0xf02bf8a1U, 0x48979fc4U, 0x5a22302aU, 0xe29e574fU, 0x7f496ff6U, 0xc7f50893U,
+        0xd540a77dU, 0x6dfcc018U, 0x359fd04eU, 0x8d23b72bU, 0x9f9618c5U, 0x272a7fa0U,
+        0xbafd4719U, 0x0241207cU, 0x10f48f92U, 0xa848e8f7U, 0x9b14583dU, 0x23a83f58U,
+        0x311d90b6U, 0x89a1f7d3U, 0x1476cf6aU, 0xaccaa80fU, 0xbe7f07e1U, 0x06c36084U,
+        0x5ea070d2U, 0xe61c17b7U, 0xf4a9b859U, 0x4c15df3cU, 0xd1c2e785U, 0x697e80e0U,
+        0x7bcb2f0eU, 0xc377486bU, 0xcb0d0fa2U, 0x73b168c7U, 0x6104c729U, 0xd9b8a04cU,
+        0x446f98f5U, 0xfcd3ff90U, 0xee66507eU, 0x56da371bU, 0x0eb9274dU, 0xb6054028U,
+        0xa4b0efc6U, 0x1c0c88a3U, 0x81dbb01aU, 0x3967d77fU, 0x2bd27891U, 0x936e1ff4U,
+        0x3b26f703U, 0x839a9066U, 0x912f3f88U, 0x299358edU, 0xb4446054U, 0x0cf80731U,
+        0x1e4da8dfU, 0xa6f1cfbaU, 0xfe92dfecU, 0x462eb889U, 0x549b1767U, 0xec277002U,
+        0x71f048bbU, 0xc94c2fdeU, 0xdbf98030U, 0x6345e755U, 0x6b3fa09cU, 0xd383c7f9U,
+        0xc1366817U, 0x798a0f72U, 0xe45d37cbU, 0x5ce150aeU, 0x4e54ff40U, 0xf6e89825U,
+        0xae8b8873U, 0x1637ef16U, 0x048240f8U, 0xbc3e279dU, 0x21e91f24U, 0x99557841U,
+        0x8be0d7afU, 0x335cb0caU, 0xed59b63bU, 0x55e5d15eU, 0x47507eb0U, 0xffec19d5U,
+        0x623b216cU, 0xda874609U, 0xc832e9e7U, 0x708e8e82U, 0x28ed9ed4U, 0x9051f9b1U,
+        0x82e4565fU, 0x3a58313aU, 0xa78f0983U, 0x1f336ee6U, 0x0d86c108U, 0xb53aa66dU,
+        0xbd40e1a4U, 0x05fc86c1U, 0x1749292fU, 0xaff54e4aU, 0x322276f3U, 0x8a9e1196U,
+        0x982bbe78U, 0x2097d91dU, 0x78f4c94bU, 0xc048ae2eU, 0xd2fd01c0U, 0x6a4166a5U,
+        0xf7965e1cU, 0x4f2a3979U, 0x5d9f9697U, 0xe523f1f2U, 0x4d6b1905U, 0xf5d77e60U,
+        0xe762d18eU, 0x5fdeb6ebU, 0xc2098e52U, 0x7ab5e937U, 0x680046d9U, 0xd0bc21bcU,
+        0x88df31eaU, 0x3063568fU, 0x22d6f961U, 0x9a6a9e04U, 0x07bda6bdU, 0xbf01c1d8U,
+        0xadb46e36U, 0x15080953U, 0x1d724e9aU, 0xa5ce29ffU, 0xb77b8611U, 0x0fc7e174U,
+        0x9210d9cdU, 0x2aacbea8U, 0x38191146U, 0x80a57623U, 0xd8c66675U, 0x607a0110U,
+        0x72cfaefeU, 0xca73c99bU, 0x57a4f122U, 0xef189647U, 0xfdad39a9U, 0x45115eccU,
+        0x764dee06U, 0xcef18963U, 0xdc44268dU, 0x64f841e8U, 0xf92f7951U, 0x41931e34U,
+        0x5326b1daU, 0xeb9ad6bfU, 0xb3f9c6e9U, 0x0b45a18cU, 0x19f00e62U, 0xa14c6907U,
+        0x3c9b51beU, 0x842736dbU, 0x96929935U, 0x2e2efe50U, 0x2654b999U, 0x9ee8defcU,
+        0x8c5d7112U, 0x34e11677U, 0xa9362eceU, 0x118a49abU, 0x033fe645U, 0xbb838120U,
+        0xe3e09176U, 0x5b5cf613U, 0x49e959fdU, 0xf1553e98U, 0x6c820621U, 0xd43e6144U,
+        0xc68bceaaU, 0x7e37a9cfU, 0xd67f4138U, 0x6ec3265dU, 0x7c7689b3U, 0xc4caeed6U,
+        0x591dd66fU, 0xe1a1b10aU, 0xf3141ee4U, 0x4ba87981U, 0x13cb69d7U, 0xab770eb2U,
+        0xb9c2a15cU, 0x017ec639U, 0x9ca9fe80U, 0x241599e5U, 0x36a0360bU, 0x8e1c516eU,
+        0x866616a7U, 0x3eda71c2U, 0x2c6fde2cU, 0x94d3b949U, 0x090481f0U, 0xb1b8e695U,
+        0xa30d497bU, 0x1bb12e1eU, 0x43d23e48U, 0xfb6e592dU, 0xe9dbf6c3U, 0x516791a6U,
+        0xccb0a91fU, 0x740cce7aU, 0x66b96194U, 0xde0506f1U, 0x00000000U, 0x3d6029b0U,
+        0x7ac05360U, 0x47a07ad0U, 0xf580a6c0U, 0xc8e08f70U, 0x8f40f5a0U, 0xb220dc10U,
+        0x30704bc1U, 0x0d106271U, 0x4ab018a1U, 0x77d03111U, 0xc5f0ed01U, 0xf890c4b1U,
+        0xbf30be61U, 0x825097d1U, 0x60e09782U, 0x5d80be32U, 0x1a20c4e2U, 0x2740ed52U,
+        0x95603142U, 0xa80018f2U, 0xefa06222U, 0xd2c04b92U, 0x5090dc43U, 0x6df0f5f3U,
+        0x2a508f23U, 0x1730a693U, 0xa5107a83U, 0x98705333U, 0xdfd029e3U, 0xe2b00053U,
+        0xc1c12f04U, 0xfca106b4U, 0xbb017c64U, 0x866155d4U, 0x344189c4U, 0x0921a074U,
+        0x4e81daa4U, 0x73e1f314U, 0xf1b164c5U, 0xccd14d75U, 0x8b7137a5U, 0xb6111e15U,
+        0x0431c205U, 0x3951ebb5U, 0x7ef19165U, 0x4391b8d5U, 0xa121b886U, 0x9c419136U,
+        0xdbe1ebe6U, 0xe681c256U, 0x54a11e46U, 0x69c137f6U, 0x2e614d26U, 0x13016496U,
+        0x9151f347U, 0xac31daf7U, 0xeb91a027U, 0xd6f18997U, 0x64d15587U, 0x59b17c37U,
+        0x1e1106e7U, 0x23712f57U, 0x58f35849U, 0x659371f9U, 0x22330b29U, 0x1f532299U,
+        0xad73fe89U, 0x9013d739U, 0xd7b3ade9U, 0xead38459U, 0x68831388U, 0x55e33a38U,
+        0x124340e8U, 0x2f236958U, 0x9d03b548U, 0xa0639cf8U, 0xe7c3e628U, 0xdaa3cf98U,
+        0x3813cfcbU, 0x0573e67bU, 0x42d39cabU, 0x7fb3b51bU, 0xcd93690bU, 0xf0f340bbU,
+        0xb7533a6bU, 0x8a3313dbU, 0x0863840aU, 0x3503adbaU, 0x72a3d76aU, 0x4fc3fedaU,
+        0xfde322caU, 0xc0830b7aU, 0x872371aaU, 0xba43581aU, 0x9932774dU, 0xa4525efdU,
+        0xe3f2242dU, 0xde920d9dU, 0x6cb2d18dU, 0x51d2f83dU, 0x167282edU, 0x2b12ab5dU,
+        0xa9423c8cU, 0x9422153cU, 0xd3826fecU, 0xeee2465cU, 0x5cc29a4cU, 0x61a2b3fcU,
+        0x2602c92cU, 0x1b62e09cU, 0xf9d2e0cfU, 0xc4b2c97fU, 0x8312b3afU, 0xbe729a1fU,
+        0x0c52460fU, 0x31326fbfU, 0x7692156fU, 0x4bf23cdfU, 0xc9a2ab0eU, 0xf4c282beU,
+        0xb362f86eU, 0x8e02d1deU, 0x3c220dceU, 0x0142247eU, 0x46e25eaeU, 0x7b82771eU,
+        0xb1e6b092U, 0x8c869922U, 0xcb26e3f2U, 0xf646ca42U, 0x44661652U, 0x79063fe2U,
+        0x3ea64532U, 0x03c66c82U, 0x8196fb53U, 0xbcf6d2e3U, 0xfb56a833U, 0xc6368183U,
+        0x74165d93U, 0x49767423U, 0x0ed60ef3U, 0x33b62743U, 0xd1062710U, 0xec660ea0U,
+        0xabc67470U, 0x96a65dc0U, 0x248681d0U, 0x19e6a860U, 0x5e46d2b0U, 0x6326fb00U,
+        0xe1766cd1U, 0xdc164561U, 0x9bb63fb1U, 0xa6d61601U, 0x14f6ca11U, 0x2996e3a1U,
+        0x6e369971U, 0x5356b0c1U, 0x70279f96U, 0x4d47b626U, 0x0ae7ccf6U, 0x3787e546U,
+        0x85a73956U, 0xb8c710e6U, 0xff676a36U, 0xc2074386U, 0x4057d457U, 0x7d37fde7U,
+        0x3a978737U, 0x07f7ae87U, 0xb5d77297U, 0x88b75b27U, 0xcf1721f7U, 0xf2770847U,
+        0x10c70814U, 0x2da721a4U, 0x6a075b74U, 0x576772c4U, 0xe547aed4U, 0xd8278764U,
+        0x9f87fdb4U, 0xa2e7d404U, 0x20b743d5U, 0x1dd76a65U, 0x5a7710b5U, 0x67173905U,
+        0xd537e515U, 0xe857cca5U, 0xaff7b675U, 0x92979fc5U, 0xe915e8dbU, 0xd475c16bU,
+        0x93d5bbbbU, 0xaeb5920bU, 0x1c954e1bU, 0x21f567abU, 0x66551d7bU, 0x5b3534cbU,
+        0xd965a31aU, 0xe4058aaaU, 0xa3a5f07aU, 0x9ec5d9caU, 0x2ce505daU, 0x11852c6aU,
+        0x562556baU, 0x6b457f0aU, 0x89f57f59U, 0xb49556e9U, 0xf3352c39U, 0xce550589U,
+        0x7c75d999U, 0x4115f029U, 0x06b58af9U, 0x3bd5a349U, 0xb9853498U, 0x84e51d28U,
+        0xc34567f8U, 0xfe254e48U, 0x4c059258U, 0x7165bbe8U, 0x36c5c138U, 0x0ba5e888U,
+        0x28d4c7dfU, 0x15b4ee6fU, 0x521494bfU, 0x6f74bd0fU, 0xdd54611fU, 0xe03448afU,
+        0xa794327fU, 0x9af41bcfU, 0x18a48c1eU, 0x25c4a5aeU, 0x6264df7eU, 0x5f04f6ceU,
+        0xed242adeU, 0xd044036eU, 0x97e479beU, 0xaa84500eU, 0x4834505dU, 0x755479edU,
+        0x32f4033dU, 0x0f942a8dU, 0xbdb4f69dU, 0x80d4df2dU, 0xc774a5fdU, 0xfa148c4dU,
+        0x78441b9cU, 0x4524322cU, 0x028448fcU, 0x3fe4614cU, 0x8dc4bd5cU, 0xb0a494ecU,
+        0xf704ee3cU, 0xca64c78cU, 0x00000000U, 0xcb5cd3a5U, 0x4dc8a10bU, 0x869472aeU,
+        0x9b914216U, 0x50cd91b3U, 0xd659e31dU, 0x1d0530b8U, 0xec53826dU, 0x270f51c8U,
+        0xa19b2366U, 0x6ac7f0c3U, 0x77c2c07bU, 0xbc9e13deU, 0x3a0a6170U, 0xf156b2d5U,
+        0x03d6029bU, 0xc88ad13eU, 0x4e1ea390U, 0x85427035U, 0x9847408dU, 0x531b9328U,
+        0xd58fe186U, 0x1ed33223U, 0xef8580f6U, 0x24d95353U, 0xa24d21fdU, 0x6911f258U,
+        0x7414c2e0U, 0xbf481145U, 0x39dc63ebU, 0xf280b04eU, 0x07ac0536U, 0xccf0d693U,
+        0x4a64a43dU, 0x81387798U, 0x9c3d4720U, 0x57619485U, 0xd1f5e62bU, 0x1aa9358eU,
+        0xebff875bU, 0x20a354feU, 0xa6372650U, 0x6d6bf5f5U, 0x706ec54dU, 0xbb3216e8U,
+        0x3da66446U, 0xf6fab7e3U, 0x047a07adU, 0xcf26d408U, 0x49b2a6a6U, 0x82ee7503U,
+        0x9feb45bbU, 0x54b7961eU, 0xd223e4b0U, 0x197f3715U, 0xe82985c0U, 0x23755665U,
+        0xa5e124cbU, 0x6ebdf76eU, 0x73b8c7d6U, 0xb8e41473U, 0x3e7066ddU, 0xf52cb578U,
+        0x0f580a6cU, 0xc404d9c9U, 0x4290ab67U, 0x89cc78c2U, 0x94c9487aU, 0x5f959bdfU,
+        0xd901e971U, 0x125d3ad4U, 0xe30b8801U, 0x28575ba4U, 0xaec3290aU, 0x659ffaafU,
+        0x789aca17U, 0xb3c619b2U, 0x35526b1cU, 0xfe0eb8b9U, 0x0c8e08f7U, 0xc7d2db52U,
+        0x4146a9fcU, 0x8a1a7a59U, 0x971f4ae1U, 0x5c439944U, 0xdad7ebeaU, 0x118b384fU,
+        0xe0dd8a9aU, 0x2b81593fU, 0xad152b91U, 0x6649f834U, 0x7b4cc88cU, 0xb0101b29U,
+        0x36846987U, 0xfdd8ba22U, 0x08f40f5aU, 0xc3a8dcffU, 0x453cae51U, 0x8e607df4U,
+        0x93654d4cU, 0x58399ee9U, 0xdeadec47U, 0x15f13fe2U, 0xe4a78d37U, 0x2ffb5e92U,
+        0xa96f2c3cU, 0x6233ff99U, 0x7f36cf21U, 0xb46a1c84U, 0x32fe6e2aU, 0xf9a2bd8fU,
+        0x0b220dc1U, 0xc07ede64U, 0x46eaaccaU, 0x8db67f6fU, 0x90b34fd7U, 0x5bef9c72U,
+        0xdd7beedcU, 0x16273d79U, 0xe7718facU, 0x2c2d5c09U, 0xaab92ea7U, 0x61e5fd02U,
+        0x7ce0cdbaU, 0xb7bc1e1fU, 0x31286cb1U, 0xfa74bf14U, 0x1eb014d8U, 0xd5ecc77dU,
+        0x5378b5d3U, 0x98246676U, 0x852156ceU, 0x4e7d856bU, 0xc8e9f7c5U, 0x03b52460U,
+        0xf2e396b5U, 0x39bf4510U, 0xbf2b37beU, 0x7477e41bU, 0x6972d4a3U, 0xa22e0706U,
+        0x24ba75a8U, 0xefe6a60dU, 0x1d661643U, 0xd63ac5e6U, 0x50aeb748U, 0x9bf264edU,
+        0x86f75455U, 0x4dab87f0U, 0xcb3ff55eU, 0x006326fbU, 0xf135942eU, 0x3a69478bU,
+        0xbcfd3525U, 0x77a1e680U, 0x6aa4d638U, 0xa1f8059dU, 0x276c7733U, 0xec30a496U,
+        0x191c11eeU, 0xd240c24bU, 0x54d4b0e5U, 0x9f886340U, 0x828d53f8U, 0x49d1805dU,
+        0xcf45f2f3U, 0x04192156U, 0xf54f9383U, 0x3e134026U, 0xb8873288U, 0x73dbe12dU,
+        0x6eded195U, 0xa5820230U, 0x2316709eU, 0xe84aa33bU, 0x1aca1375U, 0xd196c0d0U,
+        0x5702b27eU, 0x9c5e61dbU, 0x815b5163U, 0x4a0782c6U, 0xcc93f068U, 0x07cf23cdU,
+        0xf6999118U, 0x3dc542bdU, 0xbb513013U, 0x700de3b6U, 0x6d08d30eU, 0xa65400abU,
+        0x20c07205U, 0xeb9ca1a0U, 0x11e81eb4U, 0xdab4cd11U, 0x5c20bfbfU, 0x977c6c1aU,
+        0x8a795ca2U, 0x41258f07U, 0xc7b1fda9U, 0x0ced2e0cU, 0xfdbb9cd9U, 0x36e74f7cU,
+        0xb0733dd2U, 0x7b2fee77U, 0x662adecfU, 0xad760d6aU, 0x2be27fc4U, 0xe0beac61U,
+        0x123e1c2fU, 0xd962cf8aU, 0x5ff6bd24U, 0x94aa6e81U, 0x89af5e39U, 0x42f38d9cU,
+        0xc467ff32U, 0x0f3b2c97U, 0xfe6d9e42U, 0x35314de7U, 0xb3a53f49U, 0x78f9ececU,
+        0x65fcdc54U, 0xaea00ff1U, 0x28347d5fU, 0xe368aefaU, 0x16441b82U, 0xdd18c827U,
+        0x5b8cba89U, 0x90d0692cU, 0x8dd55994U, 0x46898a31U, 0xc01df89fU, 0x0b412b3aU,
+        0xfa1799efU, 0x314b4a4aU, 0xb7df38e4U, 0x7c83eb41U, 0x6186dbf9U, 0xaada085cU,
+        0x2c4e7af2U, 0xe712a957U, 0x15921919U, 0xdececabcU, 0x585ab812U, 0x93066bb7U,
+        0x8e035b0fU, 0x455f88aaU, 0xc3cbfa04U, 0x089729a1U, 0xf9c19b74U, 0x329d48d1U,
+        0xb4093a7fU, 0x7f55e9daU, 0x6250d962U, 0xa90c0ac7U, 0x2f987869U, 0xe4c4abccU,
+        0x00000000U, 0xa6770bb4U, 0x979f1129U, 0x31e81a9dU, 0xf44f2413U, 0x52382fa7U,
+        0x63d0353aU, 0xc5a73e8eU, 0x33ef4e67U, 0x959845d3U, 0xa4705f4eU, 0x020754faU,
+        0xc7a06a74U, 0x61d761c0U, 0x503f7b5dU, 0xf64870e9U, 0x67de9cceU, 0xc1a9977aU,
+        0xf0418de7U, 0x56368653U, 0x9391b8ddU, 0x35e6b369U, 0x040ea9f4U, 0xa279a240U,
+        0x5431d2a9U, 0xf246d91dU, 0xc3aec380U, 0x65d9c834U, 0xa07ef6baU, 0x0609fd0eU,
+        0x37e1e793U, 0x9196ec27U, 0xcfbd399cU, 0x69ca3228U, 0x582228b5U, 0xfe552301U,
+        0x3bf21d8fU, 0x9d85163bU, 0xac6d0ca6U, 0x0a1a0712U, 0xfc5277fbU, 0x5a257c4fU,
+        0x6bcd66d2U, 0xcdba6d66U, 0x081d53e8U, 0xae6a585cU, 0x9f8242c1U, 0x39f54975U,
+        0xa863a552U, 0x0e14aee6U, 0x3ffcb47bU, 0x998bbfcfU, 0x5c2c8141U, 0xfa5b8af5U,
+        0xcbb39068U, 0x6dc49bdcU, 0x9b8ceb35U, 0x3dfbe081U, 0x0c13fa1cU, 0xaa64f1a8U,
+        0x6fc3cf26U, 0xc9b4c492U, 0xf85cde0fU, 0x5e2bd5bbU, 0x440b7579U, 0xe27c7ecdU,
+        0xd3946450U, 0x75e36fe4U, 0xb044516aU, 0x16335adeU, 0x27db4043U, 0x81ac4bf7U,
+        0x77e43b1eU, 0xd19330aaU, 0xe07b2a37U, 0x460c2183U, 0x83ab1f0dU, 0x25dc14b9U,
+        0x14340e24U, 0xb2430590U, 0x23d5e9b7U, 0x85a2e203U, 0xb44af89eU, 0x123df32aU,
+        0xd79acda4U, 0x71edc610U, 0x4005dc8dU, 0xe672d739U, 0x103aa7d0U, 0xb64dac64U,
+        0x87a5b6f9U, 0x21d2bd4dU, 0xe47583c3U, 0x42028877U, 0x73ea92eaU, 0xd59d995eU,
+        0x8bb64ce5U, 0x2dc14751U, 0x1c295dccU, 0xba5e5678U, 0x7ff968f6U, 0xd98e6342U,
+        0xe86679dfU, 0x4e11726bU, 0xb8590282U, 0x1e2e0936U, 0x2fc613abU, 0x89b1181fU,
+        0x4c162691U, 0xea612d25U, 0xdb8937b8U, 0x7dfe3c0cU, 0xec68d02bU, 0x4a1fdb9fU,
+        0x7bf7c102U, 0xdd80cab6U, 0x1827f438U, 0xbe50ff8cU, 0x8fb8e511U, 0x29cfeea5U,
+        0xdf879e4cU, 0x79f095f8U, 0x48188f65U, 0xee6f84d1U, 0x2bc8ba5fU, 0x8dbfb1ebU,
+        0xbc57ab76U, 0x1a20a0c2U, 0x8816eaf2U, 0x2e61e146U, 0x1f89fbdbU, 0xb9fef06fU,
+        0x7c59cee1U, 0xda2ec555U, 0xebc6dfc8U, 0x4db1d47cU, 0xbbf9a495U, 0x1d8eaf21U,
+        0x2c66b5bcU, 0x8a11be08U, 0x4fb68086U, 0xe9c18b32U, 0xd82991afU, 0x7e5e9a1bU,
+        0xefc8763cU, 0x49bf7d88U, 0x78576715U, 0xde206ca1U, 0x1b87522fU, 0xbdf0599bU,
+        0x8c184306U, 0x2a6f48b2U, 0xdc27385bU, 0x7a5033efU, 0x4bb82972U, 0xedcf22c6U,
+        0x28681c48U, 0x8e1f17fcU, 0xbff70d61U, 0x198006d5U, 0x47abd36eU, 0xe1dcd8daU,
+        0xd034c247U, 0x7643c9f3U, 0xb3e4f77dU, 0x1593fcc9U, 0x247be654U, 0x820cede0U,
+        0x74449d09U, 0xd23396bdU, 0xe3db8c20U, 0x45ac8794U, 0x800bb91aU, 0x267cb2aeU,
+        0x1794a833U, 0xb1e3a387U, 0x20754fa0U, 0x86024414U, 0xb7ea5e89U, 0x119d553dU,
+        0xd43a6bb3U, 0x724d6007U, 0x43a57a9aU, 0xe5d2712eU, 0x139a01c7U, 0xb5ed0a73U,
+        0x840510eeU, 0x22721b5aU, 0xe7d525d4U, 0x41a22e60U, 0x704a34fdU, 0xd63d3f49U,
+        0xcc1d9f8bU, 0x6a6a943fU, 0x5b828ea2U, 0xfdf58516U, 0x3852bb98U, 0x9e25b02cU,
+        0xafcdaab1U, 0x09baa105U, 0xfff2d1ecU, 0x5985da58U, 0x686dc0c5U, 0xce1acb71U,
+        0x0bbdf5ffU, 0xadcafe4bU, 0x9c22e4d6U, 0x3a55ef62U, 0xabc30345U, 0x0db408f1U,
+        0x3c5c126cU, 0x9a2b19d8U, 0x5f8c2756U, 0xf9fb2ce2U, 0xc813367fU, 0x6e643dcbU,
+        0x982c4d22U, 0x3e5b4696U, 0x0fb35c0bU, 0xa9c457bfU, 0x6c636931U, 0xca146285U,
+        0xfbfc7818U, 0x5d8b73acU, 0x03a0a617U, 0xa5d7ada3U, 0x943fb73eU, 0x3248bc8aU,
+        0xf7ef8204U, 0x519889b0U, 0x6070932dU, 0xc6079899U, 0x304fe870U, 0x9638e3c4U,
+        0xa7d0f959U, 0x01a7f2edU, 0xc400cc63U, 0x6277c7d7U, 0x539fdd4aU, 0xf5e8d6feU,
+        0x647e3ad9U, 0xc209316dU, 0xf3e12bf0U, 0x55962044U, 0x90311ecaU, 0x3646157eU,
+        0x07ae0fe3U, 0xa1d90457U, 0x579174beU, 0xf1e67f0aU, 0xc00e6597U, 0x66796e23U,
+        0xa3de50adU, 0x05a95b19U, 0x34414184U, 0x92364a30U, 0x00000000U, 0xccaa009eU,
+        0x4225077dU, 0x8e8f07e3U, 0x844a0efaU, 0x48e00e64U, 0xc66f0987U, 0x0ac50919U,
+        0xd3e51bb5U, 0x1f4f1b2bU, 0x91c01cc8U, 0x5d6a1c56U, 0x57af154fU, 0x9b0515d1U,
+        0x158a1232U, 0xd92012acU, 0x7cbb312bU, 0xb01131b5U, 0x3e9e3656U, 0xf23436c8U,
+        0xf8f13fd1U, 0x345b3f4fU, 0xbad438acU, 0x767e3832U, 0xaf5e2a9eU, 0x63f42a00U,
+        0xed7b2de3U, 0x21d12d7dU, 0x2b142464U, 0xe7be24faU, 0x69312319U, 0xa59b2387U,
+        0xf9766256U, 0x35dc62c8U, 0xbb53652bU, 0x77f965b5U, 0x7d3c6cacU, 0xb1966c32U,
+        0x3f196bd1U, 0xf3b36b4fU, 0x2a9379e3U, 0xe639797dU, 0x68b67e9eU, 0xa41c7e00U,
+        0xaed97719U, 0x62737787U, 0xecfc7064U, 0x205670faU, 0x85cd537dU, 0x496753e3U,
+        0xc7e85400U, 0x0b42549eU, 0x01875d87U, 0xcd2d5d19U, 0x43a25afaU, 0x8f085a64U,
+        0x562848c8U, 0x9a824856U, 0x140d4fb5U, 0xd8a74f2bU, 0xd2624632U, 0x1ec846acU,
+        0x9047414fU, 0x5ced41d1U, 0x299dc2edU, 0xe537c273U, 0x6bb8c590U, 0xa712c50eU,
+        0xadd7cc17U, 0x617dcc89U, 0xeff2cb6aU, 0x2358cbf4U, 0xfa78d958U, 0x36d2d9c6U,
+        0xb85dde25U, 0x74f7debbU, 0x7e32d7a2U, 0xb298d73cU, 0x3c17d0dfU, 0xf0bdd041U,
+        0x5526f3c6U, 0x998cf358U, 0x1703f4bbU, 0xdba9f425U, 0xd16cfd3cU, 0x1dc6fda2U,
+        0x9349fa41U, 0x5fe3fadfU, 0x86c3e873U, 0x4a69e8edU, 0xc4e6ef0eU, 0x084cef90U,
+        0x0289e689U, 0xce23e617U, 0x40ace1f4U, 0x8c06e16aU, 0xd0eba0bbU, 0x1c41a025U,
+        0x92cea7c6U, 0x5e64a758U, 0x54a1ae41U, 0x980baedfU, 0x1684a93cU, 0xda2ea9a2U,
+        0x030ebb0eU, 0xcfa4bb90U, 0x412bbc73U, 0x8d81bcedU, 0x8744b5f4U, 0x4beeb56aU,
+        0xc561b289U, 0x09cbb217U, 0xac509190U, 0x60fa910eU, 0xee7596edU, 0x22df9673U,
+        0x281a9f6aU, 0xe4b09ff4U, 0x6a3f9817U, 0xa6959889U, 0x7fb58a25U, 0xb31f8abbU,
+        0x3d908d58U, 0xf13a8dc6U, 0xfbff84dfU, 0x37558441U, 0xb9da83a2U, 0x7570833cU,
+        0x533b85daU, 0x9f918544U, 0x111e82a7U, 0xddb48239U, 0xd7718b20U, 0x1bdb8bbeU,
+        0x95548c5dU, 0x59fe8cc3U, 0x80de9e6fU, 0x4c749ef1U, 0xc2fb9912U, 0x0e51998cU,
+        0x04949095U, 0xc83e900bU, 0x46b197e8U, 0x8a1b9776U, 0x2f80b4f1U, 0xe32ab46fU,
+        0x6da5b38cU, 0xa10fb312U, 0xabcaba0bU, 0x6760ba95U, 0xe9efbd76U, 0x2545bde8U,
+        0xfc65af44U, 0x30cfafdaU, 0xbe40a839U, 0x72eaa8a7U, 0x782fa1beU, 0xb485a120U,
+        0x3a0aa6c3U, 0xf6a0a65dU, 0xaa4de78cU, 0x66e7e712U, 0xe868e0f1U, 0x24c2e06fU,
+        0x2e07e976U, 0xe2ade9e8U, 0x6c22ee0bU, 0xa088ee95U, 0x79a8fc39U, 0xb502fca7U,
+        0x3b8dfb44U, 0xf727fbdaU, 0xfde2f2c3U, 0x3148f25dU, 0xbfc7f5beU, 0x736df520U,
+        0xd6f6d6a7U, 0x1a5cd639U, 0x94d3d1daU, 0x5879d144U, 0x52bcd85dU, 0x9e16d8c3U,
+        0x1099df20U, 0xdc33dfbeU, 0x0513cd12U, 0xc9b9cd8cU, 0x4736ca6fU, 0x8b9ccaf1U,
+        0x8159c3e8U, 0x4df3c376U, 0xc37cc495U, 0x0fd6c40bU, 0x7aa64737U, 0xb60c47a9U,
+        0x3883404aU, 0xf42940d4U, 0xfeec49cdU, 0x32464953U, 0xbcc94eb0U, 0x70634e2eU,
+        0xa9435c82U, 0x65e95c1cU, 0xeb665bffU, 0x27cc5b61U, 0x2d095278U, 0xe1a352e6U,
+        0x6f2c5505U, 0xa386559bU, 0x061d761cU, 0xcab77682U, 0x44387161U, 0x889271ffU,
+        0x825778e6U, 0x4efd7878U, 0xc0727f9bU, 0x0cd87f05U, 0xd5f86da9U, 0x19526d37U,
+        0x97dd6ad4U, 0x5b776a4aU, 0x51b26353U, 0x9d1863cdU, 0x1397642eU, 0xdf3d64b0U,
+        0x83d02561U, 0x4f7a25ffU, 0xc1f5221cU, 0x0d5f2282U, 0x079a2b9bU, 0xcb302b05U,
+        0x45bf2ce6U, 0x89152c78U, 0x50353ed4U, 0x9c9f3e4aU, 0x121039a9U, 0xdeba3937U,
+        0xd47f302eU, 0x18d530b0U, 0x965a3753U, 0x5af037cdU, 0xff6b144aU, 0x33c114d4U,
+        0xbd4e1337U, 0x71e413a9U, 0x7b211ab0U, 0xb78b1a2eU, 0x39041dcdU, 0xf5ae1d53U,
+        0x2c8e0fffU, 0xe0240f61U, 0x6eab0882U, 0xa201081cU, 0xa8c40105U, 0x646e019bU,
+        0xeae10678U, 0x264b06e6U
+    };
+    return table;
+}
+
+/* Table-driven update of the (inverted) CRC register, 8 bytes per step */
+static inline uint32_t lr__crc_slice8(uint32_t crc, const unsigned char* p, size_t n, const uint32_t* t) {
+    for (; n >= 8; p += 8, n -= 8) {
+        uint64_t v = lr__load64(p) ^ crc;
+        crc = t[1792 + (v & 0xFF)] ^ t[1536 + ((v >> 8) & 0xFF)] ^
+              t[1280 + ((v >> 16) & 0xFF)] ^ t[1024 + ((v >> 24) & 0xFF)] ^
+              t[768 + ((v >> 32) & 0xFF)] ^ t[512 + ((v >> 40) & 0xFF)] ^
+              t[256 + ((v >> 48) & 0xFF)] ^ t[v >> 56];
+    }
+    for (; n; p++, n--) {
+        crc = t[(crc ^ *p) & 0xFF] ^ (crc >> 8);
+    }
+    return crc;
+}
+
+#ifdef __SSE4_2__
+static inline uint32_t lr__crc32c_u64(uint32_t crc, uint64_t v) {
+    uint64_t c = crc;
+    __asm__ ("crc32q %1, %0" : "+r" (c) : "rm" (v));
+    return (uint32_t)c;
+}
+
+static inline uint32_t lr__crc32c_u8(uint32_t crc, unsigned char v) {
+    __asm__ ("crc32b %1, %0" : "+r" (crc) : "rm" (v));
+    return crc;
+}
+
+#if defined(LR_SIMD) && defined(__PCLMUL__)
+/* Low 64 bits of the carry-less product */
+static inline uint64_t lr__clmul64(uint64_t a, uint64_t b) {
+    lr__v16 x, y;
+    uint64_t r;
+    #ifdef __AVX__
+    __asm__ ("vmovq %3, %0\n\t"
+             "vmovq %4, %1\n\t"
+             "vpclmulqdq $0x00, %1, %0, %0\n\t"
+             "vmovq %0, %2"
+             : "=&x" (x), "=&x" (y), "=r" (r) : "r" (a), "r" (b));
+    #else
+    __asm__ ("movq %3, %0\n\t"
+             "movq %4, %1\n\t"
+             "pclmulqdq $0x00, %1, %0\n\t"
+             "movq %0, %2"
+             : "=&x" (x), "=&x" (y), "=r" (r) : "r" (a), "r" (b));
+    #endif
+    return r;
+}
+
+/* CRC of 3 * len bytes as three independent crc32q chains. The first two
+ * registers are shifted past the bytes that follow them by multiplying
+ * with k = x^(8 * distance - 33): the product comes out multiplied by x,
+ * and crc32q of it multiplies by x^32 and reduces. */
+static inline uint32_t lr__crc32c_3way(uint32_t crc, const unsigned char* p, size_t len, uint64_t k2, uint64_t k1) {
+    uint32_t c1 = 0, c2 = 0;
+    size_t i;
+    
+    for (i = 0; i < len; i += 8) {
+        crc = lr__crc32c_u64(crc, lr__load64(p + i));
+        c1 = lr__crc32c_u64(c1, lr__load64(p + len + i));
+        c2 = lr__crc32c_u64(c2, lr__load64(p + 2 * len + i));
+    }
+    return c2 ^ lr__crc32c_u64(0, lr__clmul64(crc, k2) ^ lr__clmul64(c1, k1));
+}
+#endif
+
+static inline uint32_t lr__crc32c_hw(uint32_t crc, const unsigned char* p, size_t n) {
+    #if defined(LR_SIMD) && defined(__PCLMUL__)
+    /* crc32q has a 3-cycle latency but issues every cycle: per stream
+     * length, x^(16 * len - 33) and x^(8 * len - 33) */
+    static const uint64_t tiers[3][3] = {
+        { 4096, 0x54a86326U, 0x82f89c77U },
+        { 512, 0x170076faU, 0xdd7e3b0cU },
+        { 64, 0x0d3b6092U, 0x9e4addf8U }
+    };
+    int t;
+    
+    for (t = 0; t < 3; t++) {
+        size_t len = (size_t)tiers[t][0];
+        for (; n >= 3 * len; p += 3 * len, n -= 3 * len) {
+            crc = lr__crc32c_3way(crc, p, len, tiers[t][1], tiers[t][2]);
+        }
+    }
+    #endif
+    for (; n >= 8; p += 8, n -= 8) {
+        crc = lr__crc32c_u64(crc, lr__load64(p));
+    }
+    for (; n; p++, n--) {
+        crc = lr__crc32c_u8(crc, *p);
+    }
+    return crc;
+}
+#endif
+
+#if defined(LR_SIMD) && defined(__PCLMUL__)
+/* IEEE CRC register over n >= 64 bytes: four 128-bit lanes are folded
+ * forward 64 bytes at a time, then into one lane. The folded lane is
+ * congruent to everything consumed, so its CRC from a zero register,
+ * continued over the tail, is the result. */
+static inline uint32_t lr__crc32_pclmul(uint32_t crc, const unsigned char* p, size_t n) {
+    static const uint64_t fold4[2] = { 0x154442bd4ULL, 0x1c6e41596ULL };
+    static const uint64_t fold1[2] = { 0x1751997d0ULL, 0x0ccaa009eULL };
+    const uint32_t* t = lr__crc32_table();
+    uint32_t init[4] = { 0, 0, 0, 0 };
+    unsigned char lane[16];
+    lr__v16 k = lr__v16_load(fold4), x0, x1, x2, x3;
+    
+    init[0] = crc;
+    x0 = lr__v16_load(p) ^ lr__v16_load(init);
+    x1 = lr__v16_load(p + 16);
+    x2 = lr__v16_load(p + 32);
+    x3 = lr__v16_load(p + 48);
+    for (p += 64, n -= 64; n >= 64; p += 64, n -= 64) {
+        x0 = lr__v16_clmul_lo(x0, k) ^ lr__v16_clmul_hi(x0, k) ^ lr__v16_load(p);
+        x1 = lr__v16_clmul_lo(x1, k) ^ lr__v16_clmul_hi(x1, k) ^ lr__v16_load(p + 16);
+        x2 = lr__v16_clmul_lo(x2, k) ^ lr__v16_clmul_hi(x2, k) ^ lr__v16_load(p + 32);
+        x3 = lr__v16_clmul_lo(x3, k) ^ lr__v16_clmul_hi(x3, k) ^ lr__v16_load(p + 48);
+    }
+    
+    k = lr__v16_load(fold1);
+    x0 = lr__v16_clmul_lo(x0, k) ^ lr__v16_clmul_hi(x0, k) ^ x1;
+    x0 = lr__v16_clmul_lo(x0, k) ^ lr__v16_clmul_hi(x0, k) ^ x2;
+    x0 = lr__v16_clmul_lo(x0, k) ^ lr__v16_clmul_hi(x0, k) ^ x3;
+    for (; n >= 16; p += 16, n -= 16) {
+        x0 = lr__v16_clmul_lo(x0, k) ^ lr__v16_clmul_hi(x0, k) ^ lr__v16_load(p);
+    }
+    
+    lr__v16_store(lane, x0);
+    return lr__crc_slice8(lr__crc_slice8(0, lane, 16, t), p, n, t);
+}
+#endif
+
+/* CRC-32C (Castagnoli; iSCSI, ext4, SCTP). seed is a previous result to
+ * continue from, or 0. */
+static inline uint32_t crc32c(const void* buf, size_t n, uint32_t seed) {
+    const unsigned char* p = (const unsigned char*)buf;
+    #ifdef __SSE4_2__
+    return ~lr__crc32c_hw(~seed, p, n);
+    #else
+    return ~lr__crc_slice8(~seed, p, n, lr__crc32c_table());
+    #endif
+}
+
+/* IEEE 802.3 CRC-32 (zlib, PNG, gzip), with crc32c's seed convention */
+static inline uint32_t crc32(const void* buf, size_t n, uint32_t seed) {
+    const unsigned char* p = (const unsigned char*)buf;
+    #if defined(LR_SIMD) && defined(__PCLMUL__)
+    if (n >= 64) {
+        return ~lr__crc32_pclmul(~seed, p, n);
+    }
+    #endif
+    return ~lr__crc_slice8(~seed, p, n, lr__crc32_table());
+}
+
+/* Adler-32 (zlib): s1 = 1 + the byte sum, s2 = the sum of the s1 values,
+ * both mod 65521. NMAX bytes is the most zlib adds before s2 could pass
+ * 2^32, which also bounds the 32-bit vector lanes below. */
+#define LR__ADLER_MOD  65521
+#define LR__ADLER_NMAX 5552
+
+/* seed is 1 to start (adler32(0, NULL, 0) returns it, as in zlib) or a
+ * previous result */
+static inline uint32_t adler32(uint32_t seed, const void* buf, size_t n) {
+    const unsigned char* p = (const unsigned char*)buf;
+    uint64_t s1 = seed & 0xFFFF, s2 = seed >> 16;
+    
+    if (!p) {
+        return 1;
+    }
+    while (n) {
+        size_t k = n < LR__ADLER_NMAX ? n : LR__ADLER_NMAX, i = 0;
+        n -= k;
+        
+        /* Per vector block: psadbw sums the bytes into s1; the bytes times
+         * descending taps go to s2, as does the block width times the s1
+         * the block started with (summed in vp, scaled at the end) */
+        #if defined(LR_SIMD) && defined(__AVX2__)
+        if (k >= 32) {
+            const lr__v32 zero = lr__v32_set1(0), ones = lr__v32_set1_32(0x00010001);
+            const lr__v32 taps = { 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1 };
+            lr__v32 v1 = zero, v2 = zero, vp = zero;
+            uint32_t t1[8], t2[8], tp[8];
+            int j;
+            
+            for (; i + 32 <= k; i += 32) {
+                lr__v32 d = lr__v32_load(p + i);
+                vp = lr__v32_add32(vp, v1);
+                v1 = lr__v32_add32(v1, lr__v32_sad_u8(d, zero));
+                v2 = lr__v32_add32(v2, lr__v32_madd16(lr__v32_maddubs(d, taps), ones));
+            }
+            lr__v32_store(t1, v1);
+            lr__v32_store(t2, v2);
+            lr__v32_store(tp, vp);
+            s2 += s1 * i;
+            for (j = 0; j < 8; j++) {
+                s1 += t1[j];
+                s2 += 32 * (uint64_t)tp[j] + t2[j];
+            }
+        }
+        #endif
+        #ifdef LR_SIMD
+        if (k - i >= 16) {
+            const lr__v16 zero = lr__v16_set1(0);
+            #ifdef __SSSE3__
+            const lr__v16 ones = lr__v16_set1_32(0x00010001);
+            const lr__v16 taps = { 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1 };
+            #else
+            const lr__v16 taps_lo = { 16, 0, 15, 0, 14, 0, 13, 0, 12, 0, 11, 0, 10, 0, 9, 0 };
+            const lr__v16 taps_hi = { 8, 0, 7, 0, 6, 0, 5, 0, 4, 0, 3, 0, 2, 0, 1, 0 };
+            #endif
+            lr__v16 v1 = zero, v2 = zero, vp = zero;
+            uint32_t t1[4], t2[4], tp[4];
+            size_t start = i;
+            int j;
+            
+            for (; i + 16 <= k; i += 16) {
+                lr__v16 d = lr__v16_load(p + i);
+                vp = lr__v16_add32(vp, v1);
+                v1 = lr__v16_add32(v1, lr__v16_sad_u8(d, zero));
+                #ifdef __SSSE3__
+                v2 = lr__v16_add32(v2, lr__v16_madd16(lr__v16_maddubs(d, taps), ones));
+                #else
+                v2 = lr__v16_add32(v2, lr__v16_madd16(lr__v16_unpacklo(d, zero), taps_lo));
+                v2 = lr__v16_add32(v2, lr__v16_madd16(lr__v16_unpackhi(d, zero), taps_hi));
+                #endif
+            }
+            lr__v16_store(t1, v1);
+            lr__v16_store(t2, v2);
+            lr__v16_store(tp, vp);
+            s2 += s1 * (i - start);
+            for (j = 0; j < 4; j++) {
+                s1 += t1[j];
+                s2 += 16 * (uint64_t)tp[j] + t2[j];
+            }
+        }
+        #endif
+        
+        for (; i < k; i++) {
+            s1 += p[i];
+            s2 += s1;
+        }
+        p += k;
+        s1 %= LR__ADLER_MOD;
+        s2 %= LR__ADLER_MOD;
+    }
+    return (uint32_t)(s2 << 16 | s1);
+}
+
+/* Adler-32 of A followed by B from adler32 of each and B's length */
+static inline uint32_t adler32_combine(uint32_t adler1, uint32_t adler2, size_t len2) {
+    uint64_t rem = len2 % LR__ADLER_MOD, a1 = adler1 & 0xFFFF;
+    uint64_t s1 = (a1 + (adler2 & 0xFFFF) + LR__ADLER_MOD - 1) % LR__ADLER_MOD;
+    uint64_t s2 = (rem * a1 + (adler1 >> 16) + (adler2 >> 16) + LR__ADLER_MOD - rem) % LR__ADLER_MOD;
+    return (uint32_t)(s2 << 16 | s1);
+}
+
+/* Fletcher sums over little-endian words: a = the word sum, b = the sum
+ * of the a values. Vector lanes each keep a and b for one word position;
+ * a block of m words then adds sum(m * b_l - l * a_l) to b. */
+
+/* Fletcher-32: 16-bit words, sums mod 65535, an odd last byte padded with
+ * zero. seed is 0 to start or a previous result over an even length. */
+static inline uint32_t fletcher32(uint32_t seed, const void* buf, size_t n) {
+    const unsigned char* p = (const unsigned char*)buf;
+    uint64_t a = seed & 0xFFFF, b = seed >> 16;
+    
+    while (n >= 2) {
+        /* 360 blocks of 8 words keep each lane's b under 2^32 */
+        size_t k = n < 5760 ? n & ~(size_t)1 : 5760, i = 0;
+        n -= k;
+        
+        #ifdef LR_SIMD
+        if (k >= 16) {
+            const lr__v16 zero = lr__v16_set1(0);
+            lr__v16 a0 = zero, a1 = zero, b0 = zero, b1 = zero;
+            uint32_t ta0[4], ta1[4], tb0[4], tb1[4];
+            int j;
+            
+            for (; i + 16 <= k; i += 16) {
+                lr__v16 d = lr__v16_load(p + i);
+                a0 = lr__v16_add32(a0, lr__v16_unpacklo16(d, zero));
+                a1 = lr__v16_add32(a1, lr__v16_unpackhi16(d, zero));
+                b0 = lr__v16_add32(b0, a0);
+                b1 = lr__v16_add32(b1, a1);
+            }
+            /* One array per vector: wider reloads would stall store forwarding */
+            lr__v16_store(ta0, a0);
+            lr__v16_store(ta1, a1);
+            lr__v16_store(tb0, b0);
+            lr__v16_store(tb1, b1);
+            b += a * (i / 2);
+            for (j = 0; j < 4; j++) {
+                a += (uint64_t)ta0[j] + ta1[j];
+                b += 8 * ((uint64_t)tb0[j] + tb1[j]) - (uint64_t)j * ta0[j] - (uint64_t)(j + 4) * ta1[j];
+            }
+        }
+        #endif
+        
+        for (; i < k; i += 2) {
+            a += (uint64_t)p[i] | (uint64_t)p[i + 1] << 8;
+            b += a;
+        }
+        p += k;
+        a %= 65535;
+        b %= 65535;
+    }
+    if (n) {
+        a = (a + p[0]) % 65535;
+        b = (b + a) % 65535;
+    }
+    return (uint32_t)(b << 16 | a);
+}
+
+/* Fletcher-64: 32-bit words, sums mod 2^32 - 1, a partial last word
+ * padded with zeros. seed is 0 or a previous result over a multiple of 4. */
+static inline uint64_t fletcher64(uint64_t seed, const void* buf, size_t n) {
+    const uint64_t mod = 0xFFFFFFFFULL;
+    const unsigned char* p = (const unsigned char*)buf;
+    uint64_t a = seed & mod, b = seed >> 32;
+    
+    while (n >= 4) {
+        /* 64K words keep both the scalar b and each lane's b under 2^64 */
+        size_t k = n < 262144 ? n & ~(size_t)3 : 262144, i = 0;
+        n -= k;
+        
+        #ifdef LR_SIMD
+        if (k >= 16) {
+            const lr__v16 zero = lr__v16_set1(0);
+            lr__v16 a0 = zero, a1 = zero, b0 = zero, b1 = zero;
+            uint64_t ta[2][2], tb[2][2];
+            int j;
+            
+            for (; i + 16 <= k; i += 16) {
+                lr__v16 d = lr__v16_load(p + i);
+                a0 = lr__v16_add64(a0, lr__v16_unpacklo32(d, zero));
+                a1 = lr__v16_add64(a1, lr__v16_unpackhi32(d, zero));
+                b0 = lr__v16_add64(b0, a0);
+                b1 = lr__v16_add64(b1, a1);
+            }
+            lr__v16_store(ta[0], a0);
+            lr__v16_store(ta[1], a1);
+            lr__v16_store(tb[0], b0);
+            lr__v16_store(tb[1], b1);
+            b += a * (i / 4);
+            for (j = 0; j < 4; j++) {
+                uint64_t aj = ta[j >> 1][j & 1] % mod;
+                a += aj;
+                b += 4 * (tb[j >> 1][j & 1] % mod) + 3 * mod - (uint64_t)j * aj;
+            }
+        }
+        #endif
+        
+        for (; i < k; i += 4) {
+            a += lr__load32(p + i);
+            b += a;
+        }
+        p += k;
+        a %= mod;
+        b %= mod;
+    }
+    if (n) {
+        uint64_t w = 0;
+        while (n--) {
+            w = w << 8 | p[n];
+        }
+        a = (a + w) % mod;
+        b = (b + a) % mod;
+    }
+    return b << 32 | a;
+}
+
+/* Fletcher checksum of A followed by B from those of each and B's length
+ * (A's length a multiple of the word size) */
+static inline uint32_t fletcher32_combine(uint32_t f1, uint32_t f2, size_t len2) {
+    uint64_t words = ((uint64_t)len2 + 1) / 2 % 65535, a1 = f1 & 0xFFFF;
+    uint64_t a = (a1 + (f2 & 0xFFFF)) % 65535;
+    uint64_t b = ((f1 >> 16) + (f2 >> 16) + words * a1) % 65535;
+    return (uint32_t)(b << 16 | a);
+}
+
+static inline uint64_t fletcher64_combine(uint64_t f1, uint64_t f2, size_t len2) {
+    const uint64_t mod = 0xFFFFFFFFULL;
+    uint64_t words = ((uint64_t)len2 + 3) / 4 % mod, a1 = f1 & mod;
+    uint64_t a = (a1 + (f2 & mod)) % mod;
+    uint64_t b = ((f1 >> 32) + (f2 >> 32) + words * a1 % mod) % mod;
+    return b << 32 | a;
+}
+
+/* Hashing (non-cryptographic) */
+
+/* Odd constants with balanced bits, as in wyhash */
+#define LR__HASH0 0xa0761d6478bd642fULL
+#define LR__HASH1 0xe7037ed1a0b428dbULL
+#define LR__HASH2 0x8ebc6af09c88c6e3ULL
+#define LR__HASH3 0x589965cc75374cc3ULL
+
+/* 64x64 -> 128-bit product folded to 64 bits */
+static inline uint64_t lr__hash_mix(uint64_t a, uint64_t b) {
+    uint64_t hi, lo = lr__mul128(a, b, &hi);
+    return lo ^ hi;
+}
+
+static inline uint64_t lr__hash_step(uint64_t lane, const unsigned char* p, uint64_t k) {
+    return lr__hash_mix(lr__load64(p) ^ k, lr__load64(p + 8) ^ lane);
+}
+
+/* Input of n > 16 bytes folded to two words: four independent lanes over
+ * the (n - 1) / 64 whole 64-byte blocks, then 16-byte steps over the last
+ * 1..64 bytes with the final step re-read so that it ends at the buffer
+ * end. Split in two so strhash can feed blocks before it knows n. */
+static inline void lr__memhash_blocks(uint64_t l[4], const unsigned char* p, size_t blocks) {
+    uint64_t l0 = l[0], l1 = l[1], l2 = l[2], l3 = l[3];
+    
+    for (; blocks; blocks--, p += 64) {
+        l0 = lr__hash_step(l0, p, LR__HASH1);
+        l1 = lr__hash_step(l1, p + 16, LR__HASH2);
+        l2 = lr__hash_step(l2, p + 32, LR__HASH3);
+        l3 = lr__hash_step(l3, p + 48, LR__HASH0);
+    }
+    l[0] = l0, l[1] = l1, l[2] = l2, l[3] = l3;
+}
+
+static inline void lr__memhash_tail(uint64_t l[4], const unsigned char* p, const unsigned char* end, uint64_t* a, uint64_t* b) {
+    if (end - p > 16) {
+        l[0] = lr__hash_step(l[0], p, LR__HASH1);
+    }
+    if (end - p > 32) {
+        l[1] = lr__hash_step(l[1], p + 16, LR__HASH2);
+    }
+    if (end - p > 48) {
+        l[2] = lr__hash_step(l[2], p + 32, LR__HASH3);
+    }
+    l[3] = lr__hash_step(l[3], end - 16, LR__HASH0);
+    *a = l[0] ^ l[2];
+    *b = l[1] ^ l[3];
+}
+
+#if defined(LR_SIMD) && defined(__AES__) && !defined(LR_MEMHASH_PORTABLE)
+/* Inputs over 512 bytes: four AES-round lanes over the whole 64-byte
+ * blocks and then the last 64 bytes re-read to end at the buffer end.
+ * One round alone leaves byte differences that can cancel between lanes,
+ * so each lane also keeps an additive sum of its blocks (st[4..7]) and
+ * gets two more rounds before the lanes are merged */
+static inline void lr__memhash_aes_init(lr__v16 st[8], uint64_t seed) {
+    const uint64_t init[5] = {
+        seed ^ LR__HASH0, seed ^ LR__HASH1, seed ^ LR__HASH2, seed ^ LR__HASH3, seed ^ LR__HASH0
+    };
+    int i;
+    
+    for (i = 0; i < 4; i++) {
+        st[i] = lr__v16_load(init + i);
+        st[7 - i] = st[i];
+    }
+}
+
+static inline void lr__memhash_aes_blocks(lr__v16 st[8], const unsigned char* p, size_t blocks) {
+    lr__v16 x0 = st[0], x1 = st[1], x2 = st[2], x3 = st[3];
+    lr__v16 s0 = st[4], s1 = st[5], s2 = st[6], s3 = st[7];
+    lr__v16 d0, d1, d2, d3;
+    
+    for (; blocks; blocks--, p += 64) {
+        d0 = lr__v16_load(p);
+        d1 = lr__v16_load(p + 16);
+        d2 = lr__v16_load(p + 32);
+        d3 = lr__v16_load(p + 48);
+        x0 = lr__v16_aesenc(x0, d0);
+        x1 = lr__v16_aesenc(x1, d1);
+        x2 = lr__v16_aesenc(x2, d2);
+        x3 = lr__v16_aesenc(x3, d3);
+        s0 = lr__v16_add64(s0, d0);
+        s1 = lr__v16_add64(s1, d1);
+        s2 = lr__v16_add64(s2, d2);
+        s3 = lr__v16_add64(s3, d3);
+    }
+    st[0] = x0, st[1] = x1, st[2] = x2, st[3] = x3;
+    st[4] = s0, st[5] = s1, st[6] = s2, st[7] = s3;
+}
+
+static inline void lr__memhash_aes_final(lr__v16 st[8], const unsigned char* end, size_t n, uint64_t seed, uint64_t out[2]) {
+    const uint64_t key[2] = { (uint64_t)n ^ LR__HASH1, seed };
+    lr__v16 k = lr__v16_load(key);
+    lr__v16 x0, x1, x2, x3;
+    
+    lr__memhash_aes_blocks(st, end - 64, 1);
+    x0 = lr__v16_aesenc(lr__v16_aesenc(st[0], st[4]), k);
+    x1 = lr__v16_aesenc(lr__v16_aesenc(st[1], st[5]), k);
+    x2 = lr__v16_aesenc(lr__v16_aesenc(st[2], st[6]), k);
+    x3 = lr__v16_aesenc(lr__v16_aesenc(st[3], st[7]), k);
+    x0 = lr__v16_aesenc(lr__v16_aesenc(x0, x1), lr__v16_aesenc(x2, x3));
+    x0 = lr__v16_aesenc(lr__v16_aesenc(x0, k), k);
+    lr__v16_store(out, x0);
+}
+#define LR__MEMHASH_AES 1
+#endif
+
+/* Final mix of the two folded words */
+static inline void lr__memhash_final(uint64_t a, uint64_t b, size_t n, uint64_t out[2], int wide) {
+    uint64_t hi, lo = lr__mul128(a, b, &hi);
+    out[0] = lr__hash_mix(lo ^ LR__HASH0 ^ n, hi ^ LR__HASH1);
+    if (wide) {
+        out[1] = lr__hash_mix(lo ^ LR__HASH2, hi ^ LR__HASH3 ^ n);
+    }
+}
+
+static inline void lr__memhash(const void* buf, size_t n, uint64_t seed, uint64_t out[2], int wide) {
+    const unsigned char* p = (const unsigned char*)buf;
+    uint64_t a, b;
+    
+    seed ^= lr__hash_mix(seed ^ LR__HASH0, LR__HASH1);
+    if (n <= 16) {
+        /* Overlapping 4-byte loads cover 4..16 bytes; 1..3 bytes use the
+         * first, middle and last */
+        if (n >= 4) {
+            size_t m = (n >> 3) << 2;
+            a = (uint64_t)lr__load32(p) << 32 | lr__load32(p + m);
+            b = (uint64_t)lr__load32(p + n - 4) << 32 | lr__load32(p + n - 4 - m);
+        } else if (n) {
+            a = (uint64_t)p[0] << 16 | (uint64_t)p[n >> 1] << 8 | p[n - 1];
+            b = 0;
+        } else {
+            a = b = 0;
+        }
+        a ^= LR__HASH1;
+        b ^= seed;
+    } else {
+        #ifdef LR__MEMHASH_AES
+        if (n > 512) {
+            lr__v16 st[8];
+            lr__memhash_aes_init(st, seed);
+            lr__memhash_aes_blocks(st, p, (n - 1) / 64);
+            lr__memhash_aes_final(st, p + n, n, seed, out);
+            return;
+        }
+        #endif
+        uint64_t l[4] = { seed, seed, seed, seed };
+        size_t blocks = (n - 1) / 64;
+        lr__memhash_blocks(l, p, blocks);
+        lr__memhash_tail(l, p + blocks * 64, p + n, &a, &b);
+    }
+    lr__memhash_final(a, b, n, out, wide);
+}
+
+/* 64-bit hash of n bytes for hash tables, dedupe and sharding; not
+ * cryptographic. Inputs over 512 bytes hash differently with AES-NI than
+ * without: define LR_MEMHASH_PORTABLE where values must match across
+ * builds (the portable path is used everywhere then). */
+static inline uint64_t memhash64(const void* buf, size_t n, uint64_t seed) {
+    uint64_t out[2];
+    lr__memhash(buf, n, seed, out, 0);
+    return out[0];
+}
+
+/* 128-bit variant for when 64-bit collisions matter (content dedupe) */
+static inline void memhash128(const void* buf, size_t n, uint64_t seed, uint64_t out[2]) {
+    lr__memhash(buf, n, seed, out, 1);
+}
+
+#ifdef LR_SIMD
+/* Bit i set where p[i] is NUL, for the 64 bytes at p; the vectors are
+ * folded by unsigned minimum so a block without NUL costs one test */
+static inline uint64_t lr__nul_mask64(const unsigned char* p) {
+    #ifdef __AVX2__
+    const lr__v32 zero = lr__v32_set1(0);
+    lr__v32 v0 = lr__v32_load(p), v1 = lr__v32_load(p + 32);
+    if (!lr__v32_movemask(lr__v32_cmpeq(lr__v32_min_u8(v0, v1), zero))) {
+        return 0;
+    }
+    return lr__v32_movemask(lr__v32_cmpeq(v0, zero))
+         | (uint64_t)lr__v32_movemask(lr__v32_cmpeq(v1, zero)) << 32;
+    #else
+    const lr__v16 zero = lr__v16_set1(0);
+    lr__v16 v0 = lr__v16_load(p), v1 = lr__v16_load(p + 16);
+    lr__v16 v2 = lr__v16_load(p + 32), v3 = lr__v16_load(p + 48);
+    lr__v16 v = lr__v16_min_u8(lr__v16_min_u8(v0, v1), lr__v16_min_u8(v2, v3));
+    if (!lr__v16_movemask(lr__v16_cmpeq(v, zero))) {
+        return 0;
+    }
+    return lr__v16_movemask(lr__v16_cmpeq(v0, zero))
+         | (uint64_t)lr__v16_movemask(lr__v16_cmpeq(v1, zero)) << 16
+         | (uint64_t)lr__v16_movemask(lr__v16_cmpeq(v2, zero)) << 32
+         | (uint64_t)lr__v16_movemask(lr__v16_cmpeq(v3, zero)) << 48;
+    #endif
+}
+#endif
+
+/* First NUL at or after p or, if none comes before stop, a point at or
+ * past stop with no NUL before it. Past the first 64 bytes all loads are
+ * 64-byte aligned, so none crosses into a page the string does not reach. */
+static inline const unsigned char* lr__str_scan(const unsigned char* p, const unsigned char* stop) {
+    #ifdef LR_SIMD
+    const unsigned char* a = (const unsigned char*)((uintptr_t)p & ~(uintptr_t)63);
+    uint64_t m;
+    
+    if (((uintptr_t)p & 4095) <= 4096 - 64) {
+        m = lr__nul_mask64(p);
+        if (m) {
+            return p + __builtin_ctzll(m);
+        }
+    } else {
+        m = lr__nul_mask64(a) >> (p - a);
+        if (m) {
+            return p + __builtin_ctzll(m);
+        }
+    }
+    for (a += 64; a < stop; a += 64) {
+        m = lr__nul_mask64(a);
+        if (m) {
+            return a + __builtin_ctzll(m);
+        }
+    }
+    return a;
+    #else
+    while (p < stop && *p) {
+        p++;
+    }
+    return p;
+    #endif
+}
+
+/* memhash64(s, strlen(s), seed) in one pass, storing the length in
+ * *len_out unless it is NULL. Strings over 512 bytes are hashed a block
+ * at a time behind a terminator scan that runs at most 1 KiB ahead, so
+ * the hash reads bytes the scan has just brought into L1. */
+static inline uint64_t strhash(const char* str, size_t* len_out, uint64_t seed) {
+    const unsigned char* s = (const unsigned char*)str;
+    const unsigned char* q = lr__str_scan(s, s + 513);
+    uint64_t out[2];
+    size_t n, ready, done = 0;
+    
+    if (*q) {
+        #ifdef LR__MEMHASH_AES
+        lr__v16 st[8];
+        #else
+        uint64_t a, b, l[4];
+        #endif
+        seed ^= lr__hash_mix(seed ^ LR__HASH0, LR__HASH1);
+        #ifdef LR__MEMHASH_AES
+        lr__memhash_aes_init(st, seed);
+        #else
+        l[0] = l[1] = l[2] = l[3] = seed;
+        #endif
+        
+        /* A block can be absorbed once a byte past it is known not NUL */
+        do {
+            ready = (size_t)(q - s - 1) / 64;
+            #ifdef LR__MEMHASH_AES
+            lr__memhash_aes_blocks(st, s + done * 64, ready - done);
+            #else
+            lr__memhash_blocks(l, s + done * 64, ready - done);
+            #endif
+            done = ready;
+            q = lr__str_scan(q, q + 1024);
+        } while (*q);
+        
+        n = (size_t)(q - s);
+        ready = (n - 1) / 64;
+        #ifdef LR__MEMHASH_AES
+        lr__memhash_aes_blocks(st, s + done * 64, ready - done);
+        lr__memhash_aes_final(st, q, n, seed, out);
+        #else
+        lr__memhash_blocks(l, s + done * 64, ready - done);
+        lr__memhash_tail(l, s + ready * 64, q, &a, &b);
+        lr__memhash_final(a, b, n, out, 0);
+        #endif
+    } else {
+        n = (size_t)(q - s);
+        lr__memhash(s, n, seed, out, 0);
+    }
+    if (len_out) {
+        *len_out = n;
+    }
+    return out[0];
+}
+
+/* Sorting */
+
+#define LR__SORT_INSERTION 24   /* Ranges shorter than this use insertion sort */
+#define LR__SORT_NINTHER   128  /* Longer ranges take the pivot from a ninther */
+#define LR__SORT_PARTIAL   8    /* Moves before partial insertion sort gives up */
+#define LR__SORT_BLOCK     64   /* Offsets per block in branchless partitioning */
+
+/* Typed sort with the comparison inlined: LR_SORT_DEFINE(name, T, less)
+ * defines void name(T* a, size_t n), where less(x, y) is a macro or
+ * function taking two T values and true when x orders before y.
+ * Pattern-defeating quicksort (pdqsort): median-of-3 or ninther pivots,
+ * branchless block partitioning, an equal-keys partition, detection of
+ * already-sorted ranges and a heapsort bound on bad pivots. Not stable.
+ * LR__SORT_DEFINE also takes the leaf sort: leaf(a, end, leftmost) sorts
+ * ranges shorter than leaf_n, like name##__insertion. */
+#define LR__SORT_DEFINE(name, T, less, leaf, leaf_n) \
+static inline void name##__swap(T* a, T* b) {                                                                                             \
+    T t = *a;                                                                                                                             \
+    *a = *b;                                                                                                                              \
+    *b = t;                                                                                                                               \
+}                                                                                                                                         \
+                                                                                                                                          \
+static inline void name##__sort2(T* a, T* b) {                                                                                            \
+    if (less(*b, *a)) {                                                                                                                   \
+        name##__swap(a, b);                                                                                                               \
+    }                                                                                                                                     \
+}                                                                                                                                         \
+                                                                                                                                          \
+static inline void name##__sort3(T* a, T* b, T* c) {                                                                                      \
+    name##__sort2(a, b);                                                                                                                  \
+    name##__sort2(b, c);                                                                                                                  \
+    name##__sort2(a, b);                                                                                                                  \
+}                                                                                                                                         \
+                                                                                                                                          \
+/* Unguarded when an element no greater than any in [a, end) sits at a[-1] */                                                             \
+static inline void name##__insertion(T* a, T* end, int guarded) {                                                                         \
+    T* cur;                                                                                                                               \
+                                                                                                                                          \
+    for (cur = a + 1; cur < end; cur++) {                                                                                                 \
+        T* sift = cur;                                                                                                                    \
+        if (less(*sift, sift[-1])) {                                                                                                      \
+            T tmp = *sift;                                                                                                                \
+            do {                                                                                                                          \
+                *sift = sift[-1];                                                                                                         \
+                sift--;                                                                                                                   \
+            } while ((!guarded || sift != a) && less(tmp, sift[-1]));                                                                     \
+            *sift = tmp;                                                                                                                  \
+        }                                                                                                                                 \
+    }                                                                                                                                     \
+}                                                                                                                                         \
+                                                                                                                                          \
+/* Insertion sort that gives up after LR__SORT_PARTIAL moves */                                                                           \
+static inline int name##__partial_insertion(T* a, T* end) {                                                                               \
+    size_t moves = 0;                                                                                                                     \
+    T* cur;                                                                                                                               \
+                                                                                                                                          \
+    for (cur = a + 1; cur < end; cur++) {                                                                                                 \
+        T* sift = cur;                                                                                                                    \
+        if (less(*sift, sift[-1])) {                                                                                                      \
+            T tmp = *sift;                                                                                                                \
+            do {                                                                                                                          \
+                *sift = sift[-1];                                                                                                         \
+                sift--;                                                                                                                   \
+            } while (sift != a && less(tmp, sift[-1]));                                                                                   \
+            *sift = tmp;                                                                                                                  \
+            moves += (size_t)(cur - sift);                                                                                                \
+            if (moves > LR__SORT_PARTIAL) {                                                                                               \
+                return 0;                                                                                                                 \
+            }                                                                                                                             \
+        }                                                                                                                                 \
+    }                                                                                                                                     \
+    return 1;                                                                                                                             \
+}                                                                                                                                         \
+                                                                                                                                          \
+static inline void name##__sift(T* a, size_t i, size_t n) {                                                                               \
+    T v = a[i];                                                                                                                           \
+    size_t c;                                                                                                                             \
+                                                                                                                                          \
+    while ((c = 2 * i + 1) < n) {                                                                                                         \
+        if (c + 1 < n && less(a[c], a[c + 1])) {                                                                                          \
+            c++;                                                                                                                          \
+        }                                                                                                                                 \
+        if (!less(v, a[c])) {                                                                                                             \
+            break;                                                                                                                        \
+        }                                                                                                                                 \
+        a[i] = a[c];                                                                                                                      \
+        i = c;                                                                                                                            \
+    }                                                                                                                                     \
+    a[i] = v;                                                                                                                             \
+}                                                                                                                                         \
+                                                                                                                                          \
+static inline void name##__heapsort(T* a, size_t n) {                                                                                     \
+    size_t i;                                                                                                                             \
+                                                                                                                                          \
+    for (i = n / 2; i-- > 0;) {                                                                                                           \
+        name##__sift(a, i, n);                                                                                                            \
+    }                                                                                                                                     \
+    for (i = n; i-- > 1;) {                                                                                                               \
+        name##__swap(a, a + i);                                                                                                           \
+        name##__sift(a, 0, i);                                                                                                            \
+    }                                                                                                                                     \
+}                                                                                                                                         \
+                                                                                                                                          \
+/* Moves num misplaced pairs named by the offset blocks; a cyclic rotation                                                                \
+ * when the blocks differ in size, plain swaps otherwise (which keeps                                                                     \
+ * descending input linear) */                                                                                                            \
+static inline void name##__swap_offsets(T* first, T* last, const unsigned char* offl, const unsigned char* offr, size_t num, int swaps) { \
+    size_t i;                                                                                                                             \
+                                                                                                                                          \
+    if (swaps) {                                                                                                                          \
+        for (i = 0; i < num; i++) {                                                                                                       \
+            name##__swap(first + offl[i], last - offr[i]);                                                                                \
+        }                                                                                                                                 \
+    } else if (num) {                                                                                                                     \
+        T* l = first + offl[0];                                                                                                           \
+        T* r = last - offr[0];                                                                                                            \
+        T tmp = *l;                                                                                                                       \
+        *l = *r;                                                                                                                          \
+        for (i = 1; i < num; i++) {                                                                                                       \
+            l = first + offl[i];                                                                                                          \
+            *r = *l;                                                                                                                      \
+            r = last - offr[i];                                                                                                           \
+            *l = *r;                                                                                                                      \
+        }                                                                                                                                 \
+        *r = tmp;                                                                                                                         \
+    }                                                                                                                                     \
+}                                                                                                                                         \
+                                                                                                                                          \
+/* Partition around *a with elements equal to the pivot going right; sets                                                                 \
+ * *already when no element had to move. The scans record out-of-place                                                                    \
+ * offsets in blocks without branching on the comparison (BlockQuicksort). */                                                             \
+static inline T* name##__partition(T* a, T* end, int* already) {                                                                          \
+    T pivot = *a;                                                                                                                         \
+    T* first = a;                                                                                                                         \
+    T* last = end;                                                                                                                        \
+    T* basel;                                                                                                                             \
+    T* baser;                                                                                                                             \
+    unsigned char offl[LR__SORT_BLOCK], offr[LR__SORT_BLOCK];                                                                             \
+    size_t numl = 0, numr = 0, startl = 0, startr = 0, i, num;                                                                            \
+                                                                                                                                          \
+    while (less(*++first, pivot)) {                                                                                                       \
+        ;                                                                                                                                 \
+    }                                                                                                                                     \
+    if (first - 1 == a) {                                                                                                                 \
+        while (first < last && !less(*--last, pivot)) {                                                                                   \
+            ;                                                                                                                             \
+        }                                                                                                                                 \
+    } else {                                                                                                                              \
+        while (!less(*--last, pivot)) {                                                                                                   \
+            ;                                                                                                                             \
+        }                                                                                                                                 \
+    }                                                                                                                                     \
+    *already = first >= last;                                                                                                             \
+    if (!*already) {                                                                                                                      \
+        name##__swap(first, last);                                                                                                        \
+        first++;                                                                                                                          \
+        basel = first;                                                                                                                    \
+        baser = last;                                                                                                                     \
+        while (first < last) {                                                                                                            \
+            size_t unknown = (size_t)(last - first);                                                                                      \
+            size_t lsplit = numl ? 0 : numr ? unknown : unknown / 2;                                                                      \
+            size_t rsplit = numr ? 0 : unknown - lsplit;                                                                                  \
+            if (lsplit > LR__SORT_BLOCK) {                                                                                                \
+                lsplit = LR__SORT_BLOCK;                                                                                                  \
+            }                                                                                                                             \
+            if (rsplit > LR__SORT_BLOCK) {                                                                                                \
+                rsplit = LR__SORT_BLOCK;                                                                                                  \
+            }                                                                                                                             \
+            for (i = 0; i < lsplit; i++) {                                                                                                \
+                offl[numl] = (unsigned char)i;                                                                                            \
+                numl += !less(*first, pivot);                                                                                             \
+                first++;                                                                                                                  \
+            }                                                                                                                             \
+            for (i = 0; i < rsplit; i++) {                                                                                                \
+                offr[numr] = (unsigned char)(i + 1);                                                                                      \
+                last--;                                                                                                                   \
+                numr += less(*last, pivot);                                                                                               \
+            }                                                                                                                             \
+            num = numl < numr ? numl : numr;                                                                                              \
+            name##__swap_offsets(basel, baser, offl + startl, offr + startr, num, numl == numr);                                          \
+            numl -= num;                                                                                                                  \
+            numr -= num;                                                                                                                  \
+            startl += num;                                                                                                                \
+            startr += num;                                                                                                                \
+            if (!numl) {                                                                                                                  \
+                startl = 0;                                                                                                               \
+                basel = first;                                                                                                            \
+            }                                                                                                                             \
+            if (!numr) {                                                                                                                  \
+                startr = 0;                                                                                                               \
+                baser = last;                                                                                                             \
+            }                                                                                                                             \
+        }                                                                                                                                 \
+        if (numl) {                                                                                                                       \
+            while (numl--) {                                                                                                              \
+                name##__swap(basel + offl[startl + numl], --last);                                                                        \
+            }                                                                                                                             \
+            first = last;                                                                                                                 \
+        }                                                                                                                                 \
+        if (numr) {                                                                                                                       \
+            while (numr--) {                                                                                                              \
+                name##__swap(baser - offr[startr + numr], first++);                                                                       \
+            }                                                                                                                             \
+        }                                                                                                                                 \
+    }                                                                                                                                     \
+    first--;                                                                                                                              \
+    *a = *first;                                                                                                                          \
+    *first = pivot;                                                                                                                       \
+    return first;                                                                                                                         \
+}                                                                                                                                         \
+                                                                                                                                          \
+/* Partition with elements equal to the pivot going left; used when the                                                                   \
+ * pivot equals the element before the range, so that run of equal keys                                                                   \
+ * is finished in one pass */                                                                                                             \
+static inline T* name##__partition_left(T* a, T* end) {                                                                                   \
+    T pivot = *a;                                                                                                                         \
+    T* first = a;                                                                                                                         \
+    T* last = end;                                                                                                                        \
+                                                                                                                                          \
+    while (less(pivot, *--last)) {                                                                                                        \
+        ;                                                                                                                                 \
+    }                                                                                                                                     \
+    if (last + 1 == end) {                                                                                                                \
+        while (first < last && !less(pivot, *++first)) {                                                                                  \
+            ;                                                                                                                             \
+        }                                                                                                                                 \
+    } else {                                                                                                                              \
+        while (!less(pivot, *++first)) {                                                                                                  \
+            ;                                                                                                                             \
+        }                                                                                                                                 \
+    }                                                                                                                                     \
+    while (first < last) {                                                                                                                \
+        name##__swap(first, last);                                                                                                        \
+        while (less(pivot, *--last)) {                                                                                                    \
+            ;                                                                                                                             \
+        }                                                                                                                                 \
+        while (!less(pivot, *++first)) {                                                                                                  \
+            ;                                                                                                                             \
+        }                                                                                                                                 \
+    }                                                                                                                                     \
+    *a = *last;                                                                                                                           \
+    *last = pivot;                                                                                                                        \
+    return last;                                                                                                                          \
+}                                                                                                                                         \
+                                                                                                                                          \
+static inline void name##__loop(T* a, T* end, int bad, int leftmost) {                                                                    \
+    for (;;) {                                                                                                                            \
+        size_t n = (size_t)(end - a), half = n / 2, ln, rn;                                                                               \
+        T* mid;                                                                                                                           \
+        int already;                                                                                                                      \
+                                                                                                                                          \
+        if (n < (leaf_n)) {                                                                                                               \
+            leaf(a, end, leftmost);                                                                                                       \
+            return;                                                                                                                       \
+        }                                                                                                                                 \
+        if (n > LR__SORT_NINTHER) {                                                                                                       \
+            name##__sort3(a, a + half, end - 1);                                                                                          \
+            name##__sort3(a + 1, a + half - 1, end - 2);                                                                                  \
+            name##__sort3(a + 2, a + half + 1, end - 3);                                                                                  \
+            name##__sort3(a + half - 1, a + half, a + half + 1);                                                                          \
+            name##__swap(a, a + half);                                                                                                    \
+        } else {                                                                                                                          \
+            name##__sort3(a + half, a, end - 1);                                                                                          \
+        }                                                                                                                                 \
+        if (!leftmost && !less(a[-1], *a)) {                                                                                              \
+            a = name##__partition_left(a, end) + 1;                                                                                       \
+            continue;                                                                                                                     \
+        }                                                                                                                                 \
+                                                                                                                                          \
+        mid = name##__partition(a, end, &already);                                                                                        \
+        ln = (size_t)(mid - a);                                                                                                           \
+        rn = (size_t)(end - mid) - 1;                                                                                                     \
+        if (ln < n / 8 || rn < n / 8) {                                                                                                   \
+            /* Unbalanced: after log2(n) of these use heapsort, otherwise                                                                 \
+             * swap a few elements to break the pattern */                                                                                \
+            if (--bad == 0) {                                                                                                             \
+                name##__heapsort(a, n);                                                                                                   \
+                return;                                                                                                                   \
+            }                                                                                                                             \
+            if (ln >= LR__SORT_INSERTION) {                                                                                               \
+                name##__swap(a, a + ln / 4);                                                                                              \
+                name##__swap(mid - 1, mid - ln / 4);                                                                                      \
+                if (ln > LR__SORT_NINTHER) {                                                                                              \
+                    name##__swap(a + 1, a + (ln / 4 + 1));                                                                                \
+                    name##__swap(a + 2, a + (ln / 4 + 2));                                                                                \
+                    name##__swap(mid - 2, mid - (ln / 4 + 1));                                                                            \
+                    name##__swap(mid - 3, mid - (ln / 4 + 2));                                                                            \
+                }                                                                                                                         \
+            }                                                                                                                             \
+            if (rn >= LR__SORT_INSERTION) {                                                                                               \
+                name##__swap(mid + 1, mid + (1 + rn / 4));                                                                                \
+                name##__swap(end - 1, end - rn / 4);                                                                                      \
+                if (rn > LR__SORT_NINTHER) {                                                                                              \
+                    name##__swap(mid + 2, mid + (2 + rn / 4));                                                                            \
+                    name##__swap(mid + 3, mid + (3 + rn / 4));                                                                            \
+                    name##__swap(end - 2, end - (1 + rn / 4));                                                                            \
+                    name##__swap(end - 3, end - (2 + rn / 4));                                                                            \
+                }                                                                                                                         \
+            }                                                                                                                             \
+        } else if (already && name##__partial_insertion(a, mid) && name##__partial_insertion(mid + 1, end)) {                             \
+            /* Nothing moved and both sides were (nearly) sorted */                                                                       \
+            return;                                                                                                                       \
+        }                                                                                                                                 \
+                                                                                                                                          \
+        name##__loop(a, mid, bad, leftmost);                                                                                              \
+        a = mid + 1;                                                                                                                      \
+        leftmost = 0;                                                                                                                     \
+    }                                                                                                                                     \
+}                                                                                                                                         \
+                                                                                                                                          \
+static inline void name(T* a, size_t n) {                                                                                                 \
+    if (n > 1) {                                                                                                                          \
+        name##__loop(a, a + n, 64 - lr__clz64(n), 1);                                                                                     \
+    }                                                                                                                                     \
+}
+
+#define LR_SORT_DEFINE(name, T, less) LR__SORT_DEFINE(name, T, less, name##__insertion, LR__SORT_INSERTION)
+
+/* qsort/qsort_r: the same algorithm over elements of any size through a
+ * comparison function. The partitions branch on each comparison, as the
+ * indirect call dominates there anyway. */
+typedef struct {
+    int (*cmp)(const void*, const void*);
+    int (*cmp_r)(const void*, const void*, void*);
+    void* arg;
+    size_t size;
+} lr__sort_ctx;
+
+static inline int lr__sort_less(const lr__sort_ctx* c, const unsigned char* a, const unsigned char* b) {
+    return (c->cmp ? c->cmp(a, b) : c->cmp_r(a, b, c->arg)) < 0;
+}
+
+/* Exchange two elements: fixed-size moves for 4, 8 and 16 bytes, the
+ * short-copy kernel's overlapping moves up to 32, 32-byte steps up to 256
+ * and memcpy through a stack buffer beyond */
+static inline void lr__sort_swap(unsigned char* a, unsigned char* b, size_t size) {
+    if (size == 16) {
+        uint64_t x[2], y[2];
+        LR__COPY_FIXED(x, a, 16);
+        LR__COPY_FIXED(y, b, 16);
+        LR__COPY_FIXED(a, y, 16);
+        LR__COPY_FIXED(b, x, 16);
+    } else if (size == 8) {
+        uint64_t x, y;
+        LR__COPY_FIXED(&x, a, 8);
+        LR__COPY_FIXED(&y, b, 8);
+        LR__COPY_FIXED(a, &y, 8);
+        LR__COPY_FIXED(b, &x, 8);
+    } else if (size == 4) {
+        uint32_t x, y;
+        LR__COPY_FIXED(&x, a, 4);
+        LR__COPY_FIXED(&y, b, 4);
+        LR__COPY_FIXED(a, &y, 4);
+        LR__COPY_FIXED(b, &x, 4);
+    } else if (size <= 256) {
+        char t[32];
+        for (; size > 32; size -= 32, a += 32, b += 32) {
+            LR__COPY_FIXED(t, a, 32);
+            LR__COPY_FIXED(a, b, 32);
+            LR__COPY_FIXED(b, t, 32);
+        }
+        lr__out_short(t, (const char*)a, size, ~(size_t)0);
+        lr__out_short((char*)a, (const char*)b, size, ~(size_t)0);
+        lr__out_short((char*)b, t, size, ~(size_t)0);
+    } else {
+        char t[256];
+        while (size) {
+            size_t k = size < 256 ? size : 256;
+            memcpy(t, a, k);
+            memcpy(a, b, k);
+            memcpy(b, t, k);
+            size -= k, a += k, b += k;
+        }
+    }
+}
+
+static inline void lr__qsort_sort2(const lr__sort_ctx* c, unsigned char* a, unsigned char* b) {
+    if (lr__sort_less(c, b, a)) {
+        lr__sort_swap(a, b, c->size);
+    }
+}
+
+static inline void lr__qsort_sort3(const lr__sort_ctx* c, unsigned char* a, unsigned char* b, unsigned char* d) {
+    lr__qsort_sort2(c, a, b);
+    lr__qsort_sort2(c, b, d);
+    lr__qsort_sort2(c, a, b);
+}
+
+/* Insertion sort by adjacent swaps; a limit of 0 means none, otherwise
+ * gives up (returns 0) after that many moves */
+static inline int lr__qsort_insertion(const lr__sort_ctx* c, unsigned char* a, unsigned char* end, int guarded, size_t limit) {
+    const size_t sz = c->size;
+    size_t moves = 0;
+    unsigned char* cur;
+    
+    for (cur = a + sz; cur < end; cur += sz) {
+        unsigned char* sift = cur;
+        while ((!guarded || sift != a) && lr__sort_less(c, sift, sift - sz)) {
+            lr__sort_swap(sift, sift - sz, sz);
+            sift -= sz;
+            moves++;
+        }
+        if (limit && moves > limit) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static inline void lr__qsort_sift(const lr__sort_ctx* c, unsigned char* a, size_t i, size_t n) {
+    const size_t sz = c->size;
+    size_t j;
+    
+    for (; (j = 2 * i + 1) < n; i = j) {
+        if (j + 1 < n && lr__sort_less(c, a + j * sz, a + (j + 1) * sz)) {
+            j++;
+        }
+        if (!lr__sort_less(c, a + i * sz, a + j * sz)) {
+            break;
+        }
+        lr__sort_swap(a + i * sz, a + j * sz, sz);
+    }
+}
+
+static inline void lr__qsort_heapsort(const lr__sort_ctx* c, unsigned char* a, size_t n) {
+    size_t i;
+    
+    for (i = n / 2; i-- > 0;) {
+        lr__qsort_sift(c, a, i, n);
+    }
+    for (i = n; i-- > 1;) {
+        lr__sort_swap(a, a + i * c->size, c->size);
+        lr__qsort_sift(c, a, 0, i);
+    }
+}
+
+/* The partitions keep the pivot at a until they finish */
+static inline unsigned char* lr__qsort_partition(const lr__sort_ctx* c, unsigned char* a, unsigned char* end, int* already) {
+    const size_t sz = c->size;
+    unsigned char* first = a;
+    unsigned char* last = end;
+    
+    do {
+        first += sz;
+    } while (lr__sort_less(c, first, a));
+    if (first - sz == a) {
+        while (first < last) {
+            last -= sz;
+            if (lr__sort_less(c, last, a)) {
+                break;
+            }
+        }
+    } else {
+        do {
+            last -= sz;
+        } while (!lr__sort_less(c, last, a));
+    }
+    *already = first >= last;
+    while (first < last) {
+        lr__sort_swap(first, last, sz);
+        do {
+            first += sz;
+        } while (lr__sort_less(c, first, a));
+        do {
+            last -= sz;
+        } while (!lr__sort_less(c, last, a));
+    }
+    first -= sz;
+    if (first != a) {
+        lr__sort_swap(a, first, sz);
+    }
+    return first;
+}
+
+static inline unsigned char* lr__qsort_partition_left(const lr__sort_ctx* c, unsigned char* a, unsigned char* end) {
+    const size_t sz = c->size;
+    unsigned char* first = a;
+    unsigned char* last = end;
+    
+    do {
+        last -= sz;
+    } while (lr__sort_less(c, a, last));
+    if (last + sz == end) {
+        while (first < last) {
+            first += sz;
+            if (lr__sort_less(c, a, first)) {
+                break;
+            }
+        }
+    } else {
+        do {
+            first += sz;
+        } while (!lr__sort_less(c, a, first));
+    }
+    while (first < last) {
+        lr__sort_swap(first, last, sz);
+        do {
+            last -= sz;
+        } while (lr__sort_less(c, a, last));
+        do {
+            first += sz;
+        } while (!lr__sort_less(c, a, first));
+    }
+    if (last != a) {
+        lr__sort_swap(a, last, sz);
+    }
+    return last;
+}
+
+static inline void lr__qsort_loop(const lr__sort_ctx* c, unsigned char* a, unsigned char* end, int bad, int leftmost) {
+    const size_t sz = c->size;
+    
+    for (;;) {
+        size_t n = (size_t)(end - a) / sz, half = n / 2, ln, rn, q;
+        unsigned char* m = a + half * sz;
+        unsigned char* mid;
+        int already;
+        
+        if (n < LR__SORT_INSERTION) {
+            lr__qsort_insertion(c, a, end, leftmost, 0);
+            return;
+        }
+        if (n > LR__SORT_NINTHER) {
+            lr__qsort_sort3(c, a, m, end - sz);
+            lr__qsort_sort3(c, a + sz, m - sz, end - 2 * sz);
+            lr__qsort_sort3(c, a + 2 * sz, m + sz, end - 3 * sz);
+            lr__qsort_sort3(c, m - sz, m, m + sz);
+            lr__sort_swap(a, m, sz);
+        } else {
+            lr__qsort_sort3(c, m, a, end - sz);
+        }
+        if (!leftmost && !lr__sort_less(c, a - sz, a)) {
+            a = lr__qsort_partition_left(c, a, end) + sz;
+            continue;
+        }
+        
+        mid = lr__qsort_partition(c, a, end, &already);
+        ln = (size_t)(mid - a) / sz;
+        rn = (size_t)(end - mid) / sz - 1;
+        if (ln < n / 8 || rn < n / 8) {
+            if (--bad == 0) {
+                lr__qsort_heapsort(c, a, n);
+                return;
+            }
+            if (ln >= LR__SORT_INSERTION) {
+                q = ln / 4 * sz;
+                lr__sort_swap(a, a + q, sz);
+                lr__sort_swap(mid - sz, mid - q, sz);
+                if (ln > LR__SORT_NINTHER) {
+                    lr__sort_swap(a + sz, a + q + sz, sz);
+                    lr__sort_swap(a + 2 * sz, a + q + 2 * sz, sz);
+                    lr__sort_swap(mid - 2 * sz, mid - q - sz, sz);
+                    lr__sort_swap(mid - 3 * sz, mid - q - 2 * sz, sz);
+                }
+            }
+            if (rn >= LR__SORT_INSERTION) {
+                q = rn / 4 * sz;
+                lr__sort_swap(mid + sz, mid + sz + q, sz);
+                lr__sort_swap(end - sz, end - q, sz);
+                if (rn > LR__SORT_NINTHER) {
+                    lr__sort_swap(mid + 2 * sz, mid + 2 * sz + q, sz);
+                    lr__sort_swap(mid + 3 * sz, mid + 3 * sz + q, sz);
+                    lr__sort_swap(end - 2 * sz, end - q - sz, sz);
+                    lr__sort_swap(end - 3 * sz, end - q - 2 * sz, sz);
+                }
+            }
+        } else if (already && lr__qsort_insertion(c, a, mid, 1, LR__SORT_PARTIAL)
+                           && lr__qsort_insertion(c, mid + sz, end, 1, LR__SORT_PARTIAL)) {
+            return;
+        }
+        
+        lr__qsort_loop(c, a, mid, bad, leftmost);
+        a = mid + sz;
+        leftmost = 0;
+    }
+}
+
+/* POSIX qsort_r argument order (as glibc): arg is passed to cmp last */
+static inline void qsort_r(void* base, size_t n, size_t size, int (*cmp)(const void*, const void*, void*), void* arg) {
+    lr__sort_ctx c;
+    c.cmp = 0;
+    c.cmp_r = cmp;
+    c.arg = arg;
+    c.size = size;
+    if (n > 1 && size) {
+        lr__qsort_loop(&c, (unsigned char*)base, (unsigned char*)base + n * size, 64 - lr__clz64(n), 1);
+    }
+}
+
+static inline void qsort(void* base, size_t n, size_t size, int (*cmp)(const void*, const void*)) {
+    lr__sort_ctx c;
+    c.cmp = cmp;
+    c.cmp_r = 0;
+    c.arg = 0;
+    c.size = size;
+    if (n > 1 && size) {
+        lr__qsort_loop(&c, (unsigned char*)base, (unsigned char*)base + n * size, 64 - lr__clz64(n), 1);
+    }
+}
+
+/* Stable sort: timsort over caller scratch. Natural ascending runs are
+ * kept and strictly descending ones reversed; short runs are extended to
+ * minrun by insertion; runs merge under the stack invariants with
+ * galloping once one side keeps winning. Galloped stretches move as blocks. */
+#define LR__MSORT_MIN    16  /* Arrays shorter than this are one insertion-sorted run */
+#define LR__MSORT_GALLOP 7   /* Initial consecutive wins before a merge gallops */
+#define LR__MSORT_STACK  85  /* Pending runs; enough for 2^64 elements */
+
+typedef struct {
+    lr__sort_ctx c;
+    unsigned char* tmp;
+    size_t min_gallop;
+    size_t runs;
+    unsigned char* base[LR__MSORT_STACK];
+    size_t len[LR__MSORT_STACK];
+} lr__msort;
+
+/* Non-overlapping copy; short ones inline, as rep movsb's startup dominates */
+static inline void lr__sort_copy(unsigned char* d, const unsigned char* s, size_t n) {
+    if (n <= LR__OUT_SHORT) {
+        lr__out_short((char*)d, (const char*)s, n, ~(size_t)0);
+    } else {
+        memcpy(d, s, n);
+    }
+}
+
+/* Overlapping move. memmove copies a forward overlap with rep movs but a
+ * backward one a byte at a time, so that direction goes in 32-byte steps
+ * from the end here, each read whole before it is written. */
+static inline void lr__sort_move(unsigned char* d, const unsigned char* s, size_t n) {
+    char t[LR__OUT_SHORT];
+    
+    if (d > s && d < s + n) {
+        while (n > LR__OUT_SHORT) {
+            n -= LR__OUT_SHORT;
+            LR__COPY_FIXED(t, s + n, LR__OUT_SHORT);
+            LR__COPY_FIXED(d + n, t, LR__OUT_SHORT);
+        }
+    } else if (n > LR__OUT_SHORT) {
+        memmove(d, s, n);
+        return;
+    }
+    lr__out_short(t, (const char*)s, n, ~(size_t)0);
+    lr__out_short((char*)d, t, n, ~(size_t)0);
+}
+
+static inline size_t lr__msort_minrun(size_t n) {
+    size_t r = 0;
+    
+    while (n >= LR__MSORT_MIN) {
+        r |= n & 1;
+        n >>= 1;
+    }
+    return n + r;
+}
+
+/* Length of the run starting at a, reversed in place if descending */
+static inline size_t lr__msort_run(const lr__sort_ctx* c, unsigned char* a, size_t n) {
+    const size_t sz = c->size;
+    unsigned char* lo = a;
+    unsigned char* hi;
+    size_t k = 2;
+    
+    if (n < 2) {
+        return n;
+    }
+    if (lr__sort_less(c, a + sz, a)) {
+        while (k < n && lr__sort_less(c, a + k * sz, a + (k - 1) * sz)) {
+            k++;
+        }
+        for (hi = a + (k - 1) * sz; lo < hi; lo += sz, hi -= sz) {
+            lr__sort_swap(lo, hi, sz);
+        }
+    } else {
+        while (k < n && !lr__sort_less(c, a + k * sz, a + (k - 1) * sz)) {
+            k++;
+        }
+    }
+    return k;
+}
+
+/* Sort a[0, n) given that a[0, sorted) already is; equal keys insert after */
+static inline void lr__msort_insertion(lr__msort* m, unsigned char* a, size_t sorted, size_t n) {
+    const size_t sz = m->c.size;
+    unsigned char* end = a + n * sz;
+    unsigned char* cur;
+    
+    for (cur = a + sorted * sz; cur < end; cur += sz) {
+        unsigned char* sift = cur;
+        if (lr__sort_less(&m->c, cur, cur - sz)) {
+            lr__sort_copy(m->tmp, cur, sz);
+            do {
+                lr__sort_copy(sift, sift - sz, sz);
+                sift -= sz;
+            } while (sift != a && lr__sort_less(&m->c, m->tmp, sift - sz));
+            lr__sort_copy(sift, m->tmp, sz);
+        }
+    }
+}
+
+/* First k in [0, n] with key <= a[k] (left) or key < a[k] (right),
+ * probing outward from a[hint] in steps of 1, 3, 7, ... */
+static inline size_t lr__msort_gallop(const lr__sort_ctx* c, const unsigned char* key, const unsigned char* a,
+                                      size_t n, size_t hint, int right) {
+    const size_t sz = c->size;
+    size_t ofs = 1, last = 0, lo, hi;
+    
+    if (right ? lr__sort_less(c, key, a + hint * sz) : !lr__sort_less(c, a + hint * sz, key)) {
+        /* Target at or before hint */
+        while (ofs <= hint && (right ? lr__sort_less(c, key, a + (hint - ofs) * sz)
+                                     : !lr__sort_less(c, a + (hint - ofs) * sz, key))) {
+            last = ofs;
+            ofs = 2 * ofs + 1;
+        }
+        if (ofs > hint + 1) {
+            ofs = hint + 1;
+        }
+        lo = hint + 1 - ofs;
+        hi = hint - last;
+    } else {
+        while (ofs < n - hint && (right ? !lr__sort_less(c, key, a + (hint + ofs) * sz)
+                                        : lr__sort_less(c, a + (hint + ofs) * sz, key))) {
+            last = ofs;
+            ofs = 2 * ofs + 1;
+        }
+        if (ofs > n - hint) {
+            ofs = n - hint;
+        }
+        lo = hint + last + 1;
+        hi = hint + ofs;
+    }
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (right ? lr__sort_less(c, key, a + mid * sz) : !lr__sort_less(c, a + mid * sz, key)) {
+            hi = mid;
+        } else {
+            lo = mid + 1;
+        }
+    }
+    return hi;
+}
+
+/* Merge runs a[0, na) and b = a + na, [0, nb) with na <= nb: a goes to
+ * scratch and the output fills from the left. a[0] > b[0] and a[na-1] >
+ * b[nb-1] on entry, so b supplies the first element and a the last. */
+static inline void lr__msort_merge_lo(lr__msort* m, unsigned char* a, size_t na, unsigned char* b, size_t nb) {
+    const lr__sort_ctx* c = &m->c;
+    const size_t sz = c->size;
+    unsigned char* dest = a;
+    unsigned char* t = m->tmp;
+    size_t gallop = m->min_gallop, k;
+    
+    lr__sort_copy(t, a, na * sz);
+    lr__sort_copy(dest, b, sz);
+    dest += sz, b += sz;
+    if (--nb == 0) {
+        goto done;
+    }
+    if (na == 1) {
+        goto last;
+    }
+    for (;;) {
+        size_t wa = 0, wb = 0;
+        
+        /* One at a time until a side wins gallop times in a row. Written
+         * as selects, since on random input the comparison is a coin toss. */
+        do {
+            size_t lt = (size_t)lr__sort_less(c, b, t), mb = 0 - lt;
+            lr__sort_copy(dest, (const unsigned char*)(((uintptr_t)b & mb) | ((uintptr_t)t & ~mb)), sz);
+            dest += sz;
+            b += sz & mb;
+            t += sz & ~mb;
+            nb -= lt;
+            na -= lt ^ 1;
+            wb = (wb + 1) & mb;
+            wa = (wa + 1) & ~mb;
+            if (nb == 0) {
+                goto done;
+            }
+            if (na == 1) {
+                goto last;
+            }
+        } while (wa + wb < gallop);
+        
+        /* Gallop while it keeps paying, then make it harder to re-enter */
+        gallop++;
+        do {
+            gallop -= gallop > 1;
+            wa = k = lr__msort_gallop(c, b, t, na, 0, 1);
+            if (k) {
+                lr__sort_copy(dest, t, k * sz);
+                dest += k * sz, t += k * sz;
+                na -= k;
+                if (na <= 1) {
+                    goto last;
+                }
+            }
+            lr__sort_copy(dest, b, sz);
+            dest += sz, b += sz;
+            if (--nb == 0) {
+                goto done;
+            }
+            wb = k = lr__msort_gallop(c, t, b, nb, 0, 0);
+            if (k) {
+                lr__sort_move(dest, b, k * sz);
+                dest += k * sz, b += k * sz;
+                if ((nb -= k) == 0) {
+                    goto done;
+                }
+            }
+            lr__sort_copy(dest, t, sz);
+            dest += sz, t += sz;
+            if (--na == 1) {
+                goto last;
+            }
+        } while (wa >= LR__MSORT_GALLOP || wb >= LR__MSORT_GALLOP);
+        gallop++;
+    }
+    
+last:
+    /* A comparator that is not a strict weak order can empty a early */
+    if (na) {
+        lr__sort_move(dest, b, nb * sz);
+        lr__sort_copy(dest + nb * sz, t, sz);
+    }
+    m->min_gallop = gallop;
+    return;
+done:
+    lr__sort_copy(dest, t, na * sz);
+    m->min_gallop = gallop;
+}
+
+/* Mirror of merge_lo for na > nb: b goes to scratch and the output fills
+ * from the right */
+static inline void lr__msort_merge_hi(lr__msort* m, unsigned char* a, size_t na, unsigned char* b, size_t nb) {
+    const lr__sort_ctx* c = &m->c;
+    const size_t sz = c->size;
+    unsigned char* dest = b + (nb - 1) * sz;
+    unsigned char* ap = a + (na - 1) * sz;
+    unsigned char* t = m->tmp + (nb - 1) * sz;
+    size_t gallop = m->min_gallop, k;
+    
+    lr__sort_copy(m->tmp, b, nb * sz);
+    lr__sort_copy(dest, ap, sz);
+    dest -= sz, ap -= sz;
+    if (--na == 0) {
+        goto done;
+    }
+    if (nb == 1) {
+        goto last;
+    }
+    for (;;) {
+        size_t wa = 0, wb = 0;
+        
+        do {
+            size_t lt = (size_t)lr__sort_less(c, t, ap), ma = 0 - lt;
+            lr__sort_copy(dest, (const unsigned char*)(((uintptr_t)ap & ma) | ((uintptr_t)t & ~ma)), sz);
+            dest -= sz;
+            ap -= sz & ma;
+            t -= sz & ~ma;
+            na -= lt;
+            nb -= lt ^ 1;
+            wa = (wa + 1) & ma;
+            wb = (wb + 1) & ~ma;
+            if (na == 0) {
+                goto done;
+            }
+            if (nb == 1) {
+                goto last;
+            }
+        } while (wa + wb < gallop);
+        
+        gallop++;
+        do {
+            gallop -= gallop > 1;
+            wa = k = na - lr__msort_gallop(c, t, a, na, na - 1, 1);
+            if (k) {
+                dest -= k * sz, ap -= k * sz;
+                lr__sort_move(dest + sz, ap + sz, k * sz);
+                if ((na -= k) == 0) {
+                    goto done;
+                }
+            }
+            lr__sort_copy(dest, t, sz);
+            dest -= sz, t -= sz;
+            if (--nb == 1) {
+                goto last;
+            }
+            wb = k = nb - lr__msort_gallop(c, ap, m->tmp, nb, nb - 1, 0);
+            if (k) {
+                dest -= k * sz, t -= k * sz;
+                lr__sort_copy(dest + sz, t + sz, k * sz);
+                nb -= k;
+                if (nb <= 1) {
+                    goto last;
+                }
+            }
+            lr__sort_copy(dest, ap, sz);
+            dest -= sz, ap -= sz;
+            if (--na == 0) {
+                goto done;
+            }
+        } while (wa >= LR__MSORT_GALLOP || wb >= LR__MSORT_GALLOP);
+        gallop++;
+    }
+    
+last:
+    if (nb) {
+        dest -= na * sz, ap -= na * sz;
+        lr__sort_move(dest + sz, ap + sz, na * sz);
+        lr__sort_copy(dest, t, sz);
+    }
+    m->min_gallop = gallop;
+    return;
+done:
+    lr__sort_copy(dest - (nb - 1) * sz, m->tmp, nb * sz);
+    m->min_gallop = gallop;
+}
+
+/* Merge pending runs i and i + 1 */
+static inline void lr__msort_merge_at(lr__msort* m, size_t i) {
+    const size_t sz = m->c.size;
+    unsigned char* a = m->base[i];
+    unsigned char* b = m->base[i + 1];
+    size_t na = m->len[i], nb = m->len[i + 1], k;
+    
+    m->len[i] = na + nb;
+    if (i + 3 == m->runs) {
+        m->base[i + 1] = m->base[i + 2];
+        m->len[i + 1] = m->len[i + 2];
+    }
+    m->runs--;
+    
+    /* Elements of a already below b[0] and of b above a's last stay put */
+    k = lr__msort_gallop(&m->c, b, a, na, 0, 1);
+    a += k * sz;
+    na -= k;
+    if (na == 0) {
+        return;
+    }
+    nb = lr__msort_gallop(&m->c, a + (na - 1) * sz, b, nb, nb - 1, 0);
+    if (nb == 0) {
+        return;
+    }
+    if (na <= nb) {
+        lr__msort_merge_lo(m, a, na, b, nb);
+    } else {
+        lr__msort_merge_hi(m, a, na, b, nb);
+    }
+}
+
+/* Restore len[i-2] > len[i-1] + len[i] and len[i-1] > len[i] for the top
+ * runs, checking one level deeper than the original timsort so that the
+ * invariant holds for the whole stack */
+static inline void lr__msort_collapse(lr__msort* m) {
+    while (m->runs > 1) {
+        size_t i = m->runs - 2;
+        if ((i > 0 && m->len[i - 1] <= m->len[i] + m->len[i + 1])
+            || (i > 1 && m->len[i - 2] <= m->len[i - 1] + m->len[i])) {
+            if (m->len[i - 1] < m->len[i + 1]) {
+                i--;
+            }
+        } else if (m->len[i] > m->len[i + 1]) {
+            break;
+        }
+        lr__msort_merge_at(m, i);
+    }
+}
+
+static inline void lr__msort_sort(lr__msort* m, unsigned char* a, size_t n) {
+    const size_t sz = m->c.size;
+    size_t minrun, run;
+    
+    if (n < LR__MSORT_MIN) {
+        lr__msort_insertion(m, a, lr__msort_run(&m->c, a, n), n);
+        return;
+    }
+    minrun = lr__msort_minrun(n);
+    m->min_gallop = LR__MSORT_GALLOP;
+    m->runs = 0;
+    while (n) {
+        run = lr__msort_run(&m->c, a, n);
+        if (run < minrun) {
+            size_t force = n < minrun ? n : minrun;
+            lr__msort_insertion(m, a, run, force);
+            run = force;
+        }
+        m->base[m->runs] = a;
+        m->len[m->runs] = run;
+        m->runs++;
+        lr__msort_collapse(m);
+        a += run * sz;
+        n -= run;
+    }
+    while (m->runs > 1) {
+        size_t i = m->runs - 2;
+        if (i > 0 && m->len[i - 1] < m->len[i + 1]) {
+            i--;
+        }
+        lr__msort_merge_at(m, i);
+    }
+}
+
+/* Scratch bytes the stable sorts need for n elements of size bytes */
+static inline size_t lr_mergesort_scratch(size_t n, size_t size) {
+    return n / 2 * size;
+}
+
+/* Stable sort of n elements; scratch holds lr_mergesort_scratch(n, size)
+ * bytes and is clobbered. O(n log n) comparisons, O(n) on presorted runs. */
+static inline void lr_mergesort_r(void* base, size_t n, size_t size, int (*cmp)(const void*, const void*, void*),
+                                  void* arg, void* scratch) {
+    lr__msort m;
+    m.c.cmp = 0;
+    m.c.cmp_r = cmp;
+    m.c.arg = arg;
+    m.c.size = size;
+    m.tmp = (unsigned char*)scratch;
+    if (n > 1 && size) {
+        lr__msort_sort(&m, (unsigned char*)base, n);
+    }
+}
+
+static inline void lr_mergesort(void* base, size_t n, size_t size, int (*cmp)(const void*, const void*), void* scratch) {
+    lr__msort m;
+    m.c.cmp = cmp;
+    m.c.cmp_r = 0;
+    m.c.arg = 0;
+    m.c.size = size;
+    m.tmp = (unsigned char*)scratch;
+    if (n > 1 && size) {
+        lr__msort_sort(&m, (unsigned char*)base, n);
+    }
+}
+
+/* Sorting networks: bitonic sorts of up to 8 vectors of 32- or 64-bit
+ * keys held in registers, with no data-dependent branches. They sort
+ * arrays of up to LR_SORTNET_MAX32/LR_SORTNET_MAX64 elements on their own
+ * and are the leaves of the typed sorts below (sort_i32() and friends).
+ * Keys are mapped to signed integers in the same order, as in the radix
+ * sorts, so one network covers signed, unsigned and float keys; a partial
+ * last vector is padded with the largest key. Without AVX2 they are
+ * insertion sorts. */
+#if defined(LR_SIMD) && defined(__AVX512F__)
+#define LR__SORTNET_BYTES 64
+#define LR__SORTNET_REG   "v"
+#define LR__SORTNET_IOTA32 { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 }
+#define LR__SORTNET_IOTA64 { 0, 1, 2, 3, 4, 5, 6, 7 }
+#elif defined(LR_SIMD) && defined(__AVX2__)
+#define LR__SORTNET_BYTES 32
+#define LR__SORTNET_REG   "x"
+#define LR__SORTNET_IOTA32 { 0, 1, 2, 3, 4, 5, 6, 7 }
+#define LR__SORTNET_IOTA64 { 0, 1, 2, 3 }
+#endif
+
+#ifdef LR__SORTNET_BYTES
+#define LR_SORTNET_MAX32 (LR__SORTNET_BYTES * 2)  /* 8 vectors */
+#define LR_SORTNET_MAX64 LR__SORTNET_BYTES
+#else
+#define LR_SORTNET_MAX32 LR__SORT_INSERTION
+#define LR_SORTNET_MAX64 LR__SORT_INSERTION
+#endif
+
+#ifdef LR__SORTNET_BYTES
+typedef int32_t lr__sn32 __attribute__((vector_size(LR__SORTNET_BYTES)));
+typedef int64_t lr__sn64 __attribute__((vector_size(LR__SORTNET_BYTES)));
+
+/* Gather 32-bit lanes: lane i takes lane idx[i] */
+static inline lr__sn32 lr__sortnet_permv(lr__sn32 v, lr__sn32 idx) {
+    __asm__ ("vpermd %1, %2, %0" : "=" LR__SORTNET_REG (v) : LR__SORTNET_REG (v), LR__SORTNET_REG (idx));
+    return v;
+}
+
+/* Lane i takes lane i ^ x */
+static inline lr__sn32 lr__sortnet_perm(lr__sn32 v, int32_t x) {
+    lr__sn32 idx = LR__SORTNET_IOTA32;
+    return lr__sortnet_permv(v, idx ^ x);
+}
+
+/* Lane i takes lane i + x, wrapping around */
+static inline lr__sn32 lr__sortnet_rotate(lr__sn32 v, int32_t x) {
+    lr__sn32 idx = LR__SORTNET_IOTA32;
+    return lr__sortnet_permv(v, (idx + x) & (LR__SORTNET_BYTES / 4 - 1));
+}
+
+/* Compare-exchange: *a gets the lane-wise minimum, *b the maximum */
+static inline void lr__sortnet32_cmpx(lr__sn32* a, lr__sn32* b) {
+    lr__sn32 lo, hi;
+    __asm__ ("vpminsd %2, %1, %0" : "=" LR__SORTNET_REG (lo) : LR__SORTNET_REG (*a), LR__SORTNET_REG (*b));
+    __asm__ ("vpmaxsd %2, %1, %0" : "=" LR__SORTNET_REG (hi) : LR__SORTNET_REG (*a), LR__SORTNET_REG (*b));
+    *a = lo;
+    *b = hi;
+}
+
+static inline void lr__sortnet64_cmpx(lr__sn64* a, lr__sn64* b) {
+    lr__sn64 lo, hi;
+    #ifdef __AVX512F__
+    __asm__ ("vpminsq %2, %1, %0" : "=v" (lo) : "v" (*a), "v" (*b));
+    __asm__ ("vpmaxsq %2, %1, %0" : "=v" (hi) : "v" (*a), "v" (*b));
+    #else
+    /* No 64-bit min/max before AVX-512: compare and blend */
+    lr__sn64 gt;
+    __asm__ ("vpcmpgtq %2, %1, %0" : "=x" (gt) : "x" (*a), "x" (*b));
+    __asm__ ("vpblendvb %3, %2, %1, %0" : "=x" (lo) : "x" (*a), "x" (*b), "x" (gt));
+    __asm__ ("vpblendvb %3, %2, %1, %0" : "=x" (hi) : "x" (*b), "x" (*a), "x" (gt));
+    #endif
+    *a = lo;
+    *b = hi;
+}
+
+#define LR__SORTNET_DEFINE(w)                                                                                                    \
+static inline int##w##_t lr__sortnet##w##_key(uint##w##_t k, uint##w##_t sign, uint##w##_t neg) {                                \
+    const uint##w##_t top = (uint##w##_t)1 << (w - 1);                                                                           \
+    return (int##w##_t)(k ^ ((sign ^ top) | (neg & (0 - (k >> (w - 1))))));                                                      \
+}                                                                                                                                \
+                                                                                                                                 \
+/* The same mapping on a vector; it is its own inverse */                                                                        \
+static inline lr__sn##w lr__sortnet##w##_vkey(lr__sn##w v, uint##w##_t sign, uint##w##_t neg) {                                  \
+    const uint##w##_t top = (uint##w##_t)1 << (w - 1);                                                                           \
+    return v ^ ((int##w##_t)(sign ^ top) | ((int##w##_t)neg & (lr__sn##w)(v < 0)));                                              \
+}                                                                                                                                \
+                                                                                                                                 \
+static inline lr__sn##w lr__sortnet##w##_perm(lr__sn##w v, int x) {                                                              \
+    return (lr__sn##w)lr__sortnet_perm((lr__sn32)v, x * (w / 32));                                                               \
+}                                                                                                                                \
+                                                                                                                                 \
+/* Compare lane i with lane i ^ x; lanes with bit hb set keep the maximum */                                                     \
+static inline lr__sn##w lr__sortnet##w##_lanes(lr__sn##w v, int x, int hb) {                                                     \
+    lr__sn##w lo = v, hi = lr__sortnet##w##_perm(v, x), m = LR__SORTNET_IOTA##w;                                                 \
+    lr__sortnet##w##_cmpx(&lo, &hi);                                                                                             \
+    m = (lr__sn##w)((m & hb) != 0);                                                                                              \
+    return (lo & ~m) | (hi & m);                                                                                                 \
+}                                                                                                                                \
+                                                                                                                                 \
+/* Bitonic sort of k vectors as one sequence, lane-major within each.                                                            \
+ * Merging blocks of s compares i with i ^ (s - 1), then i with i ^ d                                                            \
+ * for d = s / 4 down to 1; partners in another vector line up lane for                                                          \
+ * lane except in the first step, which reverses one of them. */                                                                 \
+static inline void lr__sortnet##w##_run(lr__sn##w* v, size_t k) {                                                                \
+    const size_t lanes = LR__SORTNET_BYTES / (w / 8);                                                                            \
+    size_t s, d, r;                                                                                                              \
+                                                                                                                                 \
+    for (s = 2; s <= k * lanes; s *= 2) {                                                                                        \
+        if (s <= lanes) {                                                                                                        \
+            for (r = 0; r < k; r++) {                                                                                            \
+                v[r] = lr__sortnet##w##_lanes(v[r], (int)s - 1, (int)s / 2);                                                     \
+            }                                                                                                                    \
+        } else {                                                                                                                 \
+            size_t b = s / lanes;                                                                                                \
+            for (r = 0; r < k; r++) {                                                                                            \
+                if (!(r & (b / 2))) {                                                                                            \
+                    lr__sn##w hi = lr__sortnet##w##_perm(v[r ^ (b - 1)], (int)lanes - 1);                                        \
+                    lr__sortnet##w##_cmpx(&v[r], &hi);                                                                           \
+                    v[r ^ (b - 1)] = lr__sortnet##w##_perm(hi, (int)lanes - 1);                                                  \
+                }                                                                                                                \
+            }                                                                                                                    \
+        }                                                                                                                        \
+        for (d = s / 4; d > 0; d /= 2) {                                                                                         \
+            for (r = 0; r < k; r++) {                                                                                            \
+                if (d < lanes) {                                                                                                 \
+                    v[r] = lr__sortnet##w##_lanes(v[r], (int)d, (int)d);                                                         \
+                } else if (!(r & (d / lanes))) {                                                                                 \
+                    lr__sortnet##w##_cmpx(&v[r], &v[r + d / lanes]);                                                             \
+                }                                                                                                                \
+            }                                                                                                                    \
+        }                                                                                                                        \
+    }                                                                                                                            \
+}                                                                                                                                \
+                                                                                                                                 \
+/* Sort n <= LR_SORTNET_MAX##w keys ordered by lr__sortnet##w##_key() */                                                         \
+static inline void lr__sortnet##w(lr__rk##w* a, size_t n, uint##w##_t sign, uint##w##_t neg) {                                   \
+    const size_t lanes = LR__SORTNET_BYTES / (w / 8);                                                                            \
+    const size_t full = n / lanes, tail = n % lanes * (w / 8);                                                                   \
+    union {                                                                                                                      \
+        lr__sn##w v;                                                                                                             \
+        char c[LR__SORTNET_BYTES];                                                                                               \
+    } t;                                                                                                                         \
+    lr__sn##w v[8], max = { 0 };                                                                                                 \
+    size_t k = 1, r;                                                                                                             \
+                                                                                                                                 \
+    if (n < 2) {                                                                                                                 \
+        return;                                                                                                                  \
+    }                                                                                                                            \
+    while (k * lanes < n) {                                                                                                      \
+        k *= 2;                                                                                                                  \
+    }                                                                                                                            \
+    max += (int##w##_t)(((uint##w##_t)1 << (w - 1)) - 1);                                                                        \
+    for (r = 0; r < full; r++) {                                                                                                 \
+        __builtin_memcpy(&v[r], a + r * lanes, LR__SORTNET_BYTES);                                                               \
+        v[r] = lr__sortnet##w##_vkey(v[r], sign, neg);                                                                           \
+    }                                                                                                                            \
+    if (tail && full) {                                                                                                          \
+        /* Load the last lanes elements and rotate the tail down */                                                              \
+        lr__sn##w m = LR__SORTNET_IOTA##w;                                                                                       \
+        __builtin_memcpy(&t.v, a + n - lanes, LR__SORTNET_BYTES);                                                                \
+        t.v = (lr__sn##w)lr__sortnet_rotate((lr__sn32)t.v, (int32_t)(LR__SORTNET_BYTES - tail) / 4);                             \
+        m = (lr__sn##w)(m >= (int##w##_t)(n % lanes));                                                                           \
+        v[r++] = (lr__sortnet##w##_vkey(t.v, sign, neg) & ~m) | (max & m);                                                       \
+    } else if (tail) {                                                                                                           \
+        t.v = lr__sortnet##w##_vkey(max, sign, neg);                                                                             \
+        lr__sortnet_copy(t.c, (const char*)a, tail);                                                                             \
+        v[r++] = lr__sortnet##w##_vkey(t.v, sign, neg);                                                                          \
+    }                                                                                                                            \
+    for (; r < k; r++) {                                                                                                         \
+        v[r] = max;                                                                                                              \
+    }                                                                                                                            \
+    if (k == 1) {                                                                                                                \
+        lr__sortnet##w##_run(v, 1);                                                                                              \
+    } else if (k == 2) {                                                                                                         \
+        lr__sortnet##w##_run(v, 2);                                                                                              \
+    } else if (k == 4) {                                                                                                         \
+        lr__sortnet##w##_run(v, 4);                                                                                              \
+    } else {                                                                                                                     \
+        lr__sortnet##w##_run(v, 8);                                                                                              \
+    }                                                                                                                            \
+    if (tail && full) {                                                                                                          \
+        /* Rotate back and store first; the full vectors overwrite the overlap */                                                \
+        t.v = lr__sortnet##w##_vkey(v[full], sign, neg);                                                                         \
+        t.v = (lr__sn##w)lr__sortnet_rotate((lr__sn32)t.v, (int32_t)tail / 4);                                                   \
+        __builtin_memcpy(a + n - lanes, &t.v, LR__SORTNET_BYTES);                                                                \
+    } else if (tail) {                                                                                                           \
+        t.v = lr__sortnet##w##_vkey(v[0], sign, neg);                                                                            \
+        lr__sortnet_copy((char*)a, t.c, tail);                                                                                   \
+    }                                                                                                                            \
+    for (r = 0; r < full; r++) {                                                                                                 \
+        v[r] = lr__sortnet##w##_vkey(v[r], sign, neg);                                                                           \
+        __builtin_memcpy(a + r * lanes, &v[r], LR__SORTNET_BYTES);                                                               \
+    }                                                                                                                            \
+}
+
+/* Partial vectors, under LR__SORTNET_BYTES bytes */
+static inline void lr__sortnet_copy(char* d, const char* s, size_t n) {
+    if (n > 32) {
+        lr__out_short(d, s, 32, ~(size_t)0);
+        d += 32, s += 32, n -= 32;
+    }
+    lr__out_short(d, s, n, ~(size_t)0);
+}
+#else
+#define LR__SORTNET_DEFINE(w)                                                                                                    \
+static inline int##w##_t lr__sortnet##w##_key(uint##w##_t k, uint##w##_t sign, uint##w##_t neg) {                                \
+    const uint##w##_t top = (uint##w##_t)1 << (w - 1);                                                                           \
+    return (int##w##_t)(k ^ ((sign ^ top) | (neg & (0 - (k >> (w - 1))))));                                                      \
+}                                                                                                                                \
+                                                                                                                                 \
+static inline void lr__sortnet##w(lr__rk##w* a, size_t n, uint##w##_t sign, uint##w##_t neg) {                                   \
+    size_t i, j;                                                                                                                 \
+                                                                                                                                 \
+    for (i = 1; i < n; i++) {                                                                                                    \
+        uint##w##_t k = a[i];                                                                                                    \
+        int##w##_t x = lr__sortnet##w##_key(k, sign, neg);                                                                       \
+        for (j = i; j > 0 && x < lr__sortnet##w##_key(a[j - 1], sign, neg); j--) {                                               \
+            a[j] = a[j - 1];                                                                                                     \
+        }                                                                                                                        \
+        a[j] = k;                                                                                                                \
+    }                                                                                                                            \
+}
+#endif
+
+/* Keys as the sorts see them. The float sorts read their arrays through
+ * these, which may_alias keeps valid under GCC's type-based aliasing;
+ * other compilers get the plain integer types. */
+#ifdef __GNUC__
+typedef uint32_t lr__rk32 __attribute__((may_alias));
+typedef uint64_t lr__rk64 __attribute__((may_alias));
+#else
+typedef uint32_t lr__rk32;
+typedef uint64_t lr__rk64;
+#endif
+
+LR__SORTNET_DEFINE(32)
+LR__SORTNET_DEFINE(64)
+
+#define LR__SORTNET_TOP32 0x80000000u
+#define LR__SORTNET_TOP64 0x8000000000000000ull
+
+/* Typed sorts: pdqsort with the networks as leaves, so partitioning
+ * stops at ranges the networks sort whole */
+#define LR__SORTNET_TYPED(name, w, less, sign, neg)                                                                              \
+static inline void name##__leaf(lr__rk##w* a, lr__rk##w* end, int leftmost) {                                                    \
+    (void)leftmost;                                                                                                              \
+    lr__sortnet##w(a, (size_t)(end - a), sign, neg);                                                                             \
+}                                                                                                                                \
+                                                                                                                                 \
+LR__SORT_DEFINE(name, lr__rk##w, less, name##__leaf, LR_SORTNET_MAX##w + 1)
+
+#define LR__SORTNET_LESS_U(x, y) ((x) < (y))
+#define LR__SORTNET_LESS_I32(x, y) ((int32_t)(x) < (int32_t)(y))
+#define LR__SORTNET_LESS_I64(x, y) ((int64_t)(x) < (int64_t)(y))
+#define LR__SORTNET_LESS_F32(x, y) \
+    (lr__sortnet32_key(x, LR__SORTNET_TOP32, ~LR__SORTNET_TOP32) < lr__sortnet32_key(y, LR__SORTNET_TOP32, ~LR__SORTNET_TOP32))
+#define LR__SORTNET_LESS_F64(x, y) \
+    (lr__sortnet64_key(x, LR__SORTNET_TOP64, ~LR__SORTNET_TOP64) < lr__sortnet64_key(y, LR__SORTNET_TOP64, ~LR__SORTNET_TOP64))
+
+LR__SORTNET_TYPED(lr__sort_u32, 32, LR__SORTNET_LESS_U, 0, 0)
+LR__SORTNET_TYPED(lr__sort_i32, 32, LR__SORTNET_LESS_I32, LR__SORTNET_TOP32, 0)
+LR__SORTNET_TYPED(lr__sort_f32, 32, LR__SORTNET_LESS_F32, LR__SORTNET_TOP32, ~LR__SORTNET_TOP32)
+LR__SORTNET_TYPED(lr__sort_u64, 64, LR__SORTNET_LESS_U, 0, 0)
+LR__SORTNET_TYPED(lr__sort_i64, 64, LR__SORTNET_LESS_I64, LR__SORTNET_TOP64, 0)
+LR__SORTNET_TYPED(lr__sort_f64, 64, LR__SORTNET_LESS_F64, LR__SORTNET_TOP64, ~LR__SORTNET_TOP64)
+
+/* In-place, not stable. Floats are ordered as by the radix sorts: -0
+ * before +0, NaNs at the ends by sign. */
+static inline void sort_u32(uint32_t* a, size_t n) {
+    lr__sort_u32((lr__rk32*)a, n);
+}
+
+static inline void sort_i32(int32_t* a, size_t n) {
+    lr__sort_i32((lr__rk32*)a, n);
+}
+
+static inline void sort_f32(float* a, size_t n) {
+    lr__sort_f32((lr__rk32*)a, n);
+}
+
+static inline void sort_u64(uint64_t* a, size_t n) {
+    lr__sort_u64((lr__rk64*)a, n);
+}
+
+static inline void sort_i64(int64_t* a, size_t n) {
+    lr__sort_i64((lr__rk64*)a, n);
+}
+
+static inline void sort_f64(double* a, size_t n) {
+    lr__sort_f64((lr__rk64*)a, n);
+}
+
+/* Radix sorts: LSD over 8-bit digits with caller scratch of n elements
+ * (and n payloads). One pass over the keys counts every digit; passes
+ * where all keys share the digit are skipped. Large inputs scatter
+ * through a cache line per bucket, so each bucket's output is written a
+ * full line at a time instead of one element per store into 256 streams.
+ * Signed keys sort by flipping the sign bit; floats by flipping the sign
+ * bit of positives and all bits of negatives, which puts -0 before +0
+ * and NaNs at the ends by sign. Stable. */
+#define LR__RADIX_SMALL 48          /* Shorter inputs use insertion sort */
+#define LR__RADIX_WC    (1u << 20)  /* Longer key arrays scatter through line buffers */
+#define LR__RADIX_WC_KV (1u << 16)  /* With payloads, which double the output streams */
+#define LR__RADIX_LINE  64          /* Bytes buffered per bucket */
+
+/* Write out a full bucket line. Streaming stores skip reading each
+ * destination line first; out is a pass's output and only read back by
+ * the next pass. dst is line aligned only if the array is. */
+static inline void lr__radix_line(void* dst, const void* src) {
+    #ifdef LR_SIMD
+    if (((uintptr_t)dst & 15) == 0) {
+        char* d = (char*)dst;
+        const char* s = (const char*)src;
+        lr__v16_stream(d, lr__v16_load(s));
+        lr__v16_stream(d + 16, lr__v16_load(s + 16));
+        lr__v16_stream(d + 32, lr__v16_load(s + 32));
+        lr__v16_stream(d + 48, lr__v16_load(s + 48));
+        return;
+    }
+    #endif
+    LR__COPY_FIXED(dst, src, LR__RADIX_LINE);
+}
+
+static inline void lr__radix_fence(void) {
+    #ifdef LR_SIMD
+    lr__sfence();
+    #endif
+}
+
+#define LR__RADIX_DEFINE(w)                                                                                                      \
+static inline uint##w##_t lr__radix##w##_key(uint##w##_t k, uint##w##_t sign, uint##w##_t neg) {                                \
+    return k ^ (sign | (neg & (0 - (k >> (w - 1)))));                                                                            \
+}                                                                                                                                \
+                                                                                                                                 \
+static inline void lr__radix##w##_insertion(lr__rk##w* a, lr__rk##w* va, size_t n, uint##w##_t sign, uint##w##_t neg) {         \
+    size_t i, j;                                                                                                                 \
+                                                                                                                                 \
+    for (i = 1; i < n; i++) {                                                                                                    \
+        uint##w##_t k = a[i], v = va ? va[i] : 0, x = lr__radix##w##_key(k, sign, neg);                                          \
+        for (j = i; j > 0 && x < lr__radix##w##_key(a[j - 1], sign, neg); j--) {                                                 \
+            a[j] = a[j - 1];                                                                                                     \
+            if (va) {                                                                                                            \
+                va[j] = va[j - 1];                                                                                               \
+            }                                                                                                                    \
+        }                                                                                                                        \
+        a[j] = k;                                                                                                                \
+        if (va) {                                                                                                                \
+            va[j] = v;                                                                                                           \
+        }                                                                                                                        \
+    }                                                                                                                            \
+}                                                                                                                                \
+                                                                                                                                 \
+/* Scatter by the digit at shift, element by element */                                                                        \
+static inline void lr__radix##w##_scatter(const lr__rk##w* a, const lr__rk##w* va, lr__rk##w* out, lr__rk##w* vout,             \
+                                          size_t n, size_t* off, int shift, uint##w##_t sign, uint##w##_t neg) {                \
+    size_t i;                                                                                                                    \
+                                                                                                                                 \
+    if (va) {                                                                                                                    \
+        for (i = 0; i < n; i++) {                                                                                                \
+            size_t p = off[(lr__radix##w##_key(a[i], sign, neg) >> shift) & 255]++;                                              \
+            out[p] = a[i];                                                                                                       \
+            vout[p] = va[i];                                                                                                     \
+        }                                                                                                                        \
+    } else {                                                                                                                     \
+        for (i = 0; i < n; i++) {                                                                                                \
+            out[off[(lr__radix##w##_key(a[i], sign, neg) >> shift) & 255]++] = a[i];                                             \
+        }                                                                                                                        \
+    }                                                                                                                            \
+}                                                                                                                                \
+                                                                                                                                 \
+/* Scatter through a line buffer per bucket. Slots follow the output's                                                           \
+ * address, so after a bucket's first line every flush is one aligned                                                            \
+ * line (payload lines follow the key slots and may straddle). */                                                                \
+static inline void lr__radix##w##_scatter_wc(const lr__rk##w* a, const lr__rk##w* va, lr__rk##w* out, lr__rk##w* vout,          \
+                                             size_t n, size_t* off, int shift, uint##w##_t sign, uint##w##_t neg) {             \
+    enum { L = LR__RADIX_LINE / (w / 8) };                                                                                       \
+    uint##w##_t kb[256][L] LR__ALIGNED(LR__RADIX_LINE);                                                                          \
+    uint##w##_t vb[256][L] LR__ALIGNED(LR__RADIX_LINE);                                                                          \
+    size_t first[256], i, b;                                                                                                     \
+    const size_t o = (size_t)((uintptr_t)out / (w / 8));                                                                         \
+                                                                                                                                 \
+    for (b = 0; b < 256; b++) {                                                                                                  \
+        first[b] = off[b];                                                                                                       \
+    }                                                                                                                            \
+    for (i = 0; i < n; i++) {                                                                                                    \
+        uint##w##_t k = a[i];                                                                                                    \
+        size_t p, s;                                                                                                             \
+        b = (lr__radix##w##_key(k, sign, neg) >> shift) & 255;                                                                   \
+        p = off[b]++;                                                                                                            \
+        s = (p + o) & (L - 1);                                                                                                   \
+        kb[b][s] = k;                                                                                                            \
+        if (va) {                                                                                                                \
+            vb[b][s] = va[i];                                                                                                    \
+        }                                                                                                                        \
+        if (s == L - 1) {                                                                                                        \
+            size_t f = first[b];                                                                                                 \
+            if (p + 1 - f == L) {                                                                                                \
+                lr__radix_line(out + f, kb[b]);                                                                                  \
+                if (va) {                                                                                                        \
+                    lr__radix_line(vout + f, vb[b]);                                                                             \
+                }                                                                                                                \
+            } else {                                                                                                             \
+                memcpy(out + f, &kb[b][L - (p + 1 - f)], (p + 1 - f) * (w / 8));                                                 \
+                if (va) {                                                                                                        \
+                    memcpy(vout + f, &vb[b][L - (p + 1 - f)], (p + 1 - f) * (w / 8));                                            \
+                }                                                                                                                \
+            }                                                                                                                    \
+            first[b] = p + 1;                                                                                                    \
+        }                                                                                                                        \
+    }                                                                                                                            \
+    for (b = 0; b < 256; b++) {                                                                                                  \
+        size_t f = first[b], c = off[b] - f;                                                                                     \
+        if (c) {                                                                                                                 \
+            size_t s = (f + o) & (L - 1);                                                                                        \
+            memcpy(out + f, &kb[b][s], c * (w / 8));                                                                             \
+            if (va) {                                                                                                            \
+                memcpy(vout + f, &vb[b][s], c * (w / 8));                                                                        \
+            }                                                                                                                    \
+        }                                                                                                                        \
+    }                                                                                                                            \
+    lr__radix_fence();                                                                                                           \
+}                                                                                                                                \
+                                                                                                                                 \
+static inline void lr__radix##w(lr__rk##w* a, lr__rk##w* va, size_t n, lr__rk##w* ta, lr__rk##w* tv,                          \
+                                uint##w##_t sign, uint##w##_t neg) {                                                             \
+    size_t hist[w / 8][256], off[256], i, b, sum;                                                                                \
+    lr__rk##w* src = a;                                                                                                          \
+    lr__rk##w* dst = ta;                                                                                                         \
+    lr__rk##w* vsrc = va;                                                                                                        \
+    lr__rk##w* vdst = tv;                                                                                                        \
+    int d;                                                                                                                       \
+                                                                                                                                 \
+    if (!va && n <= LR_SORTNET_MAX##w) {                                                                                         \
+        lr__sortnet##w(a, n, sign, neg);                                                                                         \
+        return;                                                                                                                  \
+    }                                                                                                                            \
+    if (n < LR__RADIX_SMALL) {                                                                                                   \
+        lr__radix##w##_insertion(a, va, n, sign, neg);                                                                           \
+        return;                                                                                                                  \
+    }                                                                                                                            \
+    memset(hist, 0, sizeof hist);                                                                                                \
+    for (i = 0; i < n; i++) {                                                                                                    \
+        uint64_t k = lr__radix##w##_key(a[i], sign, neg);                                                                        \
+        hist[0][k & 255]++;                                                                                                      \
+        hist[1][k >> 8 & 255]++;                                                                                                 \
+        hist[2][k >> 16 & 255]++;                                                                                                \
+        hist[3][k >> 24 & 255]++;                                                                                                \
+        if (w == 64) {                                                                                                           \
+            hist[w / 16][k >> 32 & 255]++;                                                                                       \
+            hist[w / 16 + 1][k >> 40 & 255]++;                                                                                   \
+            hist[w / 16 + 2][k >> 48 & 255]++;                                                                                   \
+            hist[w / 16 + 3][k >> 56]++;                                                                                         \
+        }                                                                                                                        \
+    }                                                                                                                            \
+    for (d = 0; d < w / 8; d++) {                                                                                                \
+        lr__rk##w* t;                                                                                                            \
+        if (hist[d][(lr__radix##w##_key(a[0], sign, neg) >> 8 * d) & 255] == n) {                                                \
+            continue;                                                                                                            \
+        }                                                                                                                        \
+        for (b = 0, sum = 0; b < 256; b++) {                                                                                     \
+            off[b] = sum;                                                                                                        \
+            sum += hist[d][b];                                                                                                   \
+        }                                                                                                                        \
+        if (n >= (va ? LR__RADIX_WC_KV : LR__RADIX_WC)) {                                                                        \
+            lr__radix##w##_scatter_wc(src, vsrc, dst, vdst, n, off, 8 * d, sign, neg);                                           \
+        } else {                                                                                                                 \
+            lr__radix##w##_scatter(src, vsrc, dst, vdst, n, off, 8 * d, sign, neg);                                              \
+        }                                                                                                                        \
+        t = src, src = dst, dst = t;                                                                                             \
+        t = vsrc, vsrc = vdst, vdst = t;                                                                                         \
+    }                                                                                                                            \
+    if (src != a) {                                                                                                              \
+        memcpy(a, src, n * (w / 8));                                                                                             \
+        if (va) {                                                                                                                \
+            memcpy(va, vsrc, n * (w / 8));                                                                                       \
+        }                                                                                                                        \
+    }                                                                                                                            \
+}
+
+LR__RADIX_DEFINE(32)
+LR__RADIX_DEFINE(64)
+
+#define LR__RADIX_TOP32 0x80000000u
+#define LR__RADIX_TOP64 0x8000000000000000ull
+
+/* Keys only; scratch holds n keys */
+static inline void radix_sort_u32(uint32_t* a, size_t n, uint32_t* scratch) {
+    lr__radix32(a, 0, n, scratch, 0, 0, 0);
+}
+
+static inline void radix_sort_i32(int32_t* a, size_t n, int32_t* scratch) {
+    lr__radix32((lr__rk32*)a, 0, n, (lr__rk32*)scratch, 0, LR__RADIX_TOP32, 0);
+}
+
+static inline void radix_sort_f32(float* a, size_t n, float* scratch) {
+    lr__radix32((lr__rk32*)a, 0, n, (lr__rk32*)scratch, 0, LR__RADIX_TOP32, ~LR__RADIX_TOP32);
+}
+
+static inline void radix_sort_u64(uint64_t* a, size_t n, uint64_t* scratch) {
+    lr__radix64(a, 0, n, scratch, 0, 0, 0);
+}
+
+static inline void radix_sort_i64(int64_t* a, size_t n, int64_t* scratch) {
+    lr__radix64((lr__rk64*)a, 0, n, (lr__rk64*)scratch, 0, LR__RADIX_TOP64, 0);
+}
+
+static inline void radix_sort_f64(double* a, size_t n, double* scratch) {
+    lr__radix64((lr__rk64*)a, 0, n, (lr__rk64*)scratch, 0, LR__RADIX_TOP64, ~LR__RADIX_TOP64);
+}
+
+/* Keys with a payload array moved alongside (a value or an index into
+ * the records); each scratch array holds n elements */
+static inline void radix_sort_kv_u32(uint32_t* keys, uint32_t* vals, size_t n, uint32_t* key_scratch, uint32_t* val_scratch) {
+    lr__radix32(keys, vals, n, key_scratch, val_scratch, 0, 0);
+}
+
+static inline void radix_sort_kv_i32(int32_t* keys, uint32_t* vals, size_t n, int32_t* key_scratch, uint32_t* val_scratch) {
+    lr__radix32((lr__rk32*)keys, vals, n, (lr__rk32*)key_scratch, val_scratch, LR__RADIX_TOP32, 0);
+}
+
+static inline void radix_sort_kv_f32(float* keys, uint32_t* vals, size_t n, float* key_scratch, uint32_t* val_scratch) {
+    lr__radix32((lr__rk32*)keys, vals, n, (lr__rk32*)key_scratch, val_scratch, LR__RADIX_TOP32, ~LR__RADIX_TOP32);
+}
+
+static inline void radix_sort_kv_u64(uint64_t* keys, uint64_t* vals, size_t n, uint64_t* key_scratch, uint64_t* val_scratch) {
+    lr__radix64(keys, vals, n, key_scratch, val_scratch, 0, 0);
+}
+
+static inline void radix_sort_kv_i64(int64_t* keys, uint64_t* vals, size_t n, int64_t* key_scratch, uint64_t* val_scratch) {
+    lr__radix64((lr__rk64*)keys, vals, n, (lr__rk64*)key_scratch, val_scratch, LR__RADIX_TOP64, 0);
+}
+
+static inline void radix_sort_kv_f64(double* keys, uint64_t* vals, size_t n, double* key_scratch, uint64_t* val_scratch) {
+    lr__radix64((lr__rk64*)keys, vals, n, (lr__rk64*)key_scratch, val_scratch, LR__RADIX_TOP64, ~LR__RADIX_TOP64);
+}
+
+/* String sorting: multikey quicksort (Bentley-Sedgewick) with 8-byte
+ * characters. Each pass loads the next 8 bytes of every string in the
+ * range as one big-endian word, zero from the terminator on, and splits
+ * the range three ways on it, so a shared prefix costs one compare per
+ * 8 bytes. The equal part goes on 8 bytes deeper unless its word holds
+ * the terminator. Ranges that fit in a stack cache of words are sorted
+ * on the cached words, so a string is then only read again to go
+ * deeper instead of once per pass. */
+#define LR__STRSORT_INSERTION 12    /* Shorter ranges use insertion sort */
+#define LR__STRSORT_CACHE     2048  /* Words cached for ranges this long */
+#define LR__STRSORT_AHEAD     16    /* Strings prefetched this far ahead in a scan */
+
+static inline uint64_t lr__bswap64(uint64_t x) {
+    #ifdef __x86_64__
+    __asm__ ("bswap %0" : "+r" (x));
+    return x;
+    #else
+    x = (x & 0x00FF00FF00FF00FFULL) << 8 | (x >> 8 & 0x00FF00FF00FF00FFULL);
+    x = (x & 0x0000FFFF0000FFFFULL) << 16 | (x >> 16 & 0x0000FFFF0000FFFFULL);
+    return x << 32 | x >> 32;
+    #endif
+}
+
+/* Bytes s[0..7] as a big-endian word, cut at the terminator */
+static inline uint64_t lr__strsort_key(const char* s) {
+    uint64_t w = 0;
+    int i;
+    
+    #ifdef __x86_64__
+    /* One load past the terminator, which is only defined outside C; it
+     * stays within the page, so it cannot fault */
+    if (((uintptr_t)s & 4095) <= 4096 - 8) {
+        uint64_t z;
+        
+        __asm__ ("movq %1, %0" : "=r" (w) : "m" (*(const char (*)[8])s));
+        z = (w - 0x0101010101010101ULL) & ~w & 0x8080808080808080ULL;
+        if (z) {
+            w &= (z & (0 - z)) - 1;
+        }
+        return lr__bswap64(w);
+    }
+    #endif
+    for (i = 0; i < 8 && s[i]; i++) {
+        w |= (uint64_t)(unsigned char)s[i] << 8 * i;
+    }
+    return lr__bswap64(w);
+}
+
+/* Hint that the line at p is needed soon; never faults */
+static inline void lr__prefetch(const void* p) {
+    #ifdef __x86_64__
+    __asm__ ("prefetcht0 %0" : : "m" (*(const char*)p));
+    #else
+    (void)p;
+    #endif
+}
+
+static inline void lr__strsort_swap(char** a, char** b) {
+    char* t = *a;
+    *a = *b;
+    *b = t;
+}
+
+static inline int lr__strsort_less(const char* a, const char* b, size_t depth) {
+    for (;; depth += 8) {
+        uint64_t ka = lr__strsort_key(a + depth), kb = lr__strsort_key(b + depth);
+        if (ka != kb) {
+            return ka < kb;
+        }
+        if (!(ka & 255)) {
+            return 0;
+        }
+    }
+}
+
+static inline uint64_t lr__strsort_median3(uint64_t x, uint64_t y, uint64_t z) {
+    if (x > y) {
+        uint64_t t = x;
+        x = y, y = t;
+    }
+    return z < x ? x : z > y ? y : z;
+}
+
+/* Pivot word: median of 3, or of 3 medians of 3 for long ranges */
+static inline uint64_t lr__strsort_pivot(char** a, const uint64_t* k, size_t n, size_t depth) {
+    size_t e = n / 8, i, at[9];
+    uint64_t w[9];
+    
+    if (n > LR__SORT_NINTHER) {
+        for (i = 0; i < 8; i++) {
+            at[i] = i * e;
+        }
+        at[8] = n - 1;
+    } else {
+        at[0] = 0, at[1] = n / 2, at[2] = n - 1;
+    }
+    for (i = 0; i < (n > LR__SORT_NINTHER ? 9u : 3u); i++) {
+        w[i] = k ? k[at[i]] : lr__strsort_key(a[at[i]] + depth);
+    }
+    if (n > LR__SORT_NINTHER) {
+        return lr__strsort_median3(lr__strsort_median3(w[0], w[1], w[2]), lr__strsort_median3(w[3], w[4], w[5]),
+                                   lr__strsort_median3(w[6], w[7], w[8]));
+    }
+    return lr__strsort_median3(w[0], w[1], w[2]);
+}
+
+/* Strings sharing their first depth bytes, with k[i] the next word of
+ * a[i]: on the cached words */
+static inline void lr__strsort_cached(char** a, uint64_t* k, size_t n, size_t depth) {
+    size_t i, j;
+    
+    while (n >= LR__STRSORT_INSERTION) {
+        size_t lt = 0, gt = n, ln, en, rn;
+        uint64_t p = lr__strsort_pivot(a, k, n, depth);
+        
+        i = 0;
+        while (i < gt) {
+            uint64_t x = k[i];
+            if (x < p) {
+                lr__strsort_swap(&a[lt], &a[i]);
+                k[i++] = k[lt];
+                k[lt++] = x;
+            } else if (x > p) {
+                lr__strsort_swap(&a[i], &a[--gt]);
+                k[i] = k[gt];
+                k[gt] = x;
+            } else {
+                i++;
+            }
+        }
+        
+        ln = lt;
+        en = (p & 255) ? gt - lt : 0;
+        rn = n - gt;
+        for (j = lt; j < lt + en; j++) {
+            if (j + LR__STRSORT_AHEAD < lt + en) {
+                lr__prefetch(a[j + LR__STRSORT_AHEAD] + depth + 8);
+            }
+            k[j] = lr__strsort_key(a[j] + depth + 8);
+        }
+        if (ln >= en && ln >= rn) {
+            lr__strsort_cached(a + lt, k + lt, en, depth + 8);
+            lr__strsort_cached(a + gt, k + gt, rn, depth);
+            n = ln;
+        } else if (rn >= en) {
+            lr__strsort_cached(a, k, ln, depth);
+            lr__strsort_cached(a + lt, k + lt, en, depth + 8);
+            a += gt, k += gt;
+            n = rn;
+        } else {
+            lr__strsort_cached(a, k, ln, depth);
+            lr__strsort_cached(a + gt, k + gt, rn, depth);
+            a += lt, k += lt;
+            n = en;
+            depth += 8;
+        }
+    }
+    for (i = 1; i < n; i++) {
+        char* s = a[i];
+        uint64_t x = k[i];
+        for (j = i; j > 0 && (x < k[j - 1] || (x == k[j - 1] && (x & 255) && lr__strsort_less(s, a[j - 1], depth + 8))); j--) {
+            a[j] = a[j - 1];
+            k[j] = k[j - 1];
+        }
+        a[j] = s;
+        k[j] = x;
+    }
+}
+
+/* Recursion only enters the two smaller parts, so its depth is at most
+ * log2(n); the loop continues with the largest */
+static inline void lr__strsort(char** a, size_t n, size_t depth, uint64_t* cache) {
+    size_t i;
+    
+    while (n > LR__STRSORT_CACHE) {
+        size_t lt = 0, gt = n, ln, en, rn;
+        uint64_t p = lr__strsort_pivot(a, 0, n, depth);
+        
+        i = 0;
+        /* a[0, lt) < p, a[lt, i) == p, a[gt, n) > p */
+        while (i < gt) {
+            uint64_t k;
+            if (gt - i > LR__STRSORT_AHEAD) {
+                lr__prefetch(a[i + LR__STRSORT_AHEAD] + depth);
+                lr__prefetch(a[gt - LR__STRSORT_AHEAD] + depth);
+            }
+            k = lr__strsort_key(a[i] + depth);
+            if (k < p) {
+                lr__strsort_swap(&a[lt++], &a[i++]);
+            } else if (k > p) {
+                lr__strsort_swap(&a[i], &a[--gt]);
+            } else {
+                i++;
+            }
+        }
+        
+        ln = lt;
+        en = (p & 255) ? gt - lt : 0;
+        rn = n - gt;
+        if (ln >= en && ln >= rn) {
+            lr__strsort(a + lt, en, depth + 8, cache);
+            lr__strsort(a + gt, rn, depth, cache);
+            n = ln;
+        } else if (rn >= en) {
+            lr__strsort(a, ln, depth, cache);
+            lr__strsort(a + lt, en, depth + 8, cache);
+            a += gt;
+            n = rn;
+        } else {
+            lr__strsort(a, ln, depth, cache);
+            lr__strsort(a + gt, rn, depth, cache);
+            a += lt;
+            n = en;
+            depth += 8;
+        }
+    }
+    for (i = 0; i < n; i++) {
+        if (i + LR__STRSORT_AHEAD < n) {
+            lr__prefetch(a[i + LR__STRSORT_AHEAD] + depth);
+        }
+        cache[i] = lr__strsort_key(a[i] + depth);
+    }
+    lr__strsort_cached(a, cache, n, depth);
+}
+
+/* Sort NUL-terminated strings into strcmp() order (unsigned bytes).
+ * Not stable; equal strings keep no particular order. */
+static inline void strsort(char** strs, size_t n) {
+    uint64_t cache[LR__STRSORT_CACHE];
+    
+    lr__strsort(strs, n, 0, cache);
+}
+
+/* Searching sorted arrays */
+
+/* Any element equal to *key, or NULL. Each level halves the range with
+ * a mask rather than a branch and prefetches both possible next probes;
+ * log2(n) + 1 comparisons. */
+static inline void* bsearch(const void* key, const void* base, size_t n, size_t size,
+                            int (*cmp)(const void*, const void*)) {
+    const unsigned char* p = (const unsigned char*)base;
+    
+    if (n == 0) {
+        return NULL;
+    }
+    while (n > 1) {
+        size_t half = n / 2, rest = n - half, m;
+        lr__prefetch(p + rest / 2 * size);
+        lr__prefetch(p + (half + rest / 2) * size);
+        m = 0 - (size_t)(cmp(key, p + half * size) >= 0);
+        p += half * size & m;
+        n = rest;
+    }
+    return cmp(key, p) == 0 ? (void*)p : NULL;
+}
+
+/* Typed lower bound: LR_LOWER_BOUND_DEFINE(name, T, less) defines
+ * size_t name(const T* a, size_t n, T key), the index of the first
+ * element of the sorted a[0, n) that is not less than key, or n.
+ * Branchless, with the two possible next probes prefetched each level,
+ * so the loads of a large array overlap instead of waiting on a
+ * mispredicted compare. */
+#define LR_LOWER_BOUND_DEFINE(name, T, less)                                                                                     \
+static inline size_t name(const T* a, size_t n, T key) {                                                                         \
+    const T* p = a;                                                                                                              \
+                                                                                                                                 \
+    if (n == 0) {                                                                                                                \
+        return 0;                                                                                                                \
+    }                                                                                                                            \
+    while (n > 1) {                                                                                                              \
+        size_t half = n / 2, rest = n - half;                                                                                    \
+        lr__prefetch(p + rest / 2);                                                                                              \
+        lr__prefetch(p + half + rest / 2);                                                                                       \
+        p += half & (0 - (size_t)(less(p[half], key)));                                                                          \
+        n = rest;                                                                                                                \
+    }                                                                                                                            \
+    return (size_t)(p - a) + (less(*p, key) ? 1 : 0);                                                                            \
+}
+
+/* Eytzinger layout: a sorted array stored as an implicit search tree in
+ * breadth-first order, e[1] the root and e[2k], e[2k + 1] the children
+ * of e[k]. A search walks one root-to-leaf path whose top levels stay
+ * cached, and the descendants of e[k] four levels down (three for
+ * 8-byte keys) fill one 64-byte line when e is 64-byte aligned, so one
+ * prefetch per level runs that far ahead.
+ *
+ * eytzinger_build() lays out n elements of any size into out[1..n];
+ * out[0] is unused. Laying out a payload array with the same n keeps
+ * each payload at its key's index. */
+static inline void eytzinger_build(void* out, const void* sorted, size_t n, size_t size) {
+    unsigned char* o = (unsigned char*)out;
+    const unsigned char* s = (const unsigned char*)sorted;
+    size_t k = 1;
+    
+    if (n == 0) {
+        return;
+    }
+    /* In-order walk: leftmost node first, then successors */
+    while (2 * k <= n) {
+        k *= 2;
+    }
+    for (;;) {
+        lr__sort_copy(o + k * size, s, size);
+        s += size;
+        if (2 * k + 1 <= n) {
+            k = 2 * k + 1;
+            while (2 * k <= n) {
+                k *= 2;
+            }
+        } else {
+            while (k & 1) {
+                k >>= 1;
+            }
+            k >>= 1;
+            if (k == 0) {
+                return;
+            }
+        }
+    }
+}
+
+/* LR_EYTZINGER_DEFINE(name, T, less) defines size_t name(const T* e,
+ * size_t n, T key): the index in e of the first element not less than
+ * key, or 0 if there is none. The descent ends below a leaf; the answer
+ * is the last node where it went left, found by dropping the right
+ * turns (trailing ones) and that left turn. */
+#define LR_EYTZINGER_DEFINE(name, T, less)                                                                                       \
+static inline size_t name(const T* e, size_t n, T key) {                                                                         \
+    size_t k = 1;                                                                                                                \
+                                                                                                                                 \
+    while (k <= n) {                                                                                                             \
+        lr__prefetch((const void*)((uintptr_t)e + k * 64));                                                                      \
+        k = 2 * k + (less(e[k], key) ? 1 : 0);                                                                                   \
+    }                                                                                                                            \
+    return k >> ffsll((long long)~k);                                                                                            \
+}
+
+#define LR__SEARCH_LESS(x, y) ((x) < (y))
+#define LR__SEARCH_LESS_F32(x, y) (lr__search_f32(x) < lr__search_f32(y))
+#define LR__SEARCH_LESS_F64(x, y) (lr__search_f64(x) < lr__search_f64(y))
+
+/* Floats compare in the order sort_f32() and sort_f64() leave them */
+static inline int32_t lr__search_f32(float x) {
+    union {
+        float f;
+        uint32_t u;
+    } b;
+    b.f = x;
+    return lr__sortnet32_key(b.u, LR__SORTNET_TOP32, ~LR__SORTNET_TOP32);
+}
+
+static inline int64_t lr__search_f64(double x) {
+    union {
+        double f;
+        uint64_t u;
+    } b;
+    b.f = x;
+    return lr__sortnet64_key(b.u, LR__SORTNET_TOP64, ~LR__SORTNET_TOP64);
+}
+
+LR_LOWER_BOUND_DEFINE(lower_bound_u32, uint32_t, LR__SEARCH_LESS)
+LR_LOWER_BOUND_DEFINE(lower_bound_i32, int32_t, LR__SEARCH_LESS)
+LR_LOWER_BOUND_DEFINE(lower_bound_f32, float, LR__SEARCH_LESS_F32)
+LR_LOWER_BOUND_DEFINE(lower_bound_u64, uint64_t, LR__SEARCH_LESS)
+LR_LOWER_BOUND_DEFINE(lower_bound_i64, int64_t, LR__SEARCH_LESS)
+LR_LOWER_BOUND_DEFINE(lower_bound_f64, double, LR__SEARCH_LESS_F64)
+
+LR_EYTZINGER_DEFINE(eytzinger_search_u32, uint32_t, LR__SEARCH_LESS)
+LR_EYTZINGER_DEFINE(eytzinger_search_i32, int32_t, LR__SEARCH_LESS)
+LR_EYTZINGER_DEFINE(eytzinger_search_f32, float, LR__SEARCH_LESS_F32)
+LR_EYTZINGER_DEFINE(eytzinger_search_u64, uint64_t, LR__SEARCH_LESS)
+LR_EYTZINGER_DEFINE(eytzinger_search_i64, int64_t, LR__SEARCH_LESS)
+LR_EYTZINGER_DEFINE(eytzinger_search_f64, double, LR__SEARCH_LESS_F64)
+
+/* Sorted sets and merging. intersect/union/difference take strictly
+ * increasing arrays and write the result, also strictly increasing, to
+ * out, which must not overlap the inputs; they return its length. out
+ * needs room for min(na, nb), na + nb and na elements respectively.
+ * Inputs of similar length are compared a block of 4 against a block of
+ * 4, all 16 pairs at once (Schlegel et al.); when one is over
+ * LR__SET_GALLOP times longer, each element of the short one is found
+ * in the long one by galloping from the previous position. */
+#define LR__SET_GALLOP 32
+
+/* First index at or after j with b[index] >= x: doubling steps from j,
+ * then a lower bound within the last step */
+static inline size_t lr__set_gallop(const uint32_t* b, size_t nb, size_t j, uint32_t x) {
+    size_t lo = j, step = 1, hi;
+    
+    if (j >= nb || b[j] >= x) {
+        return j;
+    }
+    while (lo + step < nb && b[lo + step] < x) {
+        lo += step;
+        step *= 2;
+    }
+    hi = lo + step < nb ? lo + step : nb;
+    return lo + 1 + lower_bound_u32(b + lo + 1, hi - lo - 1, x);
+}
+
+#ifdef LR_SIMD
+/* Lanes of v selected by the 4-bit mask m, packed to the front */
+static inline size_t lr__set_emit(uint32_t* out, size_t k, size_t cap, lr__v16 v, unsigned m) {
+    #ifdef __SSSE3__
+    static const unsigned char pack[16][16] = {
+        { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+        { 0x00, 0x01, 0x02, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+        { 0x04, 0x05, 0x06, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+        { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+        { 0x08, 0x09, 0x0a, 0x0b, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+        { 0x00, 0x01, 0x02, 0x03, 0x08, 0x09, 0x0a, 0x0b, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+        { 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+        { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x80, 0x80, 0x80, 0x80 },
+        { 0x0c, 0x0d, 0x0e, 0x0f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+        { 0x00, 0x01, 0x02, 0x03, 0x0c, 0x0d, 0x0e, 0x0f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+        { 0x04, 0x05, 0x06, 0x07, 0x0c, 0x0d, 0x0e, 0x0f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+        { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x0c, 0x0d, 0x0e, 0x0f, 0x80, 0x80, 0x80, 0x80 },
+        { 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+        { 0x00, 0x01, 0x02, 0x03, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x80, 0x80, 0x80, 0x80 },
+        { 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x80, 0x80, 0x80, 0x80 },
+        { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f }
+    };
+    if (k + 4 <= cap) {
+        lr__v16_store(out + k, lr__v16_shuffle(v, lr__v16_load(pack[m])));
+        return k + (size_t)__builtin_popcount(m);
+    }
+    #else
+    (void)cap;
+    #endif
+    {
+        uint32_t t[4];
+        lr__v16_store(t, v);
+        for (; m; m &= m - 1) {
+            out[k++] = t[__builtin_ctz(m)];
+        }
+    }
+    return k;
+}
+
+/* Blocks of 4 from both sides while both have them. Each block of a is
+ * retired once the block of b reaches its maximum; m collects which of
+ * its lanes matched any b seen so far, and keep selects whether matched
+ * (intersection) or unmatched (difference) lanes are written. On
+ * return a[*pi] starts a block with matches *pm, or *pm is 0. */
+static inline size_t lr__set_blocks(const uint32_t* a, size_t na, const uint32_t* b, size_t nb, uint32_t* out,
+                                    size_t cap, int keep, size_t* pi, size_t* pj, unsigned* pm) {
+    size_t i = 0, j = 0, k = 0;
+    unsigned m = 0;
+    
+    if (na >= 4 && nb >= 4) {
+        lr__v16 va = lr__v16_load(a), vb = lr__v16_load(b);
+        for (;;) {
+            uint32_t amax = a[i + 3], bmax = b[j + 3];
+            lr__v16 r = lr__v16_rotate32(vb);
+            lr__v16 e = lr__v16_cmpeq32(va, vb) | lr__v16_cmpeq32(va, r);
+            r = lr__v16_rotate32(r);
+            e |= lr__v16_cmpeq32(va, r);
+            e |= lr__v16_cmpeq32(va, lr__v16_rotate32(r));
+            m |= lr__v16_movemask32(e);
+            if (amax <= bmax) {
+                k = lr__set_emit(out, k, cap, va, keep ? m : ~m & 15);
+                m = 0;
+                i += 4;
+                if (i + 4 > na) {
+                    if (amax == bmax) {
+                        j += 4;
+                    }
+                    break;
+                }
+                va = lr__v16_load(a + i);
+            }
+            if (bmax <= amax) {
+                j += 4;
+                if (j + 4 > nb) {
+                    break;
+                }
+                vb = lr__v16_load(b + j);
+            }
+        }
+    }
+    *pi = i, *pj = j, *pm = m;
+    return k;
+}
+#endif
+
+static inline size_t intersect_u32(const uint32_t* a, size_t na, const uint32_t* b, size_t nb, uint32_t* out) {
+    size_t i = 0, j = 0, k = 0;
+    unsigned m = 0;
+    
+    if (na > nb) {
+        const uint32_t* t = a;
+        size_t n = na;
+        a = b, na = nb;
+        b = t, nb = n;
+    }
+    if (nb / LR__SET_GALLOP > na) {
+        for (; i < na; i++) {
+            j = lr__set_gallop(b, nb, j, a[i]);
+            if (j == nb) {
+                break;
+            }
+            if (b[j] == a[i]) {
+                out[k++] = a[i];
+            }
+        }
+        return k;
+    }
+    #ifdef LR_SIMD
+    k = lr__set_blocks(a, na, b, nb, out, na, 1, &i, &j, &m);
+    #endif
+    /* Scalar merge; the first lanes may already have matched */
+    while (i < na && j < nb) {
+        uint32_t x = a[i], y = b[j];
+        if (x == y || (m & 1)) {
+            out[k++] = x;
+        }
+        i += x <= y || (m & 1);
+        j += y <= x;
+        m >>= x <= y || (m & 1);
+    }
+    for (; i < na && m; i++, m >>= 1) {
+        if (m & 1) {
+            out[k++] = a[i];
+        }
+    }
+    return k;
+}
+
+/* Elements of a not in b */
+static inline size_t difference_u32(const uint32_t* a, size_t na, const uint32_t* b, size_t nb, uint32_t* out) {
+    size_t i = 0, j = 0, k = 0;
+    unsigned m = 0;
+    
+    if (nb / LR__SET_GALLOP > na) {
+        for (; i < na; i++) {
+            j = lr__set_gallop(b, nb, j, a[i]);
+            if (j == nb || b[j] != a[i]) {
+                out[k++] = a[i];
+            }
+        }
+        return k;
+    }
+    if (na / LR__SET_GALLOP > nb) {
+        /* Copy the runs of a between elements of b */
+        for (; j < nb; j++) {
+            size_t p = lr__set_gallop(a, na, i, b[j]);
+            lr__sort_copy((unsigned char*)(out + k), (const unsigned char*)(a + i), (p - i) * 4);
+            k += p - i;
+            i = p + (p < na && a[p] == b[j]);
+        }
+        lr__sort_copy((unsigned char*)(out + k), (const unsigned char*)(a + i), (na - i) * 4);
+        return k + (na - i);
+    }
+    #ifdef LR_SIMD
+    k = lr__set_blocks(a, na, b, nb, out, na, 0, &i, &j, &m);
+    #endif
+    while (i < na && j < nb) {
+        uint32_t x = a[i], y = b[j];
+        int skip = x == y || (m & 1);
+        if (x < y && !skip) {
+            out[k++] = x;
+        }
+        i += x <= y || skip;
+        j += y <= x;
+        m >>= x <= y || skip;
+    }
+    for (; i < na; i++, m >>= 1) {
+        if (!(m & 1)) {
+            out[k++] = a[i];
+        }
+    }
+    return k;
+}
+
+static inline size_t union_u32(const uint32_t* a, size_t na, const uint32_t* b, size_t nb, uint32_t* out) {
+    size_t i = 0, j = 0, k = 0;
+    
+    if (na > nb) {
+        const uint32_t* t = a;
+        size_t n = na;
+        a = b, na = nb;
+        b = t, nb = n;
+    }
+    if (nb / LR__SET_GALLOP > na) {
+        for (; i < na; i++) {
+            size_t p = lr__set_gallop(b, nb, j, a[i]);
+            lr__sort_copy((unsigned char*)(out + k), (const unsigned char*)(b + j), (p - j) * 4);
+            k += p - j;
+            j = p + (p < nb && b[p] == a[i]);
+            out[k++] = a[i];
+        }
+    } else {
+        /* Branchless: write the smaller head, advance past it (both
+         * sides on a tie) */
+        while (i < na && j < nb) {
+            uint32_t x = a[i], y = b[j], lt = 0 - (uint32_t)(y < x);
+            out[k++] = (x & ~lt) | (y & lt);
+            i += x <= y;
+            j += y <= x;
+        }
+        lr__sort_copy((unsigned char*)(out + k), (const unsigned char*)(a + i), (na - i) * 4);
+        k += na - i;
+    }
+    lr__sort_copy((unsigned char*)(out + k), (const unsigned char*)(b + j), (nb - j) * 4);
+    return k + (nb - j);
+}
+
+/* merge_u32/merge_u64: two sorted arrays, duplicates kept, into out of
+ * na + nb elements not overlapping either. With AVX2 a vector from each
+ * side goes through a bitonic merge network (the sorting network
+ * steps): the lower half is written and the upper half carried into the
+ * next step, against a vector from the side with the smaller head. */
+#define LR__MERGE_DEFINE(w)                                                                                                      \
+static inline size_t lr__merge##w##_scalar(const uint##w##_t* a, size_t na, const uint##w##_t* b, size_t nb,                    \
+                                           uint##w##_t* out) {                                                                  \
+    size_t i = 0, j = 0, k = 0;                                                                                                  \
+                                                                                                                                 \
+    while (i < na && j < nb) {                                                                                                   \
+        uint##w##_t x = a[i], y = b[j];                                                                                          \
+        size_t lt = y < x;                                                                                                       \
+        uint##w##_t m = 0 - (uint##w##_t)lt;                                                                                     \
+        out[k++] = (x & ~m) | (y & m);                                                                                           \
+        i += 1 - lt;                                                                                                             \
+        j += lt;                                                                                                                 \
+    }                                                                                                                            \
+    lr__sort_copy((unsigned char*)(out + k), (const unsigned char*)(a + i), (na - i) * (w / 8));                                 \
+    k += na - i;                                                                                                                 \
+    lr__sort_copy((unsigned char*)(out + k), (const unsigned char*)(b + j), (nb - j) * (w / 8));                                 \
+    return k + (nb - j);                                                                                                         \
+}
+
+#ifdef LR__SORTNET_BYTES
+#define LR__MERGE_VEC_DEFINE(w)                                                                                                  \
+/* Bitonic v (ascending, then descending) into order */                                                                          \
+static inline lr__sn##w lr__merge##w##_clean(lr__sn##w v) {                                                                      \
+    int d;                                                                                                                       \
+                                                                                                                                 \
+    for (d = LR__SORTNET_BYTES / (w / 8) / 2; d > 0; d /= 2) {                                                                   \
+        v = lr__sortnet##w##_lanes(v, d, d);                                                                                     \
+    }                                                                                                                            \
+    return v;                                                                                                                    \
+}                                                                                                                                \
+                                                                                                                                 \
+static inline size_t merge_u##w(const uint##w##_t* a, size_t na, const uint##w##_t* b, size_t nb, uint##w##_t* out) {            \
+    const size_t lanes = LR__SORTNET_BYTES / (w / 8);                                                                            \
+    const uint##w##_t* s;                                                                                                        \
+    uint##w##_t c[2 * LR__SORTNET_BYTES / (w / 8)], t[LR__SORTNET_BYTES / (w / 8)];                                              \
+    size_t i = lanes, j = lanes, k = 0, nc, ns;                                                                                  \
+    lr__sn##w x, y;                                                                                                              \
+                                                                                                                                 \
+    if (na < lanes || nb < lanes) {                                                                                              \
+        return lr__merge##w##_scalar(a, na, b, nb, out);                                                                         \
+    }                                                                                                                            \
+    __builtin_memcpy(&x, a, LR__SORTNET_BYTES);                                                                                  \
+    __builtin_memcpy(&y, b, LR__SORTNET_BYTES);                                                                                  \
+    x = lr__sortnet##w##_vkey(x, 0, 0);                                                                                          \
+    y = lr__sortnet##w##_vkey(y, 0, 0);                                                                                          \
+    for (;;) {                                                                                                                   \
+        y = lr__sortnet##w##_perm(y, (int)lanes - 1);                                                                            \
+        lr__sortnet##w##_cmpx(&x, &y);                                                                                           \
+        x = lr__sortnet##w##_vkey(lr__merge##w##_clean(x), 0, 0);                                                                \
+        y = lr__merge##w##_clean(y);                                                                                             \
+        __builtin_memcpy(out + k, &x, LR__SORTNET_BYTES);                                                                        \
+        k += lanes;                                                                                                              \
+        if (j == nb || (i < na && a[i] <= b[j])) {                                                                               \
+            if (na - i < lanes) {                                                                                                \
+                break;                                                                                                           \
+            }                                                                                                                    \
+            __builtin_memcpy(&x, a + i, LR__SORTNET_BYTES);                                                                      \
+            i += lanes;                                                                                                          \
+        } else {                                                                                                                 \
+            if (nb - j < lanes) {                                                                                                \
+                break;                                                                                                           \
+            }                                                                                                                    \
+            __builtin_memcpy(&x, b + j, LR__SORTNET_BYTES);                                                                      \
+            j += lanes;                                                                                                          \
+        }                                                                                                                        \
+        x = lr__sortnet##w##_vkey(x, 0, 0);                                                                                      \
+    }                                                                                                                            \
+    /* The carried vector and the side that ran short (under lanes left)                                                         \
+     * merge through c, then c with the rest of the other side */                                                                \
+    y = lr__sortnet##w##_vkey(y, 0, 0);                                                                                          \
+    __builtin_memcpy(t, &y, LR__SORTNET_BYTES);                                                                                  \
+    if (j == nb || (i < na && a[i] <= b[j])) {                                                                                   \
+        nc = lr__merge##w##_scalar(t, lanes, a + i, na - i, c);                                                                \
+        s = b + j, ns = nb - j;                                                                                                  \
+    } else {                                                                                                                     \
+        nc = lr__merge##w##_scalar(t, lanes, b + j, nb - j, c);                                                                \
+        s = a + i, ns = na - i;                                                                                                  \
+    }                                                                                                                            \
+    return k + lr__merge##w##_scalar(c, nc, s, ns, out + k);                                                                     \
+}
+#else
+#define LR__MERGE_VEC_DEFINE(w)                                                                                                  \
+static inline size_t merge_u##w(const uint##w##_t* a, size_t na, const uint##w##_t* b, size_t nb, uint##w##_t* out) {            \
+    return lr__merge##w##_scalar(a, na, b, nb, out);                                                                             \
+}
+#endif
+
+LR__MERGE_DEFINE(32)
+LR__MERGE_DEFINE(64)
+LR__MERGE_VEC_DEFINE(32)
+LR__MERGE_VEC_DEFINE(64)
+
+/* Linear search. lfind() and lsearch() call the comparator on each
+ * element in turn. The typed scans find_u8..find_u64 return the index of
+ * the first element equal to key, or n if there is none, and
+ * count_eq_u8..count_eq_u64 count them. They compare a broadcast key
+ * with 16, 32 or 64 bytes at a time. The last partial vector is either an
+ * overlapping load that ends at the end of the array or, with AVX-512, a
+ * masked load, so the scans never read past the array. */
+static inline void* lfind(const void* key, const void* base, size_t* nmemb, size_t size,
+                          int (*cmp)(const void*, const void*)) {
+    const unsigned char* p = (const unsigned char*)base;
+    size_t i;
+
+    for (i = 0; i < *nmemb; i++, p += size) {
+        if (cmp(key, p) == 0) {
+            return (void*)p;
+        }
+    }
+    return NULL;
+}
+
+/* As lfind(), but a missing key is appended and *nmemb incremented */
+static inline void* lsearch(const void* key, void* base, size_t* nmemb, size_t size,
+                            int (*cmp)(const void*, const void*)) {
+    void* p = lfind(key, base, nmemb, size, cmp);
+
+    if (!p) {
+        p = (unsigned char*)base + *nmemb * size;
+        memcpy(p, key, size);
+        (*nmemb)++;
+    }
+    return p;
+}
+
+static inline unsigned lr__popcount64(uint64_t x) {
+    #if defined(__POPCNT__) && defined(__x86_64__) && defined(__GNUC__)
+    __asm__ ("popcnt %1, %0" : "=r" (x) : "r" (x));
+    return (unsigned)x;
+    #else
+    x -= (x >> 1) & 0x5555555555555555ULL;
+    x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+    x = (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+    return (unsigned)((x * 0x0101010101010101ULL) >> 56);
+    #endif
+}
+
+/* The w-byte key repeated to fill 64 bits */
+static inline uint64_t lr__find_splat(uint64_t key, size_t w) {
+    return w == 1 ? key * 0x0101010101010101ULL :
+           w == 2 ? key * 0x0001000100010001ULL :
+           w == 4 ? key * 0x0000000100000001ULL : key;
+}
+
+static inline uint64_t lr__find_elem(const unsigned char* p, size_t w) {
+    return w == 1 ? *p :
+           w == 2 ? *(const uint16_t*)p :
+           w == 4 ? *(const uint32_t*)p : *(const uint64_t*)p;
+}
+
+#ifdef LR_SIMD
+/* One bit per byte of the 16 at p, set in each w-byte lane equal to k */
+static inline unsigned lr__find_mask16(const unsigned char* p, lr__v16 k, size_t w) {
+    lr__v16 v = lr__v16_load(p);
+
+    if (w == 1) {
+        v = lr__v16_cmpeq(v, k);
+    } else if (w == 2) {
+        v = lr__v16_cmpeq16(v, k);
+    } else if (w == 4) {
+        v = lr__v16_cmpeq32(v, k);
+    } else {
+        v = lr__v16_cmpeq64(v, k);
+    }
+    return lr__v16_movemask(v);
+}
+
+#ifdef __AVX2__
+static inline unsigned lr__find_mask32(const unsigned char* p, lr__v32 k, size_t w) {
+    lr__v32 v = lr__v32_load(p);
+
+    if (w == 1) {
+        v = lr__v32_cmpeq(v, k);
+    } else if (w == 2) {
+        v = lr__v32_cmpeq16(v, k);
+    } else if (w == 4) {
+        v = lr__v32_cmpeq32(v, k);
+    } else {
+        v = lr__v32_cmpeq64(v, k);
+    }
+    return lr__v32_movemask(v);
+}
+#endif
+
+#ifdef __AVX512BW__
+typedef char lr__v64 __attribute__((vector_size(64)));
+
+static inline lr__v64 lr__v64_set1_64(uint64_t x) {
+    typedef uint64_t lr__u64x8 __attribute__((vector_size(64)));
+    lr__u64x8 v = { x, x, x, x, x, x, x, x };
+    return (lr__v64)v;
+}
+
+/* One bit per w-byte element of the 64 at p that equals k */
+static inline uint64_t lr__find_mask64(const unsigned char* p, lr__v64 k, size_t w) {
+    uint64_t m;
+
+    if (w == 1) {
+        __asm__ ("vpcmpeqb %1, %2, %%k1\n\tkmovq %%k1, %0" : "=r" (m) : "m" (*(const char (*)[64])p), "v" (k) : "k1");
+    } else if (w == 2) {
+        __asm__ ("vpcmpeqw %1, %2, %%k1\n\tkmovq %%k1, %0" : "=r" (m) : "m" (*(const char (*)[64])p), "v" (k) : "k1");
+    } else if (w == 4) {
+        __asm__ ("vpcmpeqd %1, %2, %%k1\n\tkmovq %%k1, %0" : "=r" (m) : "m" (*(const char (*)[64])p), "v" (k) : "k1");
+    } else {
+        __asm__ ("vpcmpeqq %1, %2, %%k1\n\tkmovq %%k1, %0" : "=r" (m) : "m" (*(const char (*)[64])p), "v" (k) : "k1");
+    }
+    return m;
+}
+
+/* As above for the first bytes < 64 bytes at p; masked-off bytes are not
+ * read, so the load is passed as an address rather than a 64-byte operand */
+static inline uint64_t lr__find_mask64_tail(const unsigned char* p, lr__v64 k, size_t w, size_t bytes) {
+    lr__v64 v;
+    uint64_t m;
+
+    __asm__ ("kmovq %1, %%k1\n\tvmovdqu8 (%2), %0%{%%k1%}%{z%}"
+             : "=v" (v) : "r" ((1ULL << bytes) - 1), "r" (p) : "k1", "memory");
+    m = lr__find_mask64((const unsigned char*)&v, k, w);
+    return m & ((1ULL << bytes / w) - 1);
+}
+#endif
+#endif
+
+/* Index of the first w-byte element of a equal to key, or n */
+static inline size_t lr__find(const unsigned char* a, size_t n, uint64_t key, size_t w) {
+    size_t bytes = n * w, i = 0;
+
+    #if defined(LR_SIMD) && defined(__AVX512BW__)
+    lr__v64 k = lr__v64_set1_64(lr__find_splat(key, w));
+    uint64_t m;
+
+    for (; i + 64 <= bytes; i += 64) {
+        m = lr__find_mask64(a + i, k, w);
+        if (m) {
+            return i / w + (size_t)__builtin_ctzll(m);
+        }
+    }
+    if (i < bytes) {
+        m = lr__find_mask64_tail(a + i, k, w, bytes - i);
+        if (m) {
+            return i / w + (size_t)__builtin_ctzll(m);
+        }
+    }
+    return n;
+    #else
+    #ifdef LR_SIMD
+    unsigned m;
+    #ifdef __AVX2__
+    if (bytes >= 32) {
+        lr__v32 k = lr__v32_set1_64(lr__find_splat(key, w));
+
+        for (; i + 32 <= bytes; i += 32) {
+            m = lr__find_mask32(a + i, k, w);
+            if (m) {
+                return (i + (size_t)__builtin_ctz(m)) / w;
+            }
+        }
+        /* The bytes before i in the last vector held no match */
+        if (i < bytes) {
+            i = bytes - 32;
+            m = lr__find_mask32(a + i, k, w);
+            if (m) {
+                return (i + (size_t)__builtin_ctz(m)) / w;
+            }
+        }
+        return n;
+    }
+    #endif
+    if (bytes >= 16) {
+        lr__v16 k = lr__v16_set1_64(lr__find_splat(key, w));
+
+        for (; i + 16 <= bytes; i += 16) {
+            m = lr__find_mask16(a + i, k, w);
+            if (m) {
+                return (i + (size_t)__builtin_ctz(m)) / w;
+            }
+        }
+        if (i < bytes) {
+            i = bytes - 16;
+            m = lr__find_mask16(a + i, k, w);
+            if (m) {
+                return (i + (size_t)__builtin_ctz(m)) / w;
+            }
+        }
+        return n;
+    }
+    #endif
+    for (; i < bytes; i += w) {
+        if (lr__find_elem(a + i, w) == key) {
+            return i / w;
+        }
+    }
+    return n;
+    #endif
+}
+
+/* Number of w-byte elements of a equal to key */
+static inline size_t lr__count_eq(const unsigned char* a, size_t n, uint64_t key, size_t w) {
+    size_t bytes = n * w, i = 0, c = 0;
+
+    #if defined(LR_SIMD) && defined(__AVX512BW__)
+    lr__v64 k = lr__v64_set1_64(lr__find_splat(key, w));
+
+    for (; i + 64 <= bytes; i += 64) {
+        c += lr__popcount64(lr__find_mask64(a + i, k, w));
+    }
+    if (i < bytes) {
+        c += lr__popcount64(lr__find_mask64_tail(a + i, k, w, bytes - i));
+    }
+    return c;
+    #else
+    #ifdef LR_SIMD
+    /* Byte masks count each match w times */
+    #ifdef __AVX2__
+    if (bytes >= 32) {
+        lr__v32 k = lr__v32_set1_64(lr__find_splat(key, w));
+
+        for (; i + 32 <= bytes; i += 32) {
+            c += lr__popcount64(lr__find_mask32(a + i, k, w));
+        }
+        if (i < bytes) {
+            c += lr__popcount64(lr__find_mask32(a + bytes - 32, k, w) >> (32 - (bytes - i)));
+        }
+        return c / w;
+    }
+    #endif
+    if (bytes >= 16) {
+        lr__v16 k = lr__v16_set1_64(lr__find_splat(key, w));
+
+        for (; i + 16 <= bytes; i += 16) {
+            c += lr__popcount64(lr__find_mask16(a + i, k, w));
+        }
+        if (i < bytes) {
+            c += lr__popcount64(lr__find_mask16(a + bytes - 16, k, w) >> (16 - (bytes - i)));
+        }
+        return c / w;
+    }
+    #endif
+    for (; i < bytes; i += w) {
+        c += lr__find_elem(a + i, w) == key;
+    }
+    return c;
+    #endif
+}
+
+static inline size_t find_u8(const uint8_t* a, size_t n, uint8_t key) {
+    return lr__find((const unsigned char*)a, n, key, 1);
+}
+
+static inline size_t find_u16(const uint16_t* a, size_t n, uint16_t key) {
+    return lr__find((const unsigned char*)a, n, key, 2);
+}
+
+static inline size_t find_u32(const uint32_t* a, size_t n, uint32_t key) {
+    return lr__find((const unsigned char*)a, n, key, 4);
+}
+
+static inline size_t find_u64(const uint64_t* a, size_t n, uint64_t key) {
+    return lr__find((const unsigned char*)a, n, key, 8);
+}
+
+static inline size_t count_eq_u8(const uint8_t* a, size_t n, uint8_t key) {
+    return lr__count_eq((const unsigned char*)a, n, key, 1);
+}
+
+static inline size_t count_eq_u16(const uint16_t* a, size_t n, uint16_t key) {
+    return lr__count_eq((const unsigned char*)a, n, key, 2);
+}
+
+static inline size_t count_eq_u32(const uint32_t* a, size_t n, uint32_t key) {
+    return lr__count_eq((const unsigned char*)a, n, key, 4);
+}
+
+static inline size_t count_eq_u64(const uint64_t* a, size_t n, uint64_t key) {
+    return lr__count_eq((const unsigned char*)a, n, key, 8);
+}
+
+/* Arena (bump) allocation over caller memory. lr_arena_init() keeps the
+ * arena's own state at the front of the buffer, so one region is all it
+ * needs; allocation is a pointer bump and nothing is freed individually.
+ * lr_arena_mark() and lr_arena_rewind() release everything allocated
+ * after a mark at once, and lr_arena_reset() releases everything. */
+#define LR_ARENA_ALIGN 16   /* Alignment of lr_arena_alloc() */
+
+typedef struct lr_arena {
+    unsigned char* cur;
+    unsigned char* begin;
+    unsigned char* end;
+} lr_arena;
+
+/* The arena in buf, or NULL if size cannot hold its header */
+static inline lr_arena* lr_arena_init(void* buf, size_t size) {
+    uintptr_t p = ((uintptr_t)buf + (LR_ARENA_ALIGN - 1)) & ~(uintptr_t)(LR_ARENA_ALIGN - 1);
+    size_t skip = (size_t)(p - (uintptr_t)buf) + sizeof(lr_arena);
+    lr_arena* a;
+
+    if (!buf || size < skip) {
+        return NULL;
+    }
+    a = (lr_arena*)p;
+    a->begin = (unsigned char*)buf + skip;
+    a->cur = a->begin;
+    a->end = (unsigned char*)buf + size;
+    return a;
+}
+
+/* size bytes aligned to align, a power of two; NULL if they do not fit */
+static inline void* lr_arena_alloc_aligned(lr_arena* a, size_t size, size_t align) {
+    uintptr_t p = ((uintptr_t)a->cur + (align - 1)) & ~(uintptr_t)(align - 1);
+
+    if ((align & (align - 1)) || p < (uintptr_t)a->cur || p > (uintptr_t)a->end || size > (size_t)((uintptr_t)a->end - p)) {
+        return NULL;
+    }
+    a->cur = (unsigned char*)p + size;
+    return (void*)p;
+}
+
+static inline void* lr_arena_alloc(lr_arena* a, size_t size) {
+    return lr_arena_alloc_aligned(a, size, LR_ARENA_ALIGN);
+}
+
+static inline void* lr_arena_calloc(lr_arena* a, size_t n, size_t size) {
+    void* p;
+
+    if (size && n > (size_t)-1 / size) {
+        return NULL;
+    }
+    p = lr_arena_alloc(a, n * size);
+    if (p) {
+        memset(p, 0, n * size);
+    }
+    return p;
+}
+
+/* A copy aligned like lr_arena_alloc(), so it can hold any object */
+static inline void* lr_arena_memdup(lr_arena* a, const void* src, size_t n) {
+    void* p = lr_arena_alloc(a, n);
+
+    if (p) {
+        memcpy(p, src, n);
+    }
+    return p;
+}
+
+/* Strings need no alignment, so they are packed byte by byte */
+static inline char* lr_arena_strndup(lr_arena* a, const char* s, size_t n) {
+    size_t len = 0;
+    char* p;
+
+    while (len < n && s[len]) {
+        len++;
+    }
+    p = (char*)lr_arena_alloc_aligned(a, len + 1, 1);
+    if (p) {
+        memcpy(p, s, len);
+        p[len] = '\0';
+    }
+    return p;
+}
+
+static inline char* lr_arena_strdup(lr_arena* a, const char* s) {
+    size_t n = strlen(s) + 1;
+    char* p = (char*)lr_arena_alloc_aligned(a, n, 1);
+
+    if (p) {
+        memcpy(p, s, n);
+    }
+    return p;
+}
+
+/* Current position, to pass to lr_arena_rewind() */
+static inline size_t lr_arena_mark(const lr_arena* a) {
+    return (size_t)(a->cur - a->begin);
+}
+
+/* Release everything allocated since mark was taken */
+static inline void lr_arena_rewind(lr_arena* a, size_t mark) {
+    if (mark <= (size_t)(a->cur - a->begin)) {
+        a->cur = a->begin + mark;
+    }
+}
+
+static inline void lr_arena_reset(lr_arena* a) {
+    a->cur = a->begin;
+}
+
+static inline size_t lr_arena_used(const lr_arena* a) {
+    return (size_t)(a->cur - a->begin);
+}
+
+static inline size_t lr_arena_remaining(const lr_arena* a) {
+    return (size_t)(a->end - a->cur);
+}
+
+/* Atomics and spin locks. Memory orders follow C11; x86 is TSO, so
+ * plain loads already acquire and plain stores already release, and
+ * those orders only need a compiler barrier. Sequentially consistent
+ * stores use xchg. Every locked read-modify-write is a full barrier. On
+ * other GCC-compatible targets the same functions wrap the __atomic
+ * builtins, except lr_atomic_cas_u128, which needs cmpxchg16b. */
+#define LR_RELAXED 0
+#define LR_ACQUIRE 2
+#define LR_RELEASE 3
+#define LR_ACQ_REL 4
+#define LR_SEQ_CST 5
+
+typedef void* lr__ptr;
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#define LR_ATOMICS 1
+
+static inline void lr__compiler_barrier(void) {
+    __asm__ volatile ("" ::: "memory");
+}
+
+/* Spin-wait hint for the sibling hyperthread and the memory pipeline */
+static inline void lr_cpu_relax(void) {
+    __asm__ volatile ("pause" ::: "memory");
+}
+
+/* A locked no-op on the stack orders like mfence but costs less */
+static inline void lr_atomic_thread_fence(int order) {
+    if (order == LR_SEQ_CST) {
+        __asm__ volatile ("lock orq $0, (%%rsp)" ::: "memory", "cc");
+    } else if (order != LR_RELAXED) {
+        lr__compiler_barrier();
+    }
+}
+
+#define LR__ATOMIC_DEFINE(name, T, sfx)                                                                                          \
+static inline T lr_atomic_load_##name(const volatile T* p, int order) {                                                          \
+    T v = *p;                                                                                                                    \
+    if (order != LR_RELAXED) {                                                                                                   \
+        lr__compiler_barrier();                                                                                                  \
+    }                                                                                                                            \
+    return v;                                                                                                                    \
+}                                                                                                                                \
+                                                                                                                                 \
+static inline T lr_atomic_exchange_##name(volatile T* p, T v, int order) {                                                       \
+    (void)order;                                                                                                                 \
+    __asm__ volatile ("xchg" sfx " %0, %1" : "+r" (v), "+m" (*p) : : "memory");                                                  \
+    return v;                                                                                                                    \
+}                                                                                                                                \
+                                                                                                                                 \
+static inline void lr_atomic_store_##name(volatile T* p, T v, int order) {                                                       \
+    if (order == LR_SEQ_CST) {                                                                                                   \
+        lr_atomic_exchange_##name(p, v, order);                                                                                  \
+        return;                                                                                                                  \
+    }                                                                                                                            \
+    if (order != LR_RELAXED) {                                                                                                   \
+        lr__compiler_barrier();                                                                                                  \
+    }                                                                                                                            \
+    *p = v;                                                                                                                      \
+}                                                                                                                                \
+                                                                                                                                 \
+/* If *p equals *expected store desired and return 1; otherwise load *p                                                          \
+ * into *expected and return 0 */                                                                                                \
+static inline int lr_atomic_cas_##name(volatile T* p, T* expected, T desired, int order) {                                       \
+    unsigned char ok;                                                                                                            \
+    T e = *expected;                                                                                                             \
+    (void)order;                                                                                                                 \
+    __asm__ volatile ("lock cmpxchg" sfx " %3, %1\n\tsete %0"                                                                    \
+                      : "=q" (ok), "+m" (*p), "+a" (e) : "r" (desired) : "memory", "cc");                                        \
+    *expected = e;                                                                                                               \
+    return ok;                                                                                                                   \
+}
+
+#define LR__ATOMIC_ARITH_DEFINE(name, T, sfx)                                                                                    \
+static inline T lr_atomic_fetch_add_##name(volatile T* p, T v, int order) {                                                      \
+    (void)order;                                                                                                                 \
+    __asm__ volatile ("lock xadd" sfx " %0, %1" : "+r" (v), "+m" (*p) : : "memory", "cc");                                       \
+    return v;                                                                                                                    \
+}                                                                                                                                \
+                                                                                                                                 \
+static inline T lr_atomic_fetch_sub_##name(volatile T* p, T v, int order) {                                                      \
+    return lr_atomic_fetch_add_##name(p, (T)0 - v, order);                                                                       \
+}                                                                                                                                \
+                                                                                                                                 \
+LR__ATOMIC_FETCH_OP(name, T, and, &)                                                                                             \
+LR__ATOMIC_FETCH_OP(name, T, or, |)                                                                                              \
+LR__ATOMIC_FETCH_OP(name, T, xor, ^)
+
+/* No x86 instruction returns the old value of a locked and/or/xor */
+#define LR__ATOMIC_FETCH_OP(name, T, op_name, op)                                                                                \
+static inline T lr_atomic_fetch_##op_name##_##name(volatile T* p, T v, int order) {                                              \
+    T old = *p;                                                                                                                  \
+    while (!lr_atomic_cas_##name(p, &old, old op v, order)) {                                                                    \
+    }                                                                                                                            \
+    return old;                                                                                                                  \
+}
+
+LR__ATOMIC_DEFINE(u32, uint32_t, "l")
+LR__ATOMIC_DEFINE(u64, uint64_t, "q")
+LR__ATOMIC_DEFINE(ptr, lr__ptr, "q")
+LR__ATOMIC_ARITH_DEFINE(u32, uint32_t, "l")
+LR__ATOMIC_ARITH_DEFINE(u64, uint64_t, "q")
+
+/* 16-byte compare-and-swap of the 16-byte aligned p, as
+ * lr_atomic_cas_u64 with the pair *lo:*hi as the expected value */
+#define LR_ATOMIC_CAS128 1
+
+static inline int lr_atomic_cas_u128(volatile void* p, uint64_t* lo, uint64_t* hi, uint64_t new_lo, uint64_t new_hi,
+                                     int order) {
+    unsigned char ok;
+    (void)order;
+    __asm__ volatile ("lock cmpxchg16b %1\n\tsete %0"
+                      : "=q" (ok), "+m" (*(volatile uint64_t (*)[2])p), "+a" (*lo), "+d" (*hi)
+                      : "b" (new_lo), "c" (new_hi)
+                      : "memory", "cc");
+    return ok;
+}
+#elif defined(__GNUC__)
+#define LR_ATOMICS 1
+
+static inline void lr_cpu_relax(void) {
+    __asm__ volatile ("" ::: "memory");
+}
+
+static inline void lr_atomic_thread_fence(int order) {
+    __atomic_thread_fence(order);
+}
+
+#define LR__ATOMIC_DEFINE(name, T, sfx)                                                                                          \
+static inline T lr_atomic_load_##name(const volatile T* p, int order) {                                                          \
+    return __atomic_load_n(p, order);                                                                                            \
+}                                                                                                                                \
+                                                                                                                                 \
+static inline T lr_atomic_exchange_##name(volatile T* p, T v, int order) {                                                       \
+    return __atomic_exchange_n(p, v, order);                                                                                     \
+}                                                                                                                                \
+                                                                                                                                 \
+static inline void lr_atomic_store_##name(volatile T* p, T v, int order) {                                                       \
+    __atomic_store_n(p, v, order);                                                                                               \
+}                                                                                                                                \
+                                                                                                                                 \
+static inline int lr_atomic_cas_##name(volatile T* p, T* expected, T desired, int order) {                                       \
+    return __atomic_compare_exchange_n(p, expected, desired, 0, order, LR_RELAXED);                                              \
+}
+
+#define LR__ATOMIC_ARITH_DEFINE(name, T, sfx)                                                                                    \
+static inline T lr_atomic_fetch_add_##name(volatile T* p, T v, int order) {                                                      \
+    return __atomic_fetch_add(p, v, order);                                                                                      \
+}                                                                                                                                \
+                                                                                                                                 \
+static inline T lr_atomic_fetch_sub_##name(volatile T* p, T v, int order) {                                                      \
+    return __atomic_fetch_sub(p, v, order);                                                                                      \
+}                                                                                                                                \
+                                                                                                                                 \
+static inline T lr_atomic_fetch_and_##name(volatile T* p, T v, int order) {                                                      \
+    return __atomic_fetch_and(p, v, order);                                                                                      \
+}                                                                                                                                \
+                                                                                                                                 \
+static inline T lr_atomic_fetch_or_##name(volatile T* p, T v, int order) {                                                       \
+    return __atomic_fetch_or(p, v, order);                                                                                       \
+}                                                                                                                                \
+                                                                                                                                 \
+static inline T lr_atomic_fetch_xor_##name(volatile T* p, T v, int order) {                                                      \
+    return __atomic_fetch_xor(p, v, order);                                                                                      \
+}
+
+LR__ATOMIC_DEFINE(u32, uint32_t, "")
+LR__ATOMIC_DEFINE(u64, uint64_t, "")
+LR__ATOMIC_DEFINE(ptr, lr__ptr, "")
+LR__ATOMIC_ARITH_DEFINE(u32, uint32_t, "")
+LR__ATOMIC_ARITH_DEFINE(u64, uint64_t, "")
+#endif
+
+#ifdef LR_ATOMICS
+/* Test-and-test-and-set spinlock. Waiters spin on a plain load, which
+ * stays in their own cache, and back off exponentially with pause
+ * between attempts, up to LR_SPIN_BACKOFF_MAX pauses. */
+#ifndef LR_SPIN_BACKOFF_MAX
+#define LR_SPIN_BACKOFF_MAX 64
+#endif
+
+typedef struct lr_spinlock {
+    volatile uint32_t locked;
+} lr_spinlock;
+
+#define LR_SPINLOCK_INIT { 0 }
+
+static inline void lr_spin_init(lr_spinlock* l) {
+    l->locked = 0;
+}
+
+static inline int lr_spin_trylock(lr_spinlock* l) {
+    return lr_atomic_load_u32(&l->locked, LR_RELAXED) == 0 && lr_atomic_exchange_u32(&l->locked, 1, LR_ACQUIRE) == 0;
+}
+
+static inline void lr_spin_lock(lr_spinlock* l) {
+    unsigned backoff = 1, i;
+
+    while (lr_atomic_exchange_u32(&l->locked, 1, LR_ACQUIRE)) {
+        do {
+            for (i = 0; i < backoff; i++) {
+                lr_cpu_relax();
+            }
+            if (backoff < LR_SPIN_BACKOFF_MAX) {
+                backoff <<= 1;
+            }
+        } while (lr_atomic_load_u32(&l->locked, LR_RELAXED));
+    }
+}
+
+static inline void lr_spin_unlock(lr_spinlock* l) {
+    lr_atomic_store_u32(&l->locked, 0, LR_RELEASE);
+}
+
+/* Ticket lock: FIFO, one fetch-and-add to queue. Waiters back off in
+ * proportion to their distance from the head of the queue. */
+typedef struct lr_ticketlock {
+    volatile uint32_t next;
+    volatile uint32_t owner;
+} lr_ticketlock;
+
+#define LR_TICKETLOCK_INIT { 0, 0 }
+
+static inline void lr_ticket_init(lr_ticketlock* l) {
+    l->next = 0;
+    l->owner = 0;
+}
+
+static inline int lr_ticket_trylock(lr_ticketlock* l) {
+    uint32_t t = lr_atomic_load_u32(&l->owner, LR_RELAXED);
+    return lr_atomic_cas_u32(&l->next, &t, t + 1, LR_ACQUIRE);
+}
+
+static inline void lr_ticket_lock(lr_ticketlock* l) {
+    uint32_t t = lr_atomic_fetch_add_u32(&l->next, 1, LR_ACQUIRE);
+    uint32_t owner, i;
+
+    while ((owner = lr_atomic_load_u32(&l->owner, LR_ACQUIRE)) != t) {
+        for (i = t - owner; i; i--) {
+            lr_cpu_relax();
+        }
+    }
+}
+
+/* Only the holder writes owner */
+static inline void lr_ticket_unlock(lr_ticketlock* l) {
+    lr_atomic_store_u32(&l->owner, l->owner + 1, LR_RELEASE);
+}
+
+/* MCS queue lock: each waiter spins on a flag in its own node, so a
+ * release touches one other cache line however many threads wait. The
+ * caller provides the node, which must stay valid until unlock. */
+typedef struct lr_mcs_node {
+    struct lr_mcs_node* volatile next;
+    volatile uint32_t locked;
+} lr_mcs_node;
+
+typedef struct lr_mcslock {
+    lr_mcs_node* volatile tail;
+} lr_mcslock;
+
+#define LR_MCSLOCK_INIT { NULL }
+
+static inline void lr_mcs_init(lr_mcslock* l) {
+    l->tail = NULL;
+}
+
+static inline int lr_mcs_trylock(lr_mcslock* l, lr_mcs_node* node) {
+    void* expected = NULL;
+
+    node->next = NULL;
+    node->locked = 0;
+    return lr_atomic_cas_ptr((void* volatile*)&l->tail, &expected, node, LR_ACQUIRE);
+}
+
+static inline void lr_mcs_lock(lr_mcslock* l, lr_mcs_node* node) {
+    lr_mcs_node* prev;
+
+    node->next = NULL;
+    node->locked = 1;
+    prev = (lr_mcs_node*)lr_atomic_exchange_ptr((void* volatile*)&l->tail, node, LR_ACQ_REL);
+    if (prev) {
+        lr_atomic_store_ptr((void* volatile*)&prev->next, node, LR_RELEASE);
+        while (lr_atomic_load_u32(&node->locked, LR_ACQUIRE)) {
+            lr_cpu_relax();
+        }
+    }
+}
+
+static inline void lr_mcs_unlock(lr_mcslock* l, lr_mcs_node* node) {
+    lr_mcs_node* next = (lr_mcs_node*)lr_atomic_load_ptr((void* volatile*)&node->next, LR_ACQUIRE);
+
+    if (!next) {
+        void* expected = node;
+
+        if (lr_atomic_cas_ptr((void* volatile*)&l->tail, &expected, NULL, LR_RELEASE)) {
+            return;
+        }
+        /* A successor swapped itself in but has not linked yet */
+        while (!(next = (lr_mcs_node*)lr_atomic_load_ptr((void* volatile*)&node->next, LR_ACQUIRE))) {
+            lr_cpu_relax();
+        }
+    }
+    lr_atomic_store_u32(&next->locked, 0, LR_RELEASE);
+}
+
+/* Sequence lock for data with many readers and rare writers. A writer
+ * makes the count odd for the duration of its update; a reader never
+ * writes shared memory, and retries its copy if the count was odd or
+ * changed while it copied. Writers are serialized on the count itself.
+ *
+ * The copy may see a torn update, which the retry then discards, so it
+ * must only be a snapshot copied out. On x86 the reader's loads and the
+ * writer's stores keep their order, so the barriers around the copy
+ * only stop the compiler from moving accesses across them. */
+typedef struct lr_seqlock {
+    volatile uint32_t seq;
+} lr_seqlock;
+
+#define LR_SEQLOCK_INIT { 0 }
+
+static inline void lr_seqlock_init(lr_seqlock* l) {
+    l->seq = 0;
+}
+
+/* Count to pass to lr_seqlock_read_retry, once no write is in progress */
+static inline uint32_t lr_seqlock_read_begin(const lr_seqlock* l) {
+    uint32_t s;
+
+    while ((s = lr_atomic_load_u32(&l->seq, LR_ACQUIRE)) & 1) {
+        lr_cpu_relax();
+    }
+    return s;
+}
+
+/* True if a write overlapped the reads since lr_seqlock_read_begin */
+static inline int lr_seqlock_read_retry(const lr_seqlock* l, uint32_t start) {
+    lr_atomic_thread_fence(LR_ACQUIRE);
+    return lr_atomic_load_u32(&l->seq, LR_RELAXED) != start;
+}
+
+static inline void lr_seqlock_write_lock(lr_seqlock* l) {
+    uint32_t s;
+
+    for (;;) {
+        s = lr_atomic_load_u32(&l->seq, LR_RELAXED);
+        if (!(s & 1) && lr_atomic_cas_u32(&l->seq, &s, s + 1, LR_ACQUIRE)) {
+            break;
+        }
+        lr_cpu_relax();
+    }
+    /* The odd count must be visible before any of the data stores */
+    lr_atomic_thread_fence(LR_RELEASE);
+}
+
+static inline void lr_seqlock_write_unlock(lr_seqlock* l) {
+    lr_atomic_store_u32(&l->seq, l->seq + 1, LR_RELEASE);
+}
+
+/* Copy n bytes of src, guarded by l, into dst as one consistent snapshot */
+static inline void lr_seqlock_read_copy(const lr_seqlock* l, void* dst, const void* src, size_t n) {
+    uint32_t s;
+
+    do {
+        s = lr_seqlock_read_begin(l);
+        memcpy(dst, src, n);
+    } while (lr_seqlock_read_retry(l, s));
+}
+
+/* Replace n bytes at dst, guarded by l, with src */
+static inline void lr_seqlock_write_copy(lr_seqlock* l, void* dst, const void* src, size_t n) {
+    lr_seqlock_write_lock(l);
+    memcpy(dst, src, n);
+    lr_seqlock_write_unlock(l);
+}
+#endif
+
+/* Fixed-size object pool over caller memory. Free slots form an
+ * intrusive singly linked list through their first word. Slots that were
+ * never handed out are carved from the front of the untouched region, so
+ * initialization is O(1) as well. Passing LR_CACHE_LINE as the alignment
+ * rounds slots to whole cache lines, so objects owned by different
+ * threads never share one.
+ *
+ * The _mt variants may run on any number of threads at once, but must
+ * not be mixed with the plain ones. They swap the list head together with
+ * a counter using cmpxchg16b. A slot that is popped and pushed back
+ * between a thread's read of the head and its swap (ABA) changes the
+ * counter, so the swap fails. */
+#define LR_CACHE_LINE 64
+
+typedef struct lr_pool {
+    void* head;        /* Free list; head and tag are swapped as a pair */
+    uintptr_t tag;
+    uintptr_t next;    /* Slots from here to end were never handed out */
+    uintptr_t end;
+    uintptr_t begin;   /* First slot */
+    size_t slot;
+} lr_pool;
+
+/* A pool of obj_size-byte objects aligned to align (a power of two) in
+ * buf, or NULL if the arguments are invalid or size cannot hold the
+ * pool's state, which lives at the 16-byte aligned front of buf. */
+static inline lr_pool* lr_pool_init(void* buf, size_t size, size_t obj_size, size_t align) {
+    uintptr_t start = ((uintptr_t)buf + 15) & ~(uintptr_t)15, first, end = (uintptr_t)buf + size;
+    size_t slot = obj_size < sizeof(void*) ? sizeof(void*) : obj_size;
+    lr_pool* p;
+
+    if (!buf || (align & (align - 1)) || end < (uintptr_t)buf) {
+        return NULL;
+    }
+    if (align < sizeof(void*)) {
+        align = sizeof(void*);
+    }
+    if (slot > (size_t)-1 - align) {
+        return NULL;
+    }
+    first = (start + sizeof(lr_pool) + (align - 1)) & ~(uintptr_t)(align - 1);
+    if (first < start || first > end) {
+        return NULL;
+    }
+    slot = (slot + (align - 1)) & ~(align - 1);
+    p = (lr_pool*)start;
+    p->head = NULL;
+    p->tag = 0;
+    p->next = first;
+    p->begin = first;
+    p->end = first + (end - first) / slot * slot;
+    p->slot = slot;
+    return p;
+}
+
+/* Number of objects the pool can hold */
+static inline size_t lr_pool_capacity(const lr_pool* p) {
+    return (size_t)(p->end - p->begin) / p->slot;
+}
+
+/* Size of each slot, obj_size rounded up to the alignment */
+static inline size_t lr_pool_slot_size(const lr_pool* p) {
+    return p->slot;
+}
+
+/* True if obj is a slot of the pool */
+static inline int lr_pool_owns(const lr_pool* p, const void* obj) {
+    uintptr_t o = (uintptr_t)obj;
+    return o >= p->begin && o < p->end && (o - p->begin) % p->slot == 0;
+}
+
+/* A free slot, or NULL when all are in use */
+static inline void* lr_pool_alloc(lr_pool* p) {
+    void* obj = p->head;
+
+    if (obj) {
+        p->head = *(void**)obj;
+        return obj;
+    }
+    if (p->next < p->end) {
+        obj = (void*)p->next;
+        p->next += p->slot;
+    }
+    return obj;
+}
+
+static inline void lr_pool_free(lr_pool* p, void* obj) {
+    if (obj) {
+        *(void**)obj = p->head;
+        p->head = obj;
+    }
+}
+
+#ifdef LR_ATOMIC_CAS128
+/* The slot's link word may be rewritten by its new owner while another
+ * thread reads it; that thread's swap then fails on the changed tag */
+static inline void* lr_pool_alloc_mt(lr_pool* p) {
+    uint64_t tag = lr_atomic_load_u64(&p->tag, LR_RELAXED);
+    uint64_t head = (uint64_t)lr_atomic_load_ptr(&p->head, LR_ACQUIRE);
+    uint64_t obj;
+
+    while (head) {
+        void* next = lr_atomic_load_ptr((void* volatile*)head, LR_RELAXED);
+        if (lr_atomic_cas_u128(&p->head, &head, &tag, (uint64_t)next, tag + 1, LR_ACQ_REL)) {
+            return (void*)head;
+        }
+    }
+    /* Keeps next from running far past end when the pool is exhausted */
+    if (lr_atomic_load_u64(&p->next, LR_RELAXED) >= p->end) {
+        return NULL;
+    }
+    obj = lr_atomic_fetch_add_u64(&p->next, p->slot, LR_RELAXED);
+    return obj < p->end ? (void*)obj : NULL;
+}
+
+static inline void lr_pool_free_mt(lr_pool* p, void* obj) {
+    uint64_t tag = lr_atomic_load_u64(&p->tag, LR_RELAXED);
+    uint64_t head = (uint64_t)lr_atomic_load_ptr(&p->head, LR_RELAXED);
+
+    if (!obj) {
+        return;
+    }
+    do {
+        lr_atomic_store_ptr((void* volatile*)obj, (void*)head, LR_RELAXED);
+    } while (!lr_atomic_cas_u128(&p->head, &head, &tag, (uint64_t)obj, tag + 1, LR_RELEASE));
+}
+#endif
+
+/* Two-level segregated fit (TLSF) allocator over caller memory, with
+ * O(1) malloc and free. Free blocks are kept in lists by size class: the
+ * first level is the power of two of the size, and the second splits
+ * that range into 32 equal steps. One bitmap bit per list lets ffs() find
+ * the smallest non-empty class that fits with two bit scans. Each block
+ * has a two-word header holding its physical predecessor and its size,
+ * so free() merges with free neighbours at once and payloads stay aligned
+ * to two words. Blocks are limited to 4 GiB (1 GiB on 32-bit targets); a
+ * larger region is only used up to that size. The state lives at the
+ * front of the region. These are not named malloc()/free() because a
+ * header-only global heap would be a separate heap in every translation
+ * unit. */
+#if SIZE_MAX > 0xFFFFFFFFu
+#define LR__TLSF_ALIGN_LOG2 4   /* The block header size */
+#define LR__TLSF_FL_MAX     32
+#else
+#define LR__TLSF_ALIGN_LOG2 3
+#define LR__TLSF_FL_MAX     30
+#endif
+#define LR__TLSF_ALIGN    (1 << LR__TLSF_ALIGN_LOG2)
+#define LR__TLSF_SL_LOG2  5
+#define LR__TLSF_SL_COUNT (1 << LR__TLSF_SL_LOG2)
+#define LR__TLSF_FL_SHIFT (LR__TLSF_SL_LOG2 + LR__TLSF_ALIGN_LOG2)   /* Smaller sizes share the first level */
+#define LR__TLSF_FL_COUNT (LR__TLSF_FL_MAX - LR__TLSF_FL_SHIFT + 1)
+#define LR__TLSF_SMALL    ((size_t)1 << LR__TLSF_FL_SHIFT)
+#define LR__TLSF_MAX      ((size_t)1 << LR__TLSF_FL_MAX)
+#define LR__TLSF_HEADER   offsetof(lr__tlsf_block, next_free)
+#define LR__TLSF_MIN      (sizeof(lr__tlsf_block) - LR__TLSF_HEADER)
+#define LR__TLSF_FREE     ((size_t)1)
+
+typedef struct lr__tlsf_block {
+    struct lr__tlsf_block* prev_phys;   /* NULL for the first block */
+    size_t size;                        /* Payload bytes; the low bit is set while free */
+    struct lr__tlsf_block* next_free;   /* Only while free, in the payload */
+    struct lr__tlsf_block* prev_free;
+} lr__tlsf_block;
+
+typedef struct lr_tlsf {
+    uint32_t fl_bitmap;
+    uint32_t sl_bitmap[LR__TLSF_FL_COUNT];
+    lr__tlsf_block* heads[LR__TLSF_FL_COUNT][LR__TLSF_SL_COUNT];
+} lr_tlsf;
+
+static inline size_t lr__tlsf_size(const lr__tlsf_block* b) {
+    return b->size & ~LR__TLSF_FREE;
+}
+
+static inline void* lr__tlsf_payload(lr__tlsf_block* b) {
+    return (unsigned char*)b + LR__TLSF_HEADER;
+}
+
+static inline lr__tlsf_block* lr__tlsf_block_of(void* p) {
+    return (lr__tlsf_block*)((unsigned char*)p - LR__TLSF_HEADER);
+}
+
+static inline lr__tlsf_block* lr__tlsf_next(lr__tlsf_block* b) {
+    return (lr__tlsf_block*)((unsigned char*)b + LR__TLSF_HEADER + lr__tlsf_size(b));
+}
+
+/* The list holding free blocks of size bytes */
+static inline void lr__tlsf_mapping(size_t size, int* fl, int* sl) {
+    if (size < LR__TLSF_SMALL) {
+        *fl = 0;
+        *sl = (int)(size / (LR__TLSF_SMALL / LR__TLSF_SL_COUNT));
+    } else {
+        int f = flsll((long long)size) - 1;
+        *sl = (int)(size >> (f - LR__TLSF_SL_LOG2)) ^ LR__TLSF_SL_COUNT;
+        *fl = f - (LR__TLSF_FL_SHIFT - 1);
+    }
+}
+
+static inline void lr__tlsf_insert(lr_tlsf* t, lr__tlsf_block* b) {
+    lr__tlsf_block* head;
+    int fl, sl;
+
+    lr__tlsf_mapping(lr__tlsf_size(b), &fl, &sl);
+    head = t->heads[fl][sl];
+    b->next_free = head;
+    b->prev_free = NULL;
+    if (head) {
+        head->prev_free = b;
+    }
+    t->heads[fl][sl] = b;
+    t->fl_bitmap |= 1u << fl;
+    t->sl_bitmap[fl] |= 1u << sl;
+    b->size |= LR__TLSF_FREE;
+}
+
+static inline void lr__tlsf_remove(lr_tlsf* t, lr__tlsf_block* b) {
+    int fl, sl;
+
+    lr__tlsf_mapping(lr__tlsf_size(b), &fl, &sl);
+    if (b->next_free) {
+        b->next_free->prev_free = b->prev_free;
+    }
+    if (b->prev_free) {
+        b->prev_free->next_free = b->next_free;
+    } else {
+        t->heads[fl][sl] = b->next_free;
+        if (!b->next_free) {
+            t->sl_bitmap[fl] &= ~(1u << sl);
+            if (!t->sl_bitmap[fl]) {
+                t->fl_bitmap &= ~(1u << fl);
+            }
+        }
+    }
+    b->size &= ~LR__TLSF_FREE;
+}
+
+/* A free block of at least size bytes, or NULL. The size is first
+ * rounded up to the next list boundary, so any block in the list found
+ * is large enough. */
+static inline lr__tlsf_block* lr__tlsf_find(lr_tlsf* t, size_t size) {
+    uint32_t m;
+    int fl, sl;
+
+    if (size >= LR__TLSF_SMALL) {
+        size += ((size_t)1 << (flsll((long long)size) - 1 - LR__TLSF_SL_LOG2)) - 1;
+    }
+    lr__tlsf_mapping(size, &fl, &sl);
+    if (fl >= LR__TLSF_FL_COUNT) {
+        return NULL;
+    }
+    m = t->sl_bitmap[fl] & (~0u << sl);
+    if (!m) {
+        m = t->fl_bitmap & (~0u << (fl + 1));
+        if (!m) {
+            return NULL;
+        }
+        fl = ffs((int)m) - 1;
+        m = t->sl_bitmap[fl];
+    }
+    sl = ffs((int)m) - 1;
+    return t->heads[fl][sl];
+}
+
+/* Shrink the used block b to size bytes, freeing the rest when it can
+ * form a block of its own (merged with a free successor) */
+static inline void lr__tlsf_trim(lr_tlsf* t, lr__tlsf_block* b, size_t size) {
+    size_t have = lr__tlsf_size(b);
+    lr__tlsf_block* rest;
+    lr__tlsf_block* next;
+
+    if (have < size + LR__TLSF_HEADER + LR__TLSF_MIN) {
+        return;
+    }
+    next = lr__tlsf_next(b);
+    rest = (lr__tlsf_block*)((unsigned char*)lr__tlsf_payload(b) + size);
+    rest->prev_phys = b;
+    rest->size = have - size - LR__TLSF_HEADER;
+    b->size = size;
+    if (next->size & LR__TLSF_FREE) {
+        lr__tlsf_remove(t, next);
+        rest->size += LR__TLSF_HEADER + next->size;
+        next = lr__tlsf_next(rest);
+    }
+    next->prev_phys = rest;
+    lr__tlsf_insert(t, rest);
+}
+
+/* Request size rounded to the alignment, or 0 if it is too large */
+static inline size_t lr__tlsf_adjust(size_t n) {
+    if (n >= LR__TLSF_MAX) {
+        return 0;
+    }
+    n = (n + (LR__TLSF_ALIGN - 1)) & ~(size_t)(LR__TLSF_ALIGN - 1);
+    return n < LR__TLSF_MIN ? LR__TLSF_MIN : n;
+}
+
+/* The allocator in buf, or NULL if size cannot hold its state and one block */
+static inline lr_tlsf* lr_tlsf_init(void* buf, size_t size) {
+    uintptr_t start = ((uintptr_t)buf + (LR__TLSF_ALIGN - 1)) & ~(uintptr_t)(LR__TLSF_ALIGN - 1);
+    uintptr_t end = (uintptr_t)buf + size, first;
+    lr__tlsf_block* b;
+    lr__tlsf_block* last;
+    lr_tlsf* t;
+    size_t bytes;
+
+    if (!buf || end < (uintptr_t)buf) {
+        return NULL;
+    }
+    first = start + ((sizeof(lr_tlsf) + (LR__TLSF_ALIGN - 1)) & ~(size_t)(LR__TLSF_ALIGN - 1));
+    /* One block and the zero-sized sentinel that ends the region */
+    if (first > end || end - first < 2 * LR__TLSF_HEADER + LR__TLSF_MIN) {
+        return NULL;
+    }
+    bytes = (size_t)(end - first - 2 * LR__TLSF_HEADER) & ~(size_t)(LR__TLSF_ALIGN - 1);
+    if (bytes >= LR__TLSF_MAX) {
+        bytes = LR__TLSF_MAX - LR__TLSF_ALIGN;
+    }
+    t = (lr_tlsf*)start;
+    memset(t, 0, sizeof(*t));
+    b = (lr__tlsf_block*)first;
+    b->prev_phys = NULL;
+    b->size = bytes;
+    last = lr__tlsf_next(b);
+    last->prev_phys = b;
+    last->size = 0;
+    lr__tlsf_insert(t, b);
+    return t;
+}
+
+static inline void* lr_tlsf_malloc(lr_tlsf* t, size_t n) {
+    size_t size = lr__tlsf_adjust(n);
+    lr__tlsf_block* b;
+
+    if (!size || !(b = lr__tlsf_find(t, size))) {
+        return NULL;
+    }
+    lr__tlsf_remove(t, b);
+    lr__tlsf_trim(t, b, size);
+    return lr__tlsf_payload(b);
+}
+
+static inline void lr_tlsf_free(lr_tlsf* t, void* p) {
+    lr__tlsf_block* b;
+    lr__tlsf_block* prev;
+    lr__tlsf_block* next;
+
+    if (!p) {
+        return;
+    }
+    b = lr__tlsf_block_of(p);
+    prev = b->prev_phys;
+    if (prev && (prev->size & LR__TLSF_FREE)) {
+        lr__tlsf_remove(t, prev);
+        prev->size += LR__TLSF_HEADER + b->size;
+        b = prev;
+    }
+    next = lr__tlsf_next(b);
+    if (next->size & LR__TLSF_FREE) {
+        lr__tlsf_remove(t, next);
+        b->size += LR__TLSF_HEADER + next->size;
+    }
+    lr__tlsf_next(b)->prev_phys = b;
+    lr__tlsf_insert(t, b);
+}
+
+static inline void* lr_tlsf_calloc(lr_tlsf* t, size_t n, size_t size) {
+    void* p;
+
+    if (size && n > (size_t)-1 / size) {
+        return NULL;
+    }
+    p = lr_tlsf_malloc(t, n * size);
+    if (p) {
+        memset(p, 0, n * size);
+    }
+    return p;
+}
+
+/* Resizes in place when the block or its free neighbours have room: a
+ * free successor is absorbed, and a free predecessor is absorbed by
+ * sliding the data down with memmove(). Otherwise it allocates, copies
+ * and frees. realloc(p, 0) frees p and returns NULL. */
+static inline void* lr_tlsf_realloc(lr_tlsf* t, void* p, size_t n) {
+    lr__tlsf_block* b;
+    lr__tlsf_block* prev;
+    lr__tlsf_block* next;
+    size_t size, have, room;
+    void* q;
+
+    if (!p) {
+        return lr_tlsf_malloc(t, n);
+    }
+    if (n == 0) {
+        lr_tlsf_free(t, p);
+        return NULL;
+    }
+    size = lr__tlsf_adjust(n);
+    if (!size) {
+        return NULL;
+    }
+    b = lr__tlsf_block_of(p);
+    have = b->size;
+    next = lr__tlsf_next(b);
+    room = have + ((next->size & LR__TLSF_FREE) ? LR__TLSF_HEADER + lr__tlsf_size(next) : 0);
+    if (size <= room) {
+        if (size > have) {
+            lr__tlsf_remove(t, next);
+            b->size = room;
+            lr__tlsf_next(b)->prev_phys = b;
+        }
+        lr__tlsf_trim(t, b, size);
+        return p;
+    }
+    prev = b->prev_phys;
+    if (prev && (prev->size & LR__TLSF_FREE) && size <= lr__tlsf_size(prev) + LR__TLSF_HEADER + room) {
+        lr__tlsf_remove(t, prev);
+        if (room > have) {
+            lr__tlsf_remove(t, next);
+        }
+        prev->size += LR__TLSF_HEADER + room;
+        lr__tlsf_next(prev)->prev_phys = prev;
+        memmove(lr__tlsf_payload(prev), p, have);
+        lr__tlsf_trim(t, prev, size);
+        return lr__tlsf_payload(prev);
+    }
+    q = lr_tlsf_malloc(t, n);
+    if (q) {
+        memcpy(q, p, have);
+        lr_tlsf_free(t, p);
+    }
+    return q;
+}
+
+/* Bytes usable at p, at least the size requested */
+static inline size_t lr_tlsf_usable_size(const void* p) {
+    return lr__tlsf_size(lr__tlsf_block_of((void*)p));
+}
+
+#ifdef LR_ATOMICS
+/* Bounded rings of elem_size-byte records over caller memory, with the
+ * ring's state at the cache-line aligned front of the buffer and the
+ * capacity rounded down to a power of two. The _n functions move as many
+ * records as fit (or are available), up to n, and return that count; a
+ * run that wraps past the end of the ring is two memcpy() calls.
+ *
+ * lr_spsc is for one producer and one consumer. Each side owns its index
+ * on its own cache line and keeps a cached copy of the other's, so it
+ * only reads the shared line when the cached view runs out.
+ *
+ * lr_mpmc is Dmitry Vyukov's bounded queue for any number of producers
+ * and consumers. Each slot carries a sequence number saying whose turn
+ * it is, and a thread claims a run of slots with one compare-and-swap of
+ * the shared position. The sequence numbers are a separate array, so the
+ * records stay contiguous for bulk copies. */
+static inline uint64_t lr__ring_capacity(size_t bytes, size_t slot) {
+    size_t n = bytes / slot;
+    return n ? (uint64_t)1 << (flsll((long long)n) - 1) : 0;
+}
+
+static inline void lr__ring_put(unsigned char* data, uint64_t mask, size_t elem, uint64_t pos, const void* src, size_t n) {
+    size_t at = (size_t)(pos & mask), first = (size_t)(mask + 1) - at;
+
+    if (first >= n) {
+        memcpy(data + at * elem, src, n * elem);
+    } else {
+        memcpy(data + at * elem, src, first * elem);
+        memcpy(data, (const unsigned char*)src + first * elem, (n - first) * elem);
+    }
+}
+
+static inline void lr__ring_get(const unsigned char* data, uint64_t mask, size_t elem, uint64_t pos, void* dst, size_t n) {
+    size_t at = (size_t)(pos & mask), first = (size_t)(mask + 1) - at;
+
+    if (first >= n) {
+        memcpy(dst, data + at * elem, n * elem);
+    } else {
+        memcpy(dst, data + at * elem, first * elem);
+        memcpy((unsigned char*)dst + first * elem, data, (n - first) * elem);
+    }
+}
+
+static inline uintptr_t lr__ring_align(uintptr_t p) {
+    return (p + (LR_CACHE_LINE - 1)) & ~(uintptr_t)(LR_CACHE_LINE - 1);
+}
+
+typedef struct lr_spsc {
+    volatile uint64_t head;   /* Next slot to write; written by the producer */
+    uint64_t tail_cache;      /* The producer's last view of tail */
+    char pad0[LR_CACHE_LINE - 2 * sizeof(uint64_t)];
+    volatile uint64_t tail;   /* Next slot to read; written by the consumer */
+    uint64_t head_cache;      /* The consumer's last view of head */
+    char pad1[LR_CACHE_LINE - 2 * sizeof(uint64_t)];
+    unsigned char* data;
+    uint64_t mask;
+    size_t elem;
+} lr_spsc;
+
+/* The ring in buf, or NULL if size cannot hold its state and one record */
+static inline lr_spsc* lr_spsc_init(void* buf, size_t size, size_t elem_size) {
+    uintptr_t start = lr__ring_align((uintptr_t)buf), end = (uintptr_t)buf + size, data;
+    uint64_t cap;
+    lr_spsc* q;
+
+    if (!buf || !elem_size || end < (uintptr_t)buf || start > end) {
+        return NULL;
+    }
+    data = lr__ring_align(start + sizeof(lr_spsc));
+    if (data < start || data > end || !(cap = lr__ring_capacity((size_t)(end - data), elem_size))) {
+        return NULL;
+    }
+    q = (lr_spsc*)start;
+    q->head = 0;
+    q->tail_cache = 0;
+    q->tail = 0;
+    q->head_cache = 0;
+    q->data = (unsigned char*)data;
+    q->mask = cap - 1;
+    q->elem = elem_size;
+    return q;
+}
+
+/* Producer side */
+static inline size_t lr_spsc_enqueue_n(lr_spsc* q, const void* src, size_t n) {
+    uint64_t head = q->head, room = q->mask + 1 - (head - q->tail_cache);
+
+    if (room < n) {
+        q->tail_cache = lr_atomic_load_u64(&q->tail, LR_ACQUIRE);
+        room = q->mask + 1 - (head - q->tail_cache);
+        if (room < n) {
+            n = (size_t)room;
+        }
+    }
+    if (n) {
+        lr__ring_put(q->data, q->mask, q->elem, head, src, n);
+        lr_atomic_store_u64(&q->head, head + n, LR_RELEASE);
+    }
+    return n;
+}
+
+/* Consumer side */
+static inline size_t lr_spsc_dequeue_n(lr_spsc* q, void* dst, size_t n) {
+    uint64_t tail = q->tail, avail = q->head_cache - tail;
+
+    if (avail < n) {
+        q->head_cache = lr_atomic_load_u64(&q->head, LR_ACQUIRE);
+        avail = q->head_cache - tail;
+        if (avail < n) {
+            n = (size_t)avail;
+        }
+    }
+    if (n) {
+        lr__ring_get(q->data, q->mask, q->elem, tail, dst, n);
+        lr_atomic_store_u64(&q->tail, tail + n, LR_RELEASE);
+    }
+    return n;
+}
+
+static inline int lr_spsc_enqueue(lr_spsc* q, const void* elem) {
+    return lr_spsc_enqueue_n(q, elem, 1) == 1;
+}
+
+static inline int lr_spsc_dequeue(lr_spsc* q, void* elem) {
+    return lr_spsc_dequeue_n(q, elem, 1) == 1;
+}
+
+static inline size_t lr_spsc_capacity(const lr_spsc* q) {
+    return (size_t)(q->mask + 1);
+}
+
+/* Records queued; exact only on a quiescent ring */
+static inline size_t lr_spsc_size(const lr_spsc* q) {
+    uint64_t tail = lr_atomic_load_u64(&q->tail, LR_ACQUIRE);
+    return (size_t)(lr_atomic_load_u64(&q->head, LR_ACQUIRE) - tail);
+}
+
+typedef struct lr_mpmc {
+    volatile uint64_t enqueue_pos;
+    char pad0[LR_CACHE_LINE - sizeof(uint64_t)];
+    volatile uint64_t dequeue_pos;
+    char pad1[LR_CACHE_LINE - sizeof(uint64_t)];
+    volatile uint64_t* seq;   /* Slot i is free for position p when seq[i] == p, full when p + 1 */
+    unsigned char* data;
+    uint64_t mask;
+    size_t elem;
+} lr_mpmc;
+
+/* The ring in buf, or NULL if size cannot hold its state and one record */
+static inline lr_mpmc* lr_mpmc_init(void* buf, size_t size, size_t elem_size) {
+    uintptr_t start = lr__ring_align((uintptr_t)buf), end = (uintptr_t)buf + size, seq, data;
+    uint64_t cap, i;
+    lr_mpmc* q;
+
+    if (!buf || !elem_size || elem_size > (size_t)-1 - sizeof(uint64_t) || end < (uintptr_t)buf || start > end) {
+        return NULL;
+    }
+    seq = lr__ring_align(start + sizeof(lr_mpmc));
+    /* Leave room for aligning the records after the sequence numbers */
+    if (seq < start || seq > end || end - seq < LR_CACHE_LINE) {
+        return NULL;
+    }
+    cap = lr__ring_capacity((size_t)(end - seq - LR_CACHE_LINE), elem_size + sizeof(uint64_t));
+    if (!cap) {
+        return NULL;
+    }
+    data = lr__ring_align(seq + cap * sizeof(uint64_t));
+    q = (lr_mpmc*)start;
+    q->enqueue_pos = 0;
+    q->dequeue_pos = 0;
+    q->seq = (volatile uint64_t*)seq;
+    q->data = (unsigned char*)data;
+    q->mask = cap - 1;
+    q->elem = elem_size;
+    for (i = 0; i < cap; i++) {
+        q->seq[i] = i;
+    }
+    return q;
+}
+
+static inline size_t lr_mpmc_enqueue_n(lr_mpmc* q, const void* src, size_t n) {
+    uint64_t pos = lr_atomic_load_u64(&q->enqueue_pos, LR_RELAXED);
+    size_t k, i;
+
+    for (;;) {
+        int64_t dif = 0;
+
+        /* Free slots in a row from pos, up to n */
+        for (k = 0; k < n; k++) {
+            dif = (int64_t)(lr_atomic_load_u64(&q->seq[(pos + k) & q->mask], LR_ACQUIRE) - (pos + k));
+            if (dif) {
+                break;
+            }
+        }
+        if (k) {
+            if (lr_atomic_cas_u64(&q->enqueue_pos, &pos, pos + k, LR_RELAXED)) {
+                break;
+            }
+        } else if (dif < 0 || !n) {
+            return 0;   /* Full: the slot still holds last round's record */
+        } else {
+            pos = lr_atomic_load_u64(&q->enqueue_pos, LR_RELAXED);
+        }
+    }
+    lr__ring_put(q->data, q->mask, q->elem, pos, src, k);
+    for (i = 0; i < k; i++) {
+        lr_atomic_store_u64(&q->seq[(pos + i) & q->mask], pos + i + 1, LR_RELEASE);
+    }
+    return k;
+}
+
+static inline size_t lr_mpmc_dequeue_n(lr_mpmc* q, void* dst, size_t n) {
+    uint64_t pos = lr_atomic_load_u64(&q->dequeue_pos, LR_RELAXED);
+    size_t k, i;
+
+    for (;;) {
+        int64_t dif = 0;
+
+        /* Full slots in a row from pos, up to n */
+        for (k = 0; k < n; k++) {
+            dif = (int64_t)(lr_atomic_load_u64(&q->seq[(pos + k) & q->mask], LR_ACQUIRE) - (pos + k + 1));
+            if (dif) {
+                break;
+            }
+        }
+        if (k) {
+            if (lr_atomic_cas_u64(&q->dequeue_pos, &pos, pos + k, LR_RELAXED)) {
+                break;
+            }
+        } else if (dif < 0 || !n) {
+            return 0;   /* Empty: the slot has not been written this round */
+        } else {
+            pos = lr_atomic_load_u64(&q->dequeue_pos, LR_RELAXED);
+        }
+    }
+    lr__ring_get(q->data, q->mask, q->elem, pos, dst, k);
+    for (i = 0; i < k; i++) {
+        lr_atomic_store_u64(&q->seq[(pos + i) & q->mask], pos + i + q->mask + 1, LR_RELEASE);
+    }
+    return k;
+}
+
+static inline int lr_mpmc_enqueue(lr_mpmc* q, const void* elem) {
+    return lr_mpmc_enqueue_n(q, elem, 1) == 1;
+}
+
+static inline int lr_mpmc_dequeue(lr_mpmc* q, void* elem) {
+    return lr_mpmc_dequeue_n(q, elem, 1) == 1;
+}
+
+static inline size_t lr_mpmc_capacity(const lr_mpmc* q) {
+    return (size_t)(q->mask + 1);
+}
+#endif
+
+#ifdef LR_ATOMICS
+/* Chase-Lev work-stealing deque of non-NULL pointers over caller memory,
+ * with the capacity rounded down to a power of two. The owning thread
+ * pushes and takes at the bottom; any other thread steals from the top.
+ * push fails when the deque is full, as the caller's memory cannot grow.
+ *
+ * The one ordering x86 does not give for free is take's store of bottom
+ * before its load of top, which the seq_cst store (xchg) provides; the
+ * other seq_cst loads and stores are plain moves there. Elsewhere the
+ * same code is sequentially consistent through the __atomic builtins.
+ * The race for the last item is settled by a CAS on top. */
+typedef struct lr_wsdeque {
+    volatile uint64_t top;      /* Oldest item; advanced by thieves and by take of the last item */
+    char pad0[LR_CACHE_LINE - sizeof(uint64_t)];
+    volatile uint64_t bottom;   /* One past the newest item; written only by the owner */
+    char pad1[LR_CACHE_LINE - sizeof(uint64_t)];
+    volatile lr__ptr* items;
+    uint64_t mask;
+} lr_wsdeque;
+
+/* The deque in buf, or NULL if size cannot hold its state and one item */
+static inline lr_wsdeque* lr_wsdeque_init(void* buf, size_t size) {
+    uintptr_t start = lr__ring_align((uintptr_t)buf), end = (uintptr_t)buf + size, items;
+    uint64_t cap;
+    lr_wsdeque* d;
+
+    if (!buf || end < (uintptr_t)buf || start > end) {
+        return NULL;
+    }
+    items = lr__ring_align(start + sizeof(lr_wsdeque));
+    if (items < start || items > end || !(cap = lr__ring_capacity((size_t)(end - items), sizeof(lr__ptr)))) {
+        return NULL;
+    }
+    d = (lr_wsdeque*)start;
+    d->top = 0;
+    d->bottom = 0;
+    d->items = (volatile lr__ptr*)items;
+    d->mask = cap - 1;
+    return d;
+}
+
+/* Owner only; 0 if the deque is full */
+static inline int lr_wsdeque_push(lr_wsdeque* d, void* item) {
+    uint64_t b = lr_atomic_load_u64(&d->bottom, LR_RELAXED);
+    uint64_t t = lr_atomic_load_u64(&d->top, LR_ACQUIRE);
+
+    if (b - t > d->mask) {
+        return 0;
+    }
+    lr_atomic_store_ptr(&d->items[b & d->mask], item, LR_RELAXED);
+    lr_atomic_store_u64(&d->bottom, b + 1, LR_RELEASE);
+    return 1;
+}
+
+/* Owner only; the newest item, or NULL if empty */
+static inline void* lr_wsdeque_take(lr_wsdeque* d) {
+    uint64_t b = lr_atomic_load_u64(&d->bottom, LR_RELAXED) - 1, t;
+    void* item;
+
+    /* Reserve the bottom item before looking at top */
+    lr_atomic_store_u64(&d->bottom, b, LR_SEQ_CST);
+    t = lr_atomic_load_u64(&d->top, LR_SEQ_CST);
+    if ((int64_t)(b - t) < 0) {
+        lr_atomic_store_u64(&d->bottom, b + 1, LR_RELAXED);
+        return NULL;
+    }
+    item = lr_atomic_load_ptr(&d->items[b & d->mask], LR_RELAXED);
+    if (b == t) {
+        /* Last item: a thief may be after it too */
+        if (!lr_atomic_cas_u64(&d->top, &t, t + 1, LR_SEQ_CST)) {
+            item = NULL;
+        }
+        lr_atomic_store_u64(&d->bottom, b + 1, LR_RELAXED);
+    }
+    return item;
+}
+
+/* Any thread; the oldest item, or NULL if empty or another thread got it first */
+static inline void* lr_wsdeque_steal(lr_wsdeque* d) {
+    uint64_t t = lr_atomic_load_u64(&d->top, LR_SEQ_CST), b;
+    void* item;
+
+    b = lr_atomic_load_u64(&d->bottom, LR_SEQ_CST);
+    if ((int64_t)(b - t) <= 0) {
+        return NULL;
+    }
+    item = lr_atomic_load_ptr(&d->items[t & d->mask], LR_RELAXED);
+    return lr_atomic_cas_u64(&d->top, &t, t + 1, LR_SEQ_CST) ? item : NULL;
+}
+
+static inline size_t lr_wsdeque_capacity(const lr_wsdeque* d) {
+    return (size_t)(d->mask + 1);
+}
+
+/* Items queued; exact only on a quiescent deque */
+static inline size_t lr_wsdeque_size(const lr_wsdeque* d) {
+    uint64_t t = lr_atomic_load_u64(&d->top, LR_ACQUIRE);
+    int64_t n = (int64_t)(lr_atomic_load_u64(&d->bottom, LR_ACQUIRE) - t);
+    return n > 0 ? (size_t)n : 0;
+}
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+/* C++14: formats split at compile time. LR_SNPRINTF(buf, cap, "fmt", ...)
+ * parses the literal once during compilation and converts each argument by
+ * its static type, so a mismatched or missing argument is converted (or
+ * zeroed) instead of being misread from the stack. */
+#if defined(__cplusplus) && __cplusplus >= 201402L
+namespace lr {
+
+/* A literal run followed by a specification (conv 0 after the last run) */
+struct fmtpiece {
+    size_t offset;
+    size_t length;
+    lr__fmtspec spec;
+};
+
+/* Pieces in fmt: one per conversion plus the final literal run */
+constexpr size_t fmt_pieces(const char* fmt) {
+    size_t n = 1;
+    lr__fmtspec spec{};
+
+    for (const char* end = lr__fmt_literal(fmt); *end; end = lr__fmt_literal(fmt)) {
+        fmt = lr__fmt_parse(end + 1, &spec);
+        n++;
+    }
+    return n;
+}
+
+template <size_t N, size_t P>
+struct format {
+    char text[N];
+    fmtpiece pieces[P];
+    size_t count;
+};
+
+/* P is fmt_pieces(fmt) */
+template <size_t P, size_t N>
+constexpr format<N, P> compile_format(const char (&fmt)[N]) {
+    format<N, P> f{};
+    const char* p = fmt;
+    
+    for (size_t i = 0; i < N; i++) {
+        f.text[i] = fmt[i];
+    }
+    for (;;) {
+        const char* end = lr__fmt_literal(p);
+        fmtpiece& piece = f.pieces[f.count++];
+        piece.offset = (size_t)(p - fmt);
+        piece.length = (size_t)(end - p);
+        if (!*end) {
+            break;
+        }
+        p = lr__fmt_parse(end + 1, &piece.spec);
+    }
+    return f;
+}
+
+/* An argument tagged with its static type */
+struct fmtval {
+    lr__fmtarg v;
+    char kind;          /* 'i' signed, 'u' unsigned, 'f' floating, 'p' pointer, 's' string */
+    unsigned char size;
+};
+
+#define LR__FMT_VALUE(T, kind_, member) \
+    static inline fmtval fmt_value(T x) { \
+        fmtval r{}; \
+        r.v.member = x; \
+        r.kind = kind_; \
+        r.size = sizeof(T); \
+        return r; \
+    }
+LR__FMT_VALUE(bool, 'u', u)
+LR__FMT_VALUE(char, 'i', i)
+LR__FMT_VALUE(signed char, 'i', i)
+LR__FMT_VALUE(short, 'i', i)
+LR__FMT_VALUE(int, 'i', i)
+LR__FMT_VALUE(long, 'i', i)
+LR__FMT_VALUE(long long, 'i', i)
+LR__FMT_VALUE(unsigned char, 'u', u)
+LR__FMT_VALUE(unsigned short, 'u', u)
+LR__FMT_VALUE(unsigned, 'u', u)
+LR__FMT_VALUE(unsigned long, 'u', u)
+LR__FMT_VALUE(unsigned long long, 'u', u)
+LR__FMT_VALUE(float, 'f', d)
+LR__FMT_VALUE(double, 'f', d)
+LR__FMT_VALUE(long double, 'f', d)
+LR__FMT_VALUE(char*, 's', p)
+LR__FMT_VALUE(const char*, 's', p)
+#undef LR__FMT_VALUE
+
+template <class T>
+static inline fmtval fmt_value(T* x) {
+    fmtval r{};
+    r.v.p = (const void*)x;
+    r.kind = 'p';
+    return r;
+}
+
+static inline fmtval fmt_value(decltype(nullptr)) {
+    fmtval r{};
+    r.kind = 'p';
+    return r;
+}
+
+/* x as the argument conversion conv expects; false if conv takes none */
+static inline bool fmt_convert(char conv, const fmtval* x, lr__fmtarg* a) {
+    a->u = 0;
+    if (conv == 'd' || conv == 'i' || conv == 'c') {
+        if (!x) {
+        } else if (x->kind == 'i') {
+            a->i = x->v.i;
+        } else if (x->kind == 'u') {
+            a->i = (long long)x->v.u;
+        } else if (x->kind == 'f') {
+            a->i = x->v.d > -9.2e18 && x->v.d < 9.2e18 ? (long long)x->v.d : 0;
+        } else {
+            a->i = (long long)(intptr_t)x->v.p;
+        }
+    } else if (conv == 'u' || conv == 'x' || conv == 'X' || conv == 'o') {
+        if (!x) {
+        } else if (x->kind == 'i') {
+            /* Reinterpreted at its own width, as printf("%x", -1) does */
+            a->u = (unsigned long long)x->v.i;
+            a->u &= x->size < 8 ? (1ULL << (8 * x->size)) - 1 : ~0ULL;
+        } else if (x->kind == 'u') {
+            a->u = x->v.u;
+        } else if (x->kind == 'f') {
+            a->u = x->v.d > -9.2e18 && x->v.d < 1.8e19 ? (x->v.d < 0 ? (unsigned long long)(long long)x->v.d : (unsigned long long)x->v.d) : 0;
+        } else {
+            a->u = (uintptr_t)x->v.p;
+        }
+    } else if (conv == 'f' || conv == 'F' || conv == 'e' || conv == 'E' || conv == 'g' || conv == 'G') {
+        if (!x) {
+            a->d = 0;
+        } else if (x->kind == 'i') {
+            a->d = (double)x->v.i;
+        } else if (x->kind == 'u') {
+            a->d = (double)x->v.u;
+        } else if (x->kind == 'f') {
+            a->d = x->v.d;
+        } else {
+            a->d = 0;
+        }
+    } else if (conv == 's') {
+        a->p = x && x->kind == 's' ? x->v.p : nullptr;
+    } else if (conv == 'p') {
+        a->p = !x ? nullptr : x->kind == 'p' || x->kind == 's' ? x->v.p : (const void*)(uintptr_t)x->v.u;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+static inline int fmt_run(char* buf, size_t cap, const char* text, const fmtpiece* pieces, size_t count,
+                          const fmtval* vals, size_t nvals) {
+    lr__out o = { buf, cap, 0 };
+    size_t next = 0;
+    
+    for (size_t i = 0; i < count; i++) {
+        const lr__fmtspec& spec = pieces[i].spec;
+        lr__fmtarg a;
+        int width = spec.width, precision = spec.precision;
+        
+        lr__out_chars(&o, text + pieces[i].offset, pieces[i].length);
+        if (!spec.conv) {
+            continue;
+        }
+        if (width == LR__FMT_STAR) {
+            fmt_convert('d', next < nvals ? &vals[next++] : nullptr, &a);
+            width = (int)a.i;
+        }
+        if (precision == LR__FMT_STAR) {
+            fmt_convert('d', next < nvals ? &vals[next++] : nullptr, &a);
+            precision = (int)a.i;
+        }
+        if (fmt_convert(spec.conv, next < nvals ? &vals[next] : nullptr, &a)) {
+            next++;
+        }
+        lr__fmt_emit(&o, &spec, width, precision, a);
+    }
+    return lr__out_finish(&o);
+}
+
+} /* namespace lr */
+
+template <size_t N, size_t P, class... Args>
+static inline int lr_snprintf(char* buf, size_t cap, const lr::format<N, P>& f, Args... args) {
+    const lr::fmtval vals[sizeof...(Args) + 1] = { lr::fmt_value(args)... };
+    return lr::fmt_run(buf, cap, f.text, f.pieces, f.count, vals, sizeof...(Args));
+}
+
+/* The format must be a string literal; it is parsed into a static constant */
+#define LR_SNPRINTF(buf, cap, fmt, ...) \
+    lr_snprintf((buf), (cap), []() -> const auto& { \
+        static constexpr auto lr__format = lr::compile_format<lr::fmt_pieces(fmt)>(fmt); \
+        return lr__format; \
+    }(), ##__VA_ARGS__)
 #endif
 
 #endif /* LIBC_REDACTED_H */
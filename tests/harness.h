@@ -0,0 +1,63 @@
+/* Shared helpers for the tests: a failure counter, a clock and a way to
+ * run one function on several threads. */
+#ifndef LR_TESTS_HARNESS_H
+#define LR_TESTS_HARNESS_H
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "libc-redacted.h"
+
+#define MAX_THREADS 16
+
+static int failures;
+
+#define CHECK(c)                                                                                                                 \
+    do {                                                                                                                         \
+        if (!(c)) {                                                                                                              \
+            failures++;                                                                                                          \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #c);                                                         \
+        }                                                                                                                        \
+    } while (0)
+
+static inline double now_ns(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+/* One per online CPU, but at least 2 so there is always contention */
+static inline int thread_count(void) {
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+
+    if (n < 2) {
+        return 2;
+    } else if (n > MAX_THREADS) {
+        return MAX_THREADS;
+    }
+    return (int)n;
+}
+
+/* Runs fn((void*)0) to fn((void*)(n - 1)) on n threads and waits for all */
+static inline void run_threads(int n, void* (*fn)(void*)) {
+    pthread_t t[MAX_THREADS];
+    int i;
+
+    for (i = 0; i < n; i++) {
+        pthread_create(&t[i], NULL, fn, (void*)(intptr_t)i);
+    }
+    for (i = 0; i < n; i++) {
+        pthread_join(t[i], NULL);
+    }
+}
+
+/* For waits that cannot make progress until another thread runs */
+static inline void yield(void) {
+    sched_yield();
+}
+
+#endif /* LR_TESTS_HARNESS_H */
@@ -0,0 +1,111 @@
+/* Spin, ticket and MCS locks: threads take the lock in a loop for a
+ * fixed time, and a counter updated only under the lock must match the
+ * number of acquisitions. "locks bench" runs the same loop on one thread
+ * per CPU and reports the contended cost of an acquisition. */
+#include "harness.h"
+
+#define CHECK_NS 200e6
+#define BENCH_NS 1e9
+
+enum { SPIN, TICKET, MCS };
+
+static const char* const lock_names[] = { "spin", "ticket", "mcs" };
+static int kind;
+static double deadline;
+static lr_spinlock spin = LR_SPINLOCK_INIT;
+static lr_ticketlock ticket = LR_TICKETLOCK_INIT;
+static lr_mcslock mcs = LR_MCSLOCK_INIT;
+static volatile uint64_t counter;
+static volatile uint32_t inside;
+static uint64_t overlaps;
+static uint64_t acquired[MAX_THREADS];
+
+static void acquire(lr_mcs_node* node) {
+    if (kind == SPIN) {
+        lr_spin_lock(&spin);
+    } else if (kind == TICKET) {
+        lr_ticket_lock(&ticket);
+    } else {
+        lr_mcs_lock(&mcs, node);
+    }
+}
+
+static void release(lr_mcs_node* node) {
+    if (kind == SPIN) {
+        lr_spin_unlock(&spin);
+    } else if (kind == TICKET) {
+        lr_ticket_unlock(&ticket);
+    } else {
+        lr_mcs_unlock(&mcs, node);
+    }
+}
+
+static void* lock_thread(void* arg) {
+    size_t me = (size_t)(intptr_t)arg;
+    lr_mcs_node node;
+    uint64_t n = 0;
+    int i;
+
+    do {
+        for (i = 0; i < 64; i++) {
+            acquire(&node);
+            /* A second holder would see inside set, or lose an increment */
+            overlaps += inside;
+            inside = 1;
+            counter = counter + 1;
+            inside = 0;
+            release(&node);
+        }
+        n += 64;
+    } while (now_ns() < deadline);
+    acquired[me] = n;
+    return NULL;
+}
+
+/* Runs the loop with lock k on threads threads for ns; the acquisitions */
+static uint64_t contend(int k, int threads, double ns) {
+    uint64_t total = 0;
+    int i;
+
+    kind = k;
+    counter = 0;
+    overlaps = 0;
+    deadline = now_ns() + ns;
+    run_threads(threads, lock_thread);
+    for (i = 0; i < threads; i++) {
+        total += acquired[i];
+    }
+    CHECK(counter == total && overlaps == 0);
+    return total;
+}
+
+static void test_trylock(void) {
+    lr_mcs_node a, b;
+
+    CHECK(lr_spin_trylock(&spin) && !lr_spin_trylock(&spin));
+    lr_spin_unlock(&spin);
+    CHECK(lr_ticket_trylock(&ticket) && !lr_ticket_trylock(&ticket));
+    lr_ticket_unlock(&ticket);
+    CHECK(lr_mcs_trylock(&mcs, &a) && !lr_mcs_trylock(&mcs, &b));
+    lr_mcs_unlock(&mcs, &a);
+}
+
+int main(int argc, char** argv) {
+    int k, threads = thread_count();
+
+    if (argc > 1 && !strcmp(argv[1], "bench")) {
+        for (k = SPIN; k <= MCS; k++) {
+            double t0 = now_ns();
+            uint64_t n = contend(k, threads, BENCH_NS);
+
+            printf("%-6s %d threads %8.1f ns per acquisition\n", lock_names[k], threads, (now_ns() - t0) / (double)n);
+        }
+        return failures != 0;
+    }
+    test_trylock();
+    for (k = SPIN; k <= MCS; k++) {
+        contend(k, 4, CHECK_NS);
+    }
+    printf("locks: %s\n", failures ? "FAILED" : "ok");
+    return failures != 0;
+}
@@ -0,0 +1,62 @@
+/* strsort on heap strings allocated at their exact size, most of them
+ * shorter than a word, plus long shared prefixes. Under
+ * -fsanitize=address any read past a terminator is reported. */
+#include "harness.h"
+
+/* Not from <stdlib.h>, whose declarations clash with the header's */
+void* malloc(size_t size);
+void free(void* p);
+
+#define COUNT 5000
+
+static uint64_t xorshift_state = 88172645463325252ull;
+
+static uint64_t xorshift(void) {
+    xorshift_state ^= xorshift_state << 13;
+    xorshift_state ^= xorshift_state >> 7;
+    xorshift_state ^= xorshift_state << 17;
+    return xorshift_state;
+}
+
+static int compare_ptr(const void* a, const void* b) {
+    uintptr_t x = (uintptr_t)*(char* const*)a, y = (uintptr_t)*(char* const*)b;
+    return (x > y) - (x < y);
+}
+
+/* Sorts n random strings of up to max_len bytes over a small alphabet */
+static void test_random(size_t n, size_t max_len, size_t prefix) {
+    static char* strs[COUNT];
+    static char* before[COUNT];
+    size_t i, j;
+
+    for (i = 0; i < n; i++) {
+        size_t len = prefix + (size_t)(xorshift() % (max_len + 1));
+        char* s = (char*)malloc(len + 1);
+
+        for (j = 0; j < len; j++) {
+            s[j] = j < prefix ? 'p' : (char)('a' + xorshift() % 3);
+        }
+        s[len] = '\0';
+        strs[i] = before[i] = s;
+    }
+    strsort(strs, n);
+    for (i = 1; i < n; i++) {
+        CHECK(strcmp(strs[i - 1], strs[i]) <= 0);
+    }
+    /* The same pointers, only reordered */
+    qsort(strs, n, sizeof(char*), compare_ptr);
+    qsort(before, n, sizeof(char*), compare_ptr);
+    for (i = 0; i < n; i++) {
+        CHECK(strs[i] == before[i]);
+        free(strs[i]);
+    }
+}
+
+int main(void) {
+    test_random(40, 3, 0);
+    test_random(COUNT, 3, 0);
+    test_random(COUNT, 12, 0);
+    test_random(COUNT, 4, 20);
+    printf("strsort: %s\n", failures ? "FAILED" : "ok");
+    return failures != 0;
+}
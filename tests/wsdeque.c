@@ -0,0 +1,141 @@
+/* lr_wsdeque: single-threaded order and wraparound, then an owner that
+ * pushes and takes while the other threads steal, checking that every
+ * item comes out exactly once. "wsdeque bench" times the operations. */
+#include "harness.h"
+
+#define ITEMS 1000000
+
+static unsigned char storage[LR_CACHE_LINE * 4 + 1024 * sizeof(void*)];
+static lr_wsdeque* deque;
+static volatile uint32_t seen[ITEMS + 1];
+static volatile uint32_t owner_done;
+static uint64_t xorshift_state = 88172645463325252ull;
+
+static uint64_t xorshift(void) {
+    xorshift_state ^= xorshift_state << 13;
+    xorshift_state ^= xorshift_state >> 7;
+    xorshift_state ^= xorshift_state << 17;
+    return xorshift_state;
+}
+
+/* A deque holding capacity items (a power of two), from a cache-line
+ * aligned start so that no slack rounds the capacity up */
+static lr_wsdeque* make_deque(size_t capacity) {
+    unsigned char* start = storage + (-(uintptr_t)storage & (LR_CACHE_LINE - 1));
+    lr_wsdeque* d = lr_wsdeque_init(start, LR_CACHE_LINE * 3 + capacity * sizeof(void*));
+
+    CHECK(d && lr_wsdeque_capacity(d) == capacity);
+    return d;
+}
+
+static void test_order(void) {
+    lr_wsdeque* d = make_deque(4);
+    uintptr_t i, round;
+
+    CHECK(!lr_wsdeque_init(storage, LR_CACHE_LINE * 2));
+    CHECK(!lr_wsdeque_take(d) && !lr_wsdeque_steal(d));
+    /* Each round leaves the indices 3 further on, so slots wrap many times */
+    for (round = 0; round < 100; round++) {
+        for (i = 1; i <= 4; i++) {
+            CHECK(lr_wsdeque_push(d, (void*)(round * 8 + i)));
+        }
+        CHECK(!lr_wsdeque_push(d, (void*)1) && lr_wsdeque_size(d) == 4);
+        CHECK(lr_wsdeque_steal(d) == (void*)(round * 8 + 1));
+        CHECK(lr_wsdeque_take(d) == (void*)(round * 8 + 4));
+        CHECK(lr_wsdeque_push(d, (void*)(round * 8 + 5)));
+        CHECK(lr_wsdeque_steal(d) == (void*)(round * 8 + 2));
+        CHECK(lr_wsdeque_take(d) == (void*)(round * 8 + 5));
+        CHECK(lr_wsdeque_take(d) == (void*)(round * 8 + 3));
+        CHECK(!lr_wsdeque_take(d) && !lr_wsdeque_steal(d) && lr_wsdeque_size(d) == 0);
+    }
+}
+
+static void* stress_thread(void* arg) {
+    if (arg == 0) {
+        uintptr_t i = 1;
+        void* item;
+
+        while (i <= ITEMS) {
+            if (xorshift() % 3) {
+                if (lr_wsdeque_push(deque, (void*)i)) {
+                    i++;
+                } else {
+                    yield();
+                }
+            } else if ((item = lr_wsdeque_take(deque)) != NULL) {
+                lr_atomic_fetch_add_u32(&seen[(uintptr_t)item], 1, LR_RELAXED);
+            }
+        }
+        while ((item = lr_wsdeque_take(deque)) != NULL) {
+            lr_atomic_fetch_add_u32(&seen[(uintptr_t)item], 1, LR_RELAXED);
+        }
+        lr_atomic_store_u32(&owner_done, 1, LR_RELEASE);
+    } else {
+        for (;;) {
+            int done = lr_atomic_load_u32(&owner_done, LR_ACQUIRE) != 0;
+            void* item = lr_wsdeque_steal(deque);
+
+            if (item) {
+                lr_atomic_fetch_add_u32(&seen[(uintptr_t)item], 1, LR_RELAXED);
+            } else if (done) {
+                break;
+            } else {
+                yield();
+            }
+        }
+    }
+    return NULL;
+}
+
+static void test_stress(size_t capacity) {
+    size_t i, wrong = 0;
+
+    deque = make_deque(capacity);
+    owner_done = 0;
+    for (i = 0; i <= ITEMS; i++) {
+        seen[i] = 0;
+    }
+    run_threads(thread_count(), stress_thread);
+    for (i = 1; i <= ITEMS; i++) {
+        wrong += seen[i] != 1;
+    }
+    CHECK(wrong == 0);
+}
+
+static void bench(void) {
+    lr_wsdeque* d = make_deque(1024);
+    uintptr_t i;
+    double t0, t1;
+    int threads = thread_count();
+
+    t0 = now_ns();
+    for (i = 1; i <= ITEMS; i++) {
+        lr_wsdeque_push(d, (void*)i);
+        lr_wsdeque_take(d);
+    }
+    t1 = now_ns();
+    printf("push+take  %6.1f ns\n", (t1 - t0) / ITEMS);
+    t0 = now_ns();
+    for (i = 1; i <= ITEMS; i++) {
+        lr_wsdeque_push(d, (void*)i);
+        lr_wsdeque_steal(d);
+    }
+    t1 = now_ns();
+    printf("push+steal %6.1f ns\n", (t1 - t0) / ITEMS);
+    t0 = now_ns();
+    test_stress(1024);
+    t1 = now_ns();
+    printf("%d threads %6.1f ns per item\n", threads, (t1 - t0) / ITEMS);
+}
+
+int main(int argc, char** argv) {
+    if (argc > 1 && !strcmp(argv[1], "bench")) {
+        bench();
+        return failures != 0;
+    }
+    test_order();
+    test_stress(1024);
+    test_stress(4);
+    printf("wsdeque: %s\n", failures ? "FAILED" : "ok");
+    return failures != 0;
+}